@@ -1,5 +1,7 @@
 # Provide CPU_SMP definition: set it to 1 to enable SMP, set it to 0 to disable it
 C_FLAGS += -DCPU_SMP=1
+# Provide CPU_SMP_CONTIGUOUS definition: set it to 1 to assign a contiguous range of time instants to each SMP batch, set it to 0 to interleave them
+C_FLAGS += -DCPU_SMP_CONTIGUOUS=1
 # Provide CPU_ENABLE_SIMD definition: set it to 1 to enable SIMD, set it to 0 to disable it
 C_FLAGS += -DCPU_ENABLE_SIMD=1
 
@@ -7,3 +9,6 @@ C_FLAGS += -DCPU_ENABLE_SIMD=1
 # The option -fPIC is mandatory to generate Program Independent Code
 C_FLAGS_SHARED += -fPIC
 
+# Provide set of libraries needed by the Shared Object.
+# The option -lm is mandatory, since parametric components are computed through libm
+LIBS_SHARED += -lm
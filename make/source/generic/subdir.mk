@@ -2,42 +2,58 @@
 C_SRCS += \
 ../source/generic/binomial.c \
 ../source/generic/bridge_generic.c \
+../source/generic/combcache.c \
 ../source/generic/combinations.c \
 ../source/generic/koon_generic.c \
+../source/generic/memory.c \
 ../source/generic/parallel_generic.c \
 ../source/generic/processor_generic.c \
 ../source/generic/rbd_internal_generic.c \
-../source/generic/series_generic.c 
+../source/generic/scheduler.c \
+../source/generic/series_generic.c \
+../source/generic/threadpool.c 
 
 C_DEPS += \
 ./source/generic/binomial.d \
 ./source/generic/bridge_generic.d \
+./source/generic/combcache.d \
 ./source/generic/combinations.d \
 ./source/generic/koon_generic.d \
+./source/generic/memory.d \
 ./source/generic/parallel_generic.d \
 ./source/generic/processor_generic.d \
 ./source/generic/rbd_internal_generic.d \
-./source/generic/series_generic.d 
+./source/generic/scheduler.d \
+./source/generic/series_generic.d \
+./source/generic/threadpool.d 
 
 OBJS_AR += \
 ./source/generic/binomial.ar.o \
 ./source/generic/bridge_generic.ar.o \
+./source/generic/combcache.ar.o \
 ./source/generic/combinations.ar.o \
 ./source/generic/koon_generic.ar.o \
+./source/generic/memory.ar.o \
 ./source/generic/parallel_generic.ar.o \
 ./source/generic/processor_generic.ar.o \
 ./source/generic/rbd_internal_generic.ar.o \
-./source/generic/series_generic.ar.o 
+./source/generic/scheduler.ar.o \
+./source/generic/series_generic.ar.o \
+./source/generic/threadpool.ar.o 
 
 OBJS_SO += \
 ./source/generic/binomial.so.o \
 ./source/generic/bridge_generic.so.o \
+./source/generic/combcache.so.o \
 ./source/generic/combinations.so.o \
 ./source/generic/koon_generic.so.o \
+./source/generic/memory.so.o \
 ./source/generic/parallel_generic.so.o \
 ./source/generic/processor_generic.so.o \
 ./source/generic/rbd_internal_generic.so.o \
-./source/generic/series_generic.so.o 
+./source/generic/scheduler.so.o \
+./source/generic/series_generic.so.o \
+./source/generic/threadpool.so.o 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -3,25 +3,37 @@ C_SRCS += \
 ../source/bridge.c \
 ../source/koon.c \
 ../source/parallel.c \
-../source/series.c 
+../source/parametric.c \
+../source/sequence.c \
+../source/series.c \
+../source/tree.c 
 
 C_DEPS += \
 ./source/bridge.d \
 ./source/koon.d \
 ./source/parallel.d \
-./source/series.d 
+./source/parametric.d \
+./source/sequence.d \
+./source/series.d \
+./source/tree.d 
 
 OBJS_AR += \
 ./source/bridge.ar.o \
 ./source/koon.ar.o \
 ./source/parallel.ar.o \
-./source/series.ar.o 
+./source/parametric.ar.o \
+./source/sequence.ar.o \
+./source/series.ar.o \
+./source/tree.ar.o 
 
 OBJS_SO += \
 ./source/bridge.so.o \
 ./source/koon.so.o \
 ./source/parallel.so.o \
-./source/series.so.o 
+./source/parametric.so.o \
+./source/sequence.so.o \
+./source/series.so.o \
+./source/tree.so.o 
 
 
 # Each subdirectory must supply rules for building sources it contributes
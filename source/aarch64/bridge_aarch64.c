@@ -28,6 +28,51 @@
 #include "../bridge.h"
 
 
+static void *rbdBridgeGenericWorker(void *arg);
+static void *rbdBridgeIdenticalWorker(void *arg);
+
+
+/**
+ * rbdBridgeResolveWorkers
+ *
+ * Resolve Bridge RBD Workers with AArch64 NEON
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the Bridge RBD Workers exploiting AArch64 NEON instruction set, unless
+ *  it is excluded by the requested instruction set family, in which case scalar Workers are selected.
+ *  It is invoked once at library load time, so that RBD computations directly invoke
+ *  the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdBridgeResolveWorkers(void)
+{
+    /* Resolve generic Bridge RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorker;
+    }
+    else {
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerS1d;
+    }
+
+    /* Resolve identical Bridge RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorker;
+    }
+    else {
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerS1d;
+    }
+}
 
 /**
  * rbdBridgeGenericWorker
@@ -52,7 +97,7 @@
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdBridgeGenericWorker(void *arg)
+static void *rbdBridgeGenericWorker(void *arg)
 {
     struct rbdBridgeData *data;
     unsigned int time;
@@ -60,20 +105,20 @@ HIDDEN void *rbdBridgeGenericWorker(void *arg)
     /* Retrieve Bridge RBD data */
     data = (struct rbdBridgeData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepV2dNeon(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepS1d(data, time);
     }
@@ -104,7 +149,7 @@ HIDDEN void *rbdBridgeGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
+static void *rbdBridgeIdenticalWorker(void *arg)
 {
     struct rbdBridgeData *data;
     unsigned int time;
@@ -112,11 +157,11 @@ HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
     /* Retrieve Bridge RBD data */
     data = (struct rbdBridgeData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Bridge RBD at current time instant */
             rbdBridgeIdenticalStepS1d(data, time);
             /* Increment current time instant */
@@ -124,17 +169,17 @@ HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
         }
     }
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepV2dNeon(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepS1d(data, time);
     }
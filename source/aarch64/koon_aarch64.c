@@ -28,6 +28,69 @@
 #include "../koon.h"
 
 
+static FUNCTION_TARGET("arch=armv8-a") void *rbdKooNFillWorker(void *arg);
+static void *rbdKooNGenericWorker(void *arg);
+static void *rbdKooNIdenticalWorker(void *arg);
+static void *rbdKooNAllWorker(void *arg);
+
+
+/**
+ * rbdKooNResolveWorkers
+ *
+ * Resolve KooN RBD Workers with AArch64 NEON
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the KooN RBD Workers exploiting AArch64 NEON instruction set, unless
+ *  it is excluded by the requested instruction set family, in which case scalar Workers are selected.
+ *  It is invoked once at library load time, so that RBD computations directly invoke
+ *  the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdKooNResolveWorkers(void)
+{
+    /* Resolve fill KooN output Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        koonWorkers.fillWorker = &rbdKooNFillWorker;
+    }
+    else {
+        koonWorkers.fillWorker = &rbdKooNFillWorkerS1d;
+    }
+
+    /* Resolve generic KooN RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        koonWorkers.genericWorker = &rbdKooNGenericWorker;
+    }
+    else {
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerS1d;
+    }
+
+    /* Resolve identical KooN RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorker;
+    }
+    else {
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerS1d;
+    }
+
+    /* Resolve all KooN RBDs Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        koonWorkers.allWorker = &rbdKooNAllWorker;
+    }
+    else {
+        koonWorkers.allWorker = &rbdKooNAllWorkerS1d;
+    }
+}
 
 /**
  * rbdKooNFillWorker
@@ -52,7 +115,7 @@
  * Return (void *):
  *  NULL
  */
-HIDDEN FUNCTION_TARGET("arch=armv8-a") void *rbdKooNFillWorker(void *arg)
+static FUNCTION_TARGET("arch=armv8-a") void *rbdKooNFillWorker(void *arg)
 {
     struct rbdKooNFillData *data;
     unsigned int time;
@@ -61,21 +124,21 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void *rbdKooNFillWorker(void *arg)
     /* Retrieve generic KooN RBD data */
     data = (struct rbdKooNFillData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
     /* Define vector (2d) with provided value */
     m128d = vdupq_n_f64(data->value);
 
     /* For each time instant (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Fill output Reliability array with fixed value */
         vst1q_f64(&data->output[time], m128d);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Fill output Reliability array with fixed value */
         data->output[time++] = data->value;
     }
@@ -106,7 +169,7 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void *rbdKooNFillWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdKooNGenericWorker(void *arg)
+static void *rbdKooNGenericWorker(void *arg)
 {
     struct rbdKooNGenericData *data;
     unsigned int time;
@@ -114,40 +177,40 @@ HIDDEN void *rbdKooNGenericWorker(void *arg)
     /* Retrieve generic KooN RBD data */
     data = (struct rbdKooNGenericData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
-    if (data->bRecursive == 0) {
+    if (data->bDynamic == 0) {
         /* If compute unreliability flag is not set... */
         if (data->bComputeUnreliability == 0) {
             /* For each time instant to be processed (blocks of 2 time instants)... */
-            while ((time + V2D) <= data->numTimes) {
+            while ((time + V2D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepV2dNeon(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V2D);
+                time += (data->batch.numBatches * V2D);
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepS1d(data, time);
             }
         }
         else {
             /* For each time instant to be processed (blocks of 2 time instants)... */
-            while ((time + V2D) <= data->numTimes) {
+            while ((time + V2D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepV2dNeon(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V2D);
+                time += (data->batch.numBatches * V2D);
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepS1d(data, time);
             }
@@ -155,25 +218,78 @@ HIDDEN void *rbdKooNGenericWorker(void *arg)
     }
     else {
         /* For each time instant to be processed (blocks of 2 time instants)... */
-        while ((time + V2D) <= data->numTimes) {
+        while ((time + V2D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV2dNeon(data, time);
+            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV2dNeon(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V2D);
+            time += (data->batch.numBatches * V2D);
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
+        if (time < data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepS1d(data, time);
         }
     }
 
     return NULL;
 }
 
+/**
+ * rbdKooNAllWorker
+ *
+ * All KooN RBDs Worker function with AArch64 NEON
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the all KooN RBDs Worker exploiting AArch64 NEON instruction set.
+ *  It is responsible to compute the reliabilities over a given batch of the KooN RBD systems
+ *  with K in [1, N] sharing the same components
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data. It is provided as a
+ *                      void * in order to be compliant with pthread_create API and to thus allow
+ *                      SMP computation of KooN RBD
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *rbdKooNAllWorker(void *arg)
+{
+    struct rbdKooNGenericData *data;
+    unsigned int time;
+
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+    /* Retrieve first time instant to be processed by worker */
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
+
+    /* For each time instant to be processed (blocks of 2 time instants)... */
+    while ((time + V2D) <= data->batch.tEnd) {
+        /* Prefetch for next iteration */
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV2dNeon(data, time);
+        /* Increment current time instant */
+        time += (data->batch.numBatches * V2D);
+    }
+    /* Is 1 time instant remaining? */
+    if (time < data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepS1d(data, time);
+    }
+
+    return NULL;
+}
+
 /**
  * rbdKooNIdenticalWorker
  *
@@ -198,7 +314,7 @@ HIDDEN void *rbdKooNGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdKooNIdenticalWorker(void *arg)
+static void *rbdKooNIdenticalWorker(void *arg)
 {
     struct rbdKooNIdenticalData *data;
     unsigned int time;
@@ -206,13 +322,13 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
     /* Retrieve generic KooN RBD data */
     data = (struct rbdKooNIdenticalData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* If compute unreliability flag is not set... */
     if (data->bComputeUnreliability == 0) {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNIdenticalSuccessStepS1d(data, time);
                 /* Increment current time instant */
@@ -220,17 +336,17 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
             }
         }
         /* For each time instant to be processed (blocks of 2 time instants)... */
-        while ((time + V2D) <= data->numTimes) {
+        while ((time + V2D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepV2dNeon(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V2D);
+            time += (data->batch.numBatches * V2D);
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepS1d(data, time);
         }
@@ -238,7 +354,7 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
     else {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNIdenticalFailStepS1d(data, time);
                 /* Increment current time instant */
@@ -246,17 +362,17 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
             }
         }
         /* For each time instant to be processed (blocks of 2 time instants)... */
-        while ((time + V2D) <= data->numTimes) {
+        while ((time + V2D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepV2dNeon(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V2D);
+            time += (data->batch.numBatches * V2D);
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepS1d(data, time);
         }
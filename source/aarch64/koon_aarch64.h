@@ -31,7 +31,8 @@
 /* Platform-specific functions for AArch64 NEON instruction set */
 void rbdKooNGenericSuccessStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNGenericFailStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNRecursionV2dNeon(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNDynamicStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNAllStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNIdenticalSuccessStepV2dNeon(struct rbdKooNIdenticalData *data, unsigned int time);
 void rbdKooNIdenticalFailStepV2dNeon(struct rbdKooNIdenticalData *data, unsigned int time);
 #endif /* defined(ARCH_AARCH64) && (CPU_ENABLE_SIMD != 0) */
@@ -27,9 +27,6 @@
 #include "../koon_aarch64.h"
 
 
-static FUNCTION_TARGET("arch=armv8-a") float64x2_t rbdKooNRecursiveStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k);
-
-
 /**
  * rbdKooNGenericSuccessStepV2dNeon
  *
@@ -45,7 +42,13 @@ static FUNCTION_TARGET("arch=armv8-a") float64x2_t rbdKooNRecursiveStepV2dNeon(s
  * Description:
  *  This function implements the generic KooN RBD function exploiting AArch64 NEON 128bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  taking into account the working components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -56,49 +59,89 @@ static FUNCTION_TARGET("arch=armv8-a") float64x2_t rbdKooNRecursiveStepV2dNeon(s
  */
 HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNGenericSuccessStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time)
 {
+    float64x2_t v2dR[data->numComponents];
+    float64x2_t v2dU[data->numComponents];
+    float64x2_t v2dG[data->numComponents];
+    float64x2_t v2dS[data->numComponents + 1];
     float64x2_t v2dStep;
-    float64x2_t v2dTmp;
     float64x2_t v2dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v2dS[data->numComponents] = v2dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v2dR[jj] = vld1q_f64(&data->reliabilities[(jj * data->numTimes) + time]);
+        v2dU[jj] = vsubq_f64(v2dOnes, v2dR[jj]);
+        /* Compute suffix product of unreliabilities of components */
+        v2dS[jj] = vmulq_f64(v2dS[jj + 1], v2dU[jj]);
+    }
 
     /* Initialize reliability of current time instant to 0 */
     v2dRes = v2dZeros;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v2dStep = v2dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v2dTmp = vld1q_f64(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step reliability for reliability of current component */
-                    v2dStep = vmulq_f64(v2dStep, v2dTmp);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step reliability for unreliability of current component */
-                    v2dStep = vfmsq_f64(v2dStep, v2dTmp, v2dStep);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for unreliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v2dStep = vmulq_f64(v2dStep, v2dU[component]);
                 }
+                v2dG[jj] = v2dStep;
+                v2dStep = vmulq_f64(v2dStep, v2dR[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial sum for computation of KooN reliability */
-            v2dRes = vaddq_f64(v2dRes, v2dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+            v2dRes = vfmaq_f64(v2dRes, v2dStep, v2dS[combination[comb->k - 1] + 1]);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now failed */
+                v2dG[pivot] = vmulq_f64(v2dG[pivot], v2dU[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for reliability of pivot component */
+                v2dStep = vmulq_f64(v2dG[pivot], v2dR[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v2dG[jj] = v2dStep;
+                    v2dStep = vmulq_f64(v2dStep, v2dR[combination[jj]]);
+                }
+
+                /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+                v2dRes = vfmaq_f64(v2dRes, v2dStep, v2dS[combination[comb->k - 1] + 1]);
+            }
         }
     }
 
@@ -121,7 +164,13 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNGenericSuccessStepV2dNeon(str
  * Description:
  *  This function implements the generic KooN RBD function exploiting AArch64 NEON 128bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the failed components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -132,49 +181,89 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNGenericSuccessStepV2dNeon(str
  */
 HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNGenericFailStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time)
 {
+    float64x2_t v2dR[data->numComponents];
+    float64x2_t v2dU[data->numComponents];
+    float64x2_t v2dG[data->numComponents];
+    float64x2_t v2dS[data->numComponents + 1];
     float64x2_t v2dStep;
-    float64x2_t v2dTmp;
     float64x2_t v2dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v2dS[data->numComponents] = v2dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v2dR[jj] = vld1q_f64(&data->reliabilities[(jj * data->numTimes) + time]);
+        v2dU[jj] = vsubq_f64(v2dOnes, v2dR[jj]);
+        /* Compute suffix product of reliabilities of components */
+        v2dS[jj] = vmulq_f64(v2dS[jj + 1], v2dR[jj]);
+    }
 
     /* Initialize reliability of current time instant to 1 */
     v2dRes = v2dOnes;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v2dStep = v2dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v2dTmp = vld1q_f64(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step unreliability for unreliability of current component */
-                    v2dStep = vfmsq_f64(v2dStep, v2dTmp, v2dStep);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step unreliability for reliability of current component */
-                    v2dStep = vmulq_f64(v2dStep, v2dTmp);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for reliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v2dStep = vmulq_f64(v2dStep, v2dR[component]);
                 }
+                v2dG[jj] = v2dStep;
+                v2dStep = vmulq_f64(v2dStep, v2dU[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial subtraction for computation of KooN reliability */
-            v2dRes = vsubq_f64(v2dRes, v2dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+            v2dRes = vfmsq_f64(v2dRes, v2dStep, v2dS[combination[comb->k - 1] + 1]);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now working */
+                v2dG[pivot] = vmulq_f64(v2dG[pivot], v2dR[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for unreliability of pivot component */
+                v2dStep = vmulq_f64(v2dG[pivot], v2dU[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v2dG[jj] = v2dStep;
+                    v2dStep = vmulq_f64(v2dStep, v2dU[combination[jj]]);
+                }
+
+                /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+                v2dRes = vfmsq_f64(v2dRes, v2dStep, v2dS[combination[comb->k - 1] + 1]);
+            }
         }
     }
 
@@ -183,9 +272,9 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNGenericFailStepV2dNeon(struct
 }
 
 /**
- * rbdKooNRecursionV2dNeon
+ * rbdKooNDynamicStepV2dNeon
  *
- * Compute KooN RBD though Recursive method with AArch64 NEON 128bit
+ * Compute KooN RBD through Dynamic Programming with AArch64 NEON 128bit
  *
  * Input:
  *      struct rbdKooNGenericData *data
@@ -195,8 +284,12 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNGenericFailStepV2dNeon(struct
  *      None
  *
  * Description:
- *  This function computes the reliability of KooN RBD system through recursion
- *  exploiting AArch64 NEON 128bit
+ *  This function computes the reliability of KooN RBD system through Dynamic Programming
+ *  exploiting AArch64 NEON 128bit.
+ *  It keeps a rolling array of the probabilities of having at least k working components, with
+ *  k in [0, K], among the first n components. Each component updates such probabilities, from
+ *  the highest k down to the lowest one, skipping the ones that do not contribute anymore to the
+ *  final result, thus requiring O(N*K) operations per time instant
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -205,32 +298,56 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNGenericFailStepV2dNeon(struct
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNRecursionV2dNeon(struct rbdKooNGenericData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNDynamicStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time)
 {
-    float64x2_t v2dRes;
+    float64x2_t v2dA[data->minComponents + 1];
+    float64x2_t v2dR;
+    unsigned char n;
+    unsigned char k;
+    unsigned char kMin;
+    unsigned char kMax;
+
+    /* Initialize probabilities of having at least k working components out of no components */
+    v2dA[0] = v2dOnes;
+    for (k = 1; k <= data->minComponents; ++k) {
+        v2dA[k] = v2dZeros;
+    }
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v2dR = vld1q_f64(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute range of probabilities affecting the one of at least K working components */
+        kMax = (n < data->minComponents) ? (n + 1) : data->minComponents;
+        kMin = ((data->minComponents + n) >= data->numComponents) ? ((data->minComponents + n + 1) - data->numComponents) : 1;
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = kMax; k >= kMin; --k) {
+            v2dA[k] = vfmaq_f64(v2dA[k], v2dR, vsubq_f64(v2dA[k - 1], v2dA[k]));
+        }
+    }
 
-    /* Recursively compute reliability of KooN RBD at current time instant */
-    v2dRes = rbdKooNRecursiveStepV2dNeon(data, time, data->numComponents, data->minComponents);
     /* Cap the computed reliability and set it into output array */
-    vst1q_f64(&data->output[time], capReliabilityV2dNeon(v2dRes));
+    vst1q_f64(&data->output[time], capReliabilityV2dNeon(v2dA[data->minComponents]));
 }
 
 /**
- * rbdKooNIdenticalSuccessStepV2dNeon
+ * rbdKooNAllStepV2dNeon
  *
- * Identical KooN RBD Step function from working components with AArch64 NEON 128bit
+ * Compute all KooN RBDs with K in [1, N] through Dynamic Programming with AArch64 NEON 128bit
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      struct rbdKooNGenericData *data
  *      unsigned int time
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the identical KooN RBD function exploiting AArch64 NEON 128bit.
- *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  This function computes the reliabilities of all KooN RBD systems with K in [1, N] sharing the
+ *  same components exploiting
+ *  AArch64 NEON 128bit. It keeps a rolling array of the probabilities of having at least k
+ *  working components among the first n components, which requires O(N^2) operations per time
+ *  instant. The reliability of the KooN RBD system with K=k is stored into row k-1 of output matrix
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -239,50 +356,39 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNRecursionV2dNeon(struct rbdKo
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNIdenticalSuccessStepV2dNeon(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNAllStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time)
 {
+    float64x2_t v2dA[data->numComponents + 1];
     float64x2_t v2dR;
-    float64x2_t v2dTmp1, v2dTmp2;
-    float64x2_t v2dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned char n;
+    unsigned char k;
 
-    /* Retrieve reliability */
-    v2dR = vld1q_f64(&data->reliabilities[time]);
-    /* Initialize reliability to 0 */
-    v2dRes = v2dZeros;
-    /* Compute product between reliability and unreliability */
-    v2dTmp2 = vfmsq_f64(v2dR, v2dR, v2dR);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v2dTmp1 = vdupq_n_f64((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->minComponents + ii;
-        numFail = data->numComponents - data->minComponents - ii;
-        /* For each failed component... */
-        for (jj = (numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for product of reliability and unreliability of component */
-            v2dTmp1 = vmulq_f64(v2dTmp1, v2dTmp2);
-        }
-        /* For each non-considered working component... */
-        for (jj = (numWork - numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for reliability of component */
-            v2dTmp1 = vmulq_f64(v2dTmp1, v2dR);
+    /* Initialize probability of having at least 0 working components out of no components */
+    v2dA[0] = v2dOnes;
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v2dR = vld1q_f64(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute probability of having all the first n+1 components working */
+        v2dA[n + 1] = vmulq_f64(v2dR, v2dA[n]);
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = n; k > 0; --k) {
+            v2dA[k] = vfmaq_f64(v2dA[k], v2dR, vsubq_f64(v2dA[k - 1], v2dA[k]));
         }
-        /* Add reliability of current iteration */
-        v2dRes = vaddq_f64(v2dRes, v2dTmp1);
     }
 
-    /* Cap the computed reliability and set it into output array */
-    vst1q_f64(&data->output[time], capReliabilityV2dNeon(v2dRes));
+    /* For each K in [1, N]... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Cap the computed reliability and set it into output matrix */
+        vst1q_f64(&data->output[(n * data->numTimes) + time], capReliabilityV2dNeon(v2dA[n + 1]));
+    }
 }
 
 /**
- * rbdKooNIdenticalFailStepV2dNeon
+ * rbdKooNIdenticalSuccessStepV2dNeon
  *
- * Identical KooN RBD Step function from failed components with AArch64 NEON 128bit
+ * Identical KooN RBD Step function from working components with AArch64 NEON 128bit
  *
  * Input:
  *      struct rbdKooNIdenticalData *data
@@ -294,7 +400,10 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNIdenticalSuccessStepV2dNeon(s
  * Description:
  *  This function implements the identical KooN RBD function exploiting AArch64 NEON 128bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the working components. The reliability is a polynomial of the reliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of unreliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -303,42 +412,38 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNIdenticalSuccessStepV2dNeon(s
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNIdenticalFailStepV2dNeon(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNIdenticalSuccessStepV2dNeon(struct rbdKooNIdenticalData *data, unsigned int time)
 {
+    float64x2_t v2dR;
     float64x2_t v2dU;
-    float64x2_t v2dTmp1, v2dTmp2;
+    float64x2_t v2dPow;
     float64x2_t v2dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned int exponent;
+    int ii;
 
     /* Retrieve reliability */
-    v2dTmp2 = vld1q_f64(&data->reliabilities[time]);
+    v2dR = vld1q_f64(&data->reliabilities[time]);
     /* Compute unreliability */
-    v2dU = vsubq_f64(v2dOnes, v2dTmp2);
-    /* Initialize reliability to 1 */
-    v2dRes = v2dOnes;
-    /* Compute product between reliability and unreliability */
-    v2dTmp2 = vmulq_f64(v2dTmp2, v2dU);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v2dTmp1 = vdupq_n_f64((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->numComponents - data->minComponents - ii;
-        numFail = data->minComponents + ii;
-        /* For each working component... */
-        for (jj = (numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for product of reliability and unreliability of component */
-            v2dTmp1 = vmulq_f64(v2dTmp1, v2dTmp2);
-        }
-        /* For each non-considered failed component... */
-        for (jj = (numFail - numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for unreliability of component */
-            v2dTmp1 = vmulq_f64(v2dTmp1, v2dU);
+    v2dU = vsubq_f64(v2dOnes, v2dR);
+
+    /* Initialize Horner accumulator to nCN, i.e. all components working */
+    v2dRes = vdupq_n_f64(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of unreliability to 1 */
+    v2dPow = v2dOnes;
+    /* For each number of working components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of unreliability of the other components */
+        v2dPow = vmulq_f64(v2dPow, v2dU);
+        /* Horner step: multiply accumulator for reliability and add nCi weighted by power of unreliability */
+        v2dRes = vfmaq_f64(vmulq_f64(vdupq_n_f64(data->nCi[ii]), v2dPow), v2dRes, v2dR);
+    }
+    /* Multiply accumulator for reliability of K working components through exponentiation by squaring */
+    v2dPow = v2dR;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v2dRes = vmulq_f64(v2dRes, v2dPow);
         }
-        /* Subtract unreliability of current iteration */
-        v2dRes = vsubq_f64(v2dRes, v2dTmp1);
+        v2dPow = vmulq_f64(v2dPow, v2dPow);
     }
 
     /* Cap the computed reliability and set it into output array */
@@ -346,51 +451,70 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNIdenticalFailStepV2dNeon(stru
 }
 
 /**
- * rbdKooNRecursiveStepV2dNeon
+ * rbdKooNIdenticalFailStepV2dNeon
  *
- * Recursive KooN RBD Step function with AArch64 NEON 128bit
+ * Identical KooN RBD Step function from failed components with AArch64 NEON 128bit
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      struct rbdKooNIdenticalData *data
  *      unsigned int time
- *      unsigned char n
- *      unsigned char k
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the recursive KooN RBD function exploiting AArch64 NEON 128bit.
- *  It is responsible to recursively compute the reliability of a KooN RBD system
+ *  This function implements the identical KooN RBD function exploiting AArch64 NEON 128bit.
+ *  It is responsible to compute the reliability of a KooN RBD system
+ *  taking into account the failed components. The unreliability is a polynomial of the unreliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of reliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
- *      n: current number of components in KooN RBD
- *      k: minimum number of working components in KooN RBD
  *
- * Return (float64x2_t):
- *  Computed reliability
+ * Return:
+ *  None
  */
-static FUNCTION_TARGET("arch=armv8-a") float64x2_t rbdKooNRecursiveStepV2dNeon(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k)
+HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdKooNIdenticalFailStepV2dNeon(struct rbdKooNIdenticalData *data, unsigned int time)
 {
-    float64x2_t v2dTmp1, v2dTmp2;
+    float64x2_t v2dR;
+    float64x2_t v2dU;
+    float64x2_t v2dPow;
     float64x2_t v2dRes;
+    unsigned int exponent;
+    int ii;
+
+    /* Retrieve reliability */
+    v2dR = vld1q_f64(&data->reliabilities[time]);
+    /* Compute unreliability */
+    v2dU = vsubq_f64(v2dOnes, v2dR);
 
-    /* Load reliabilities and compute unreliabilities */
-    --n;
-    v2dRes = vld1q_f64(&data->reliabilities[(n * data->numTimes) + time]);
-    v2dTmp1 = vsubq_f64(v2dOnes, v2dRes);
-    /* Recursively compute the reliabilities */
-    if ((k-1) > 0) {
-        v2dTmp2 = rbdKooNRecursiveStepV2dNeon(data, time, n, k-1);
-        v2dRes = vmulq_f64(v2dRes, v2dTmp2);
+    /* Initialize Horner accumulator to nCN, i.e. all components failed */
+    v2dRes = vdupq_n_f64(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of reliability to 1 */
+    v2dPow = v2dOnes;
+    /* For each number of failed components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of reliability of the other components */
+        v2dPow = vmulq_f64(v2dPow, v2dR);
+        /* Horner step: multiply accumulator for unreliability and add nCi weighted by power of reliability */
+        v2dRes = vfmaq_f64(vmulq_f64(vdupq_n_f64(data->nCi[ii]), v2dPow), v2dRes, v2dU);
     }
-    if (k <= n) {
-        v2dTmp2 = rbdKooNRecursiveStepV2dNeon(data, time, n, k);
-        v2dRes = vfmaq_f64(v2dRes, v2dTmp1, v2dTmp2);
+    /* Multiply accumulator for unreliability of K failed components through exponentiation by squaring */
+    v2dPow = v2dU;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v2dRes = vmulq_f64(v2dRes, v2dPow);
+        }
+        v2dPow = vmulq_f64(v2dPow, v2dPow);
     }
-    return v2dRes;
+    /* Compute reliability from unreliability */
+    v2dRes = vsubq_f64(v2dOnes, v2dRes);
+
+    /* Cap the computed reliability and set it into output array */
+    vst1q_f64(&data->output[time], capReliabilityV2dNeon(v2dRes));
 }
 
 
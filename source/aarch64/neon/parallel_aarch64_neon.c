@@ -82,7 +82,8 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdParallelGenericStepV2dNeon(struct
  * Description:
  *  This function implements the identical Parallel RBD step exploiting AArch64 NEON 128bit.
  *  It is responsible to compute the reliability of a Parallel block with identical components
- *  given their reliability
+ *  given their reliability. The power of the unreliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Parallel RBD data structure
@@ -90,7 +91,7 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdParallelGenericStepV2dNeon(struct
  */
 HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdParallelIdenticalStepV2dNeon(struct rbdParallelData *data, unsigned int time)
 {
-    unsigned char component;
+    unsigned char bit;
     float64x2_t v2dU;
     float64x2_t v2dRes;
 
@@ -98,10 +99,18 @@ HIDDEN FUNCTION_TARGET("arch=armv8-a") void rbdParallelIdenticalStepV2dNeon(stru
     v2dU = vld1q_f64(&data->reliabilities[time]);
     v2dU = vsubq_f64(v2dOnes, v2dU);
 
-    /* Compute reliability of Parallel RBD at current time instant */
+    /* Compute reliability of Parallel RBD at current time instant through exponentiation by squaring */
     v2dRes = v2dU;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        v2dRes = vmulq_f64(v2dRes, v2dU);
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        v2dRes = vmulq_f64(v2dRes, v2dRes);
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            v2dRes = vmulq_f64(v2dRes, v2dU);
+        }
     }
     v2dRes = vsubq_f64(v2dOnes, v2dRes);
 
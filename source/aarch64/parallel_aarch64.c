@@ -28,6 +28,51 @@
 #include "../parallel.h"
 
 
+static void *rbdParallelGenericWorker(void *arg);
+static void *rbdParallelIdenticalWorker(void *arg);
+
+
+/**
+ * rbdParallelResolveWorkers
+ *
+ * Resolve Parallel RBD Workers with AArch64 NEON
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the Parallel RBD Workers exploiting AArch64 NEON instruction set, unless
+ *  it is excluded by the requested instruction set family, in which case scalar Workers are selected.
+ *  It is invoked once at library load time, so that RBD computations directly invoke
+ *  the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdParallelResolveWorkers(void)
+{
+    /* Resolve generic Parallel RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        parallelWorkers.genericWorker = &rbdParallelGenericWorker;
+    }
+    else {
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerS1d;
+    }
+
+    /* Resolve identical Parallel RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorker;
+    }
+    else {
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerS1d;
+    }
+}
 
 /**
  * rbdParallelGenericWorker
@@ -52,7 +97,7 @@
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdParallelGenericWorker(void *arg)
+static void *rbdParallelGenericWorker(void *arg)
 {
     struct rbdParallelData *data;
     unsigned int time;
@@ -60,20 +105,20 @@ HIDDEN void *rbdParallelGenericWorker(void *arg)
     /* Retrieve Parallel RBD data */
     data = (struct rbdParallelData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepV2dNeon(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepS1d(data, time);
     }
@@ -104,7 +149,7 @@ HIDDEN void *rbdParallelGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdParallelIdenticalWorker(void *arg)
+static void *rbdParallelIdenticalWorker(void *arg)
 {
     struct rbdParallelData *data;
     unsigned int time;
@@ -112,11 +157,11 @@ HIDDEN void *rbdParallelIdenticalWorker(void *arg)
     /* Retrieve Parallel RBD data */
     data = (struct rbdParallelData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Parallel RBD at current time instant */
             rbdParallelIdenticalStepS1d(data, time);
             /* Increment current time instant */
@@ -124,17 +169,17 @@ HIDDEN void *rbdParallelIdenticalWorker(void *arg)
         }
     }
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepV2dNeon(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepS1d(data, time);
     }
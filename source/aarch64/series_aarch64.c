@@ -28,6 +28,52 @@
 #include "../series.h"
 
 
+static void *rbdSeriesGenericWorker(void *arg);
+static void *rbdSeriesIdenticalWorker(void *arg);
+
+
+/**
+ * rbdSeriesResolveWorkers
+ *
+ * Resolve Series RBD Workers with AArch64 NEON
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the Series RBD Workers exploiting AArch64 NEON instruction set, unless
+ *  it is excluded by the requested instruction set family, in which case scalar Workers are selected.
+ *  It is invoked once at library load time, so that RBD computations directly invoke
+ *  the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdSeriesResolveWorkers(void)
+{
+    /* Resolve generic Series RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorker;
+    }
+    else {
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorkerS1d;
+    }
+
+    /* Resolve identical Series RBD Worker */
+    if (isaEnabled(RBD_ISA_NEON)) {
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorker;
+    }
+    else {
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerS1d;
+    }
+}
+
 /**
  * rbdSeriesGenericWorker
  *
@@ -50,7 +96,7 @@
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdSeriesGenericWorker(void *arg)
+static void *rbdSeriesGenericWorker(void *arg)
 {
     struct rbdSeriesData *data;
     unsigned int time;
@@ -58,20 +104,20 @@ HIDDEN void *rbdSeriesGenericWorker(void *arg)
     /* Retrieve Series RBD data */
     data = (struct rbdSeriesData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepV2dNeon(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepS1d(data, time);
     }
@@ -101,7 +147,7 @@ HIDDEN void *rbdSeriesGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
+static void *rbdSeriesIdenticalWorker(void *arg)
 {
     struct rbdSeriesData *data;
     unsigned int time;
@@ -109,11 +155,11 @@ HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
     /* Retrieve Series RBD data */
     data = (struct rbdSeriesData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Series RBD at current time instant */
             rbdSeriesIdenticalStepS1d(data, time);
             /* Increment current time instant */
@@ -121,17 +167,17 @@ HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
         }
     }
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepV2dNeon(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepS1d(data, time);
     }
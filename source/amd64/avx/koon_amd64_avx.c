@@ -27,9 +27,6 @@
 #include "../koon_amd64.h"
 
 
-static FUNCTION_TARGET("avx") __m256d rbdKooNRecursiveStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k);
-
-
 /**
  * rbdKooNGenericSuccessStepV4dAvx
  *
@@ -45,7 +42,13 @@ static FUNCTION_TARGET("avx") __m256d rbdKooNRecursiveStepV4dAvx(struct rbdKooNG
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 AVX 256bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  taking into account the working components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -56,50 +59,89 @@ static FUNCTION_TARGET("avx") __m256d rbdKooNRecursiveStepV4dAvx(struct rbdKooNG
  */
 HIDDEN FUNCTION_TARGET("avx") void rbdKooNGenericSuccessStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m256d v4dR[data->numComponents];
+    __m256d v4dU[data->numComponents];
+    __m256d v4dG[data->numComponents];
+    __m256d v4dS[data->numComponents + 1];
     __m256d v4dStep;
-    __m256d v4dTmp;
     __m256d v4dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v4dS[data->numComponents] = v4dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v4dR[jj] = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
+        v4dU[jj] = _mm256_sub_pd(v4dOnes, v4dR[jj]);
+        /* Compute suffix product of unreliabilities of components */
+        v4dS[jj] = _mm256_mul_pd(v4dS[jj + 1], v4dU[jj]);
+    }
 
     /* Initialize reliability of current time instant to 0 */
     v4dRes = v4dZeros;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v4dStep = v4dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v4dTmp = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step reliability for reliability of current component */
-                    v4dStep = _mm256_mul_pd(v4dStep, v4dTmp);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step reliability for unreliability of current component */
-                    v4dTmp = _mm256_sub_pd(v4dOnes, v4dTmp);
-                    v4dStep = _mm256_mul_pd(v4dTmp, v4dStep);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for unreliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dU[component]);
                 }
+                v4dG[jj] = v4dStep;
+                v4dStep = _mm256_mul_pd(v4dStep, v4dR[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial sum for computation of KooN reliability */
-            v4dRes = _mm256_add_pd(v4dRes, v4dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+            v4dRes = _mm256_add_pd(v4dRes, _mm256_mul_pd(v4dStep, v4dS[combination[comb->k - 1] + 1]));
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now failed */
+                v4dG[pivot] = _mm256_mul_pd(v4dG[pivot], v4dU[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for reliability of pivot component */
+                v4dStep = _mm256_mul_pd(v4dG[pivot], v4dR[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v4dG[jj] = v4dStep;
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dR[combination[jj]]);
+                }
+
+                /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+                v4dRes = _mm256_add_pd(v4dRes, _mm256_mul_pd(v4dStep, v4dS[combination[comb->k - 1] + 1]));
+            }
         }
     }
 
@@ -122,7 +164,13 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNGenericSuccessStepV4dAvx(struct rbdKoo
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 AVX 256bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the failed components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -133,50 +181,89 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNGenericSuccessStepV4dAvx(struct rbdKoo
  */
 HIDDEN FUNCTION_TARGET("avx") void rbdKooNGenericFailStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m256d v4dR[data->numComponents];
+    __m256d v4dU[data->numComponents];
+    __m256d v4dG[data->numComponents];
+    __m256d v4dS[data->numComponents + 1];
     __m256d v4dStep;
-    __m256d v4dTmp;
     __m256d v4dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v4dS[data->numComponents] = v4dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v4dR[jj] = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
+        v4dU[jj] = _mm256_sub_pd(v4dOnes, v4dR[jj]);
+        /* Compute suffix product of reliabilities of components */
+        v4dS[jj] = _mm256_mul_pd(v4dS[jj + 1], v4dR[jj]);
+    }
 
     /* Initialize reliability of current time instant to 1 */
     v4dRes = v4dOnes;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v4dStep = v4dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v4dTmp = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step unreliability for unreliability of current component */
-                    v4dTmp = _mm256_sub_pd(v4dOnes, v4dTmp);
-                    v4dStep = _mm256_mul_pd(v4dTmp, v4dStep);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step unreliability for reliability of current component */
-                    v4dStep = _mm256_mul_pd(v4dStep, v4dTmp);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for reliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dR[component]);
                 }
+                v4dG[jj] = v4dStep;
+                v4dStep = _mm256_mul_pd(v4dStep, v4dU[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial subtraction for computation of KooN reliability */
-            v4dRes = _mm256_sub_pd(v4dRes, v4dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+            v4dRes = _mm256_sub_pd(v4dRes, _mm256_mul_pd(v4dStep, v4dS[combination[comb->k - 1] + 1]));
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now working */
+                v4dG[pivot] = _mm256_mul_pd(v4dG[pivot], v4dR[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for unreliability of pivot component */
+                v4dStep = _mm256_mul_pd(v4dG[pivot], v4dU[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v4dG[jj] = v4dStep;
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dU[combination[jj]]);
+                }
+
+                /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+                v4dRes = _mm256_sub_pd(v4dRes, _mm256_mul_pd(v4dStep, v4dS[combination[comb->k - 1] + 1]));
+            }
         }
     }
 
@@ -185,9 +272,9 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNGenericFailStepV4dAvx(struct rbdKooNGe
 }
 
 /**
- * rbdKooNRecursionV4dAvx
+ * rbdKooNDynamicStepV4dAvx
  *
- * Compute KooN RBD though Recursive method with amd64 AVX 256bit
+ * Compute KooN RBD through Dynamic Programming with amd64 AVX 256bit
  *
  * Input:
  *      struct rbdKooNGenericData *data
@@ -197,8 +284,12 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNGenericFailStepV4dAvx(struct rbdKooNGe
  *      None
  *
  * Description:
- *  This function computes the reliability of KooN RBD system through recursion
- *  exploiting amd64 AVX 256bit
+ *  This function computes the reliability of KooN RBD system through Dynamic Programming
+ *  exploiting amd64 AVX 256bit.
+ *  It keeps a rolling array of the probabilities of having at least k working components, with
+ *  k in [0, K], among the first n components. Each component updates such probabilities, from
+ *  the highest k down to the lowest one, skipping the ones that do not contribute anymore to the
+ *  final result, thus requiring O(N*K) operations per time instant
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -207,32 +298,56 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNGenericFailStepV4dAvx(struct rbdKooNGe
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx") void rbdKooNRecursionV4dAvx(struct rbdKooNGenericData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx") void rbdKooNDynamicStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time)
 {
-    __m256d v4dRes;
+    __m256d v4dA[data->minComponents + 1];
+    __m256d v4dR;
+    unsigned char n;
+    unsigned char k;
+    unsigned char kMin;
+    unsigned char kMax;
+
+    /* Initialize probabilities of having at least k working components out of no components */
+    v4dA[0] = v4dOnes;
+    for (k = 1; k <= data->minComponents; ++k) {
+        v4dA[k] = v4dZeros;
+    }
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v4dR = _mm256_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute range of probabilities affecting the one of at least K working components */
+        kMax = (n < data->minComponents) ? (n + 1) : data->minComponents;
+        kMin = ((data->minComponents + n) >= data->numComponents) ? ((data->minComponents + n + 1) - data->numComponents) : 1;
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = kMax; k >= kMin; --k) {
+            v4dA[k] = _mm256_add_pd(v4dA[k], _mm256_mul_pd(v4dR, _mm256_sub_pd(v4dA[k - 1], v4dA[k])));
+        }
+    }
 
-    /* Recursively compute reliability of KooN RBD at current time instant */
-    v4dRes = rbdKooNRecursiveStepV4dAvx(data, time, data->numComponents, data->minComponents);
     /* Cap the computed reliability and set it into output array */
-    _mm256_storeu_pd(&data->output[time], capReliabilityV4dAvx(v4dRes));
+    _mm256_storeu_pd(&data->output[time], capReliabilityV4dAvx(v4dA[data->minComponents]));
 }
 
 /**
- * rbdKooNIdenticalSuccessStepV4dAvx
+ * rbdKooNAllStepV4dAvx
  *
- * Identical KooN RBD Step function from working components with amd64 AVX 256bit
+ * Compute all KooN RBDs with K in [1, N] through Dynamic Programming with amd64 AVX 256bit
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      struct rbdKooNGenericData *data
  *      unsigned int time
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the identical KooN RBD function exploiting amd64 AVX 256bit.
- *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  This function computes the reliabilities of all KooN RBD systems with K in [1, N] sharing the
+ *  same components exploiting
+ *  amd64 AVX 256bit. It keeps a rolling array of the probabilities of having at least k
+ *  working components among the first n components, which requires O(N^2) operations per time
+ *  instant. The reliability of the KooN RBD system with K=k is stored into row k-1 of output matrix
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -241,51 +356,39 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNRecursionV4dAvx(struct rbdKooNGenericD
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx") void rbdKooNIdenticalSuccessStepV4dAvx(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx") void rbdKooNAllStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m256d v4dA[data->numComponents + 1];
     __m256d v4dR;
-    __m256d v4dTmp1, v4dTmp2;
-    __m256d v4dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned char n;
+    unsigned char k;
 
-    /* Retrieve reliability */
-    v4dR = _mm256_loadu_pd(&data->reliabilities[time]);
-    /* Initialize reliability to 0 */
-    v4dRes = v4dZeros;
-    /* Compute product between reliability and unreliability */
-    v4dTmp2 = _mm256_sub_pd(v4dOnes, v4dR);
-    v4dTmp2 = _mm256_mul_pd(v4dR, v4dTmp2);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v4dTmp1 = _mm256_set1_pd((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->minComponents + ii;
-        numFail = data->numComponents - data->minComponents - ii;
-        /* For each failed component... */
-        for (jj = (numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for product of reliability and unreliability of component */
-            v4dTmp1 = _mm256_mul_pd(v4dTmp1, v4dTmp2);
-        }
-        /* For each non-considered working component... */
-        for (jj = (numWork - numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for reliability of component */
-            v4dTmp1 = _mm256_mul_pd(v4dTmp1, v4dR);
+    /* Initialize probability of having at least 0 working components out of no components */
+    v4dA[0] = v4dOnes;
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v4dR = _mm256_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute probability of having all the first n+1 components working */
+        v4dA[n + 1] = _mm256_mul_pd(v4dR, v4dA[n]);
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = n; k > 0; --k) {
+            v4dA[k] = _mm256_add_pd(v4dA[k], _mm256_mul_pd(v4dR, _mm256_sub_pd(v4dA[k - 1], v4dA[k])));
         }
-        /* Add reliability of current iteration */
-        v4dRes = _mm256_add_pd(v4dRes, v4dTmp1);
     }
 
-    /* Cap the computed reliability and set it into output array */
-    _mm256_storeu_pd(&data->output[time], capReliabilityV4dAvx(v4dRes));
+    /* For each K in [1, N]... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Cap the computed reliability and set it into output matrix */
+        _mm256_storeu_pd(&data->output[(n * data->numTimes) + time], capReliabilityV4dAvx(v4dA[n + 1]));
+    }
 }
 
 /**
- * rbdKooNIdenticalFailStepV4dAvx
+ * rbdKooNIdenticalSuccessStepV4dAvx
  *
- * Identical KooN RBD Step function from failed components with amd64 AVX 256bit
+ * Identical KooN RBD Step function from working components with amd64 AVX 256bit
  *
  * Input:
  *      struct rbdKooNIdenticalData *data
@@ -297,7 +400,10 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNIdenticalSuccessStepV4dAvx(struct rbdK
  * Description:
  *  This function implements the identical KooN RBD function exploiting amd64 AVX 256bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the working components. The reliability is a polynomial of the reliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of unreliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -306,42 +412,38 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNIdenticalSuccessStepV4dAvx(struct rbdK
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx") void rbdKooNIdenticalFailStepV4dAvx(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx") void rbdKooNIdenticalSuccessStepV4dAvx(struct rbdKooNIdenticalData *data, unsigned int time)
 {
+    __m256d v4dR;
     __m256d v4dU;
-    __m256d v4dTmp1, v4dTmp2;
+    __m256d v4dPow;
     __m256d v4dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned int exponent;
+    int ii;
 
     /* Retrieve reliability */
-    v4dTmp2 = _mm256_loadu_pd(&data->reliabilities[time]);
+    v4dR = _mm256_loadu_pd(&data->reliabilities[time]);
     /* Compute unreliability */
-    v4dU = _mm256_sub_pd(v4dOnes, v4dTmp2);
-    /* Initialize reliability to 1 */
-    v4dRes = v4dOnes;
-    /* Compute product between reliability and unreliability */
-    v4dTmp2 = _mm256_mul_pd(v4dTmp2, v4dU);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v4dTmp1 = _mm256_set1_pd((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->numComponents - data->minComponents - ii;
-        numFail = data->minComponents + ii;
-        /* For each working component... */
-        for (jj = (numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for product of reliability and unreliability of component */
-            v4dTmp1 = _mm256_mul_pd(v4dTmp1, v4dTmp2);
-        }
-        /* For each non-considered failed component... */
-        for (jj = (numFail - numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for unreliability of component */
-            v4dTmp1 = _mm256_mul_pd(v4dTmp1, v4dU);
+    v4dU = _mm256_sub_pd(v4dOnes, v4dR);
+
+    /* Initialize Horner accumulator to nCN, i.e. all components working */
+    v4dRes = _mm256_set1_pd(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of unreliability to 1 */
+    v4dPow = v4dOnes;
+    /* For each number of working components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of unreliability of the other components */
+        v4dPow = _mm256_mul_pd(v4dPow, v4dU);
+        /* Horner step: multiply accumulator for reliability and add nCi weighted by power of unreliability */
+        v4dRes = _mm256_add_pd(_mm256_mul_pd(v4dRes, v4dR), _mm256_mul_pd(_mm256_set1_pd(data->nCi[ii]), v4dPow));
+    }
+    /* Multiply accumulator for reliability of K working components through exponentiation by squaring */
+    v4dPow = v4dR;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v4dRes = _mm256_mul_pd(v4dRes, v4dPow);
         }
-        /* Subtract unreliability of current iteration */
-        v4dRes = _mm256_sub_pd(v4dRes, v4dTmp1);
+        v4dPow = _mm256_mul_pd(v4dPow, v4dPow);
     }
 
     /* Cap the computed reliability and set it into output array */
@@ -349,52 +451,70 @@ HIDDEN FUNCTION_TARGET("avx") void rbdKooNIdenticalFailStepV4dAvx(struct rbdKooN
 }
 
 /**
- * rbdKooNRecursiveStepV4dAvx
+ * rbdKooNIdenticalFailStepV4dAvx
  *
- * Recursive KooN RBD Step function with amd64 AVX 256bit
+ * Identical KooN RBD Step function from failed components with amd64 AVX 256bit
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      struct rbdKooNIdenticalData *data
  *      unsigned int time
- *      unsigned char n
- *      unsigned char k
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the recursive KooN RBD function exploiting amd64 AVX 256bit.
- *  It is responsible to recursively compute the reliability of a KooN RBD system
+ *  This function implements the identical KooN RBD function exploiting amd64 AVX 256bit.
+ *  It is responsible to compute the reliability of a KooN RBD system
+ *  taking into account the failed components. The unreliability is a polynomial of the unreliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of reliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
- *      n: current number of components in KooN RBD
- *      k: minimum number of working components in KooN RBD
  *
- * Return (__m256d):
- *  Computed reliability
+ * Return:
+ *  None
  */
-static FUNCTION_TARGET("avx") __m256d rbdKooNRecursiveStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k)
+HIDDEN FUNCTION_TARGET("avx") void rbdKooNIdenticalFailStepV4dAvx(struct rbdKooNIdenticalData *data, unsigned int time)
 {
-    __m256d v4dTmp1, v4dTmp2;
+    __m256d v4dR;
+    __m256d v4dU;
+    __m256d v4dPow;
     __m256d v4dRes;
+    unsigned int exponent;
+    int ii;
+
+    /* Retrieve reliability */
+    v4dR = _mm256_loadu_pd(&data->reliabilities[time]);
+    /* Compute unreliability */
+    v4dU = _mm256_sub_pd(v4dOnes, v4dR);
 
-    /* Load reliabilities and compute unreliabilities */
-    --n;
-    v4dRes = _mm256_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
-    v4dTmp1 = _mm256_sub_pd(v4dOnes, v4dRes);
-    /* Recursively compute the reliabilities */
-    if ((k-1) > 0) {
-        v4dTmp2 = rbdKooNRecursiveStepV4dAvx(data, time, n, k-1);
-        v4dRes = _mm256_mul_pd(v4dRes, v4dTmp2);
+    /* Initialize Horner accumulator to nCN, i.e. all components failed */
+    v4dRes = _mm256_set1_pd(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of reliability to 1 */
+    v4dPow = v4dOnes;
+    /* For each number of failed components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of reliability of the other components */
+        v4dPow = _mm256_mul_pd(v4dPow, v4dR);
+        /* Horner step: multiply accumulator for unreliability and add nCi weighted by power of reliability */
+        v4dRes = _mm256_add_pd(_mm256_mul_pd(v4dRes, v4dU), _mm256_mul_pd(_mm256_set1_pd(data->nCi[ii]), v4dPow));
     }
-    if (k <= n) {
-        v4dTmp2 = rbdKooNRecursiveStepV4dAvx(data, time, n, k);
-        v4dTmp1 = _mm256_mul_pd(v4dTmp1, v4dTmp2);
-        v4dRes = _mm256_add_pd(v4dRes, v4dTmp1);
+    /* Multiply accumulator for unreliability of K failed components through exponentiation by squaring */
+    v4dPow = v4dU;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v4dRes = _mm256_mul_pd(v4dRes, v4dPow);
+        }
+        v4dPow = _mm256_mul_pd(v4dPow, v4dPow);
     }
-    return v4dRes;
+    /* Compute reliability from unreliability */
+    v4dRes = _mm256_sub_pd(v4dOnes, v4dRes);
+
+    /* Cap the computed reliability and set it into output array */
+    _mm256_storeu_pd(&data->output[time], capReliabilityV4dAvx(v4dRes));
 }
 
 
@@ -83,7 +83,8 @@ HIDDEN FUNCTION_TARGET("avx") void rbdParallelGenericStepV4dAvx(struct rbdParall
  * Description:
  *  This function implements the identical Parallel RBD step exploiting amd64 AVX 256bit.
  *  It is responsible to compute the reliability of a Parallel block with identical components
- *  given their reliability
+ *  given their reliability. The power of the unreliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Parallel RBD data structure
@@ -91,7 +92,7 @@ HIDDEN FUNCTION_TARGET("avx") void rbdParallelGenericStepV4dAvx(struct rbdParall
  */
 HIDDEN FUNCTION_TARGET("avx") void rbdParallelIdenticalStepV4dAvx(struct rbdParallelData *data, unsigned int time)
 {
-    unsigned char component;
+    unsigned char bit;
     __m256d v4dU;
     __m256d v4dRes;
 
@@ -99,10 +100,18 @@ HIDDEN FUNCTION_TARGET("avx") void rbdParallelIdenticalStepV4dAvx(struct rbdPara
     v4dU = _mm256_loadu_pd(&data->reliabilities[time]);
     v4dU = _mm256_sub_pd(v4dOnes, v4dU);
 
-    /* Compute reliability of Parallel RBD at current time instant */
+    /* Compute reliability of Parallel RBD at current time instant through exponentiation by squaring */
     v4dRes = v4dU;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        v4dRes = _mm256_mul_pd(v4dRes, v4dU);
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        v4dRes = _mm256_mul_pd(v4dRes, v4dRes);
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            v4dRes = _mm256_mul_pd(v4dRes, v4dU);
+        }
     }
     v4dRes = _mm256_sub_pd(v4dOnes, v4dRes);
 
@@ -80,7 +80,8 @@ HIDDEN FUNCTION_TARGET("avx") void rbdSeriesGenericStepV4dAvx(struct rbdSeriesDa
  * Description:
  *  This function implements the identical Series RBD step exploiting amd64 AVX 256bit.
  *  It is responsible to compute the reliability of a Series block with identical components
- *  given their reliability
+ *  given their reliability. The power of the reliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Series RBD data structure
@@ -88,17 +89,25 @@ HIDDEN FUNCTION_TARGET("avx") void rbdSeriesGenericStepV4dAvx(struct rbdSeriesDa
  */
 HIDDEN FUNCTION_TARGET("avx") void rbdSeriesIdenticalStepV4dAvx(struct rbdSeriesData *data, unsigned int time)
 {
-    unsigned char component;
+    unsigned char bit;
     __m256d v4dTmp;
     __m256d v4dRes;
 
     /* Load reliability */
     v4dTmp = _mm256_loadu_pd(&data->reliabilities[time]);
 
-    /* Compute reliability of Series RBD at current time instant */
+    /* Compute reliability of Series RBD at current time instant through exponentiation by squaring */
     v4dRes = v4dTmp;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        v4dRes = _mm256_mul_pd(v4dRes, v4dTmp);
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        v4dRes = _mm256_mul_pd(v4dRes, v4dRes);
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            v4dRes = _mm256_mul_pd(v4dRes, v4dTmp);
+        }
     }
 
     /* Cap the computed reliability and set it into output array */
@@ -35,6 +35,7 @@
  * Input:
  *      struct rbdBridgeData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -47,19 +48,20 @@
  * Parameters:
  *      data: Bridge RBD data structure
  *      time: current time instant over which Bridge RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeGenericStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeGenericStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time, __mmask8 mask)
 {
     __m512d v8dR1, v8dR2, v8dR3, v8dR4, v8dR5;
     __m512d v8dTmp1, v8dTmp2;
     __m512d v8dRes;
 
     /* Load reliabilities */
-    v8dR1 = _mm512_loadu_pd(&data->reliabilities[(0 * data->numTimes) + time]);
-    v8dR2 = _mm512_loadu_pd(&data->reliabilities[(1 * data->numTimes) + time]);
-    v8dR3 = _mm512_loadu_pd(&data->reliabilities[(2 * data->numTimes) + time]);
-    v8dR4 = _mm512_loadu_pd(&data->reliabilities[(3 * data->numTimes) + time]);
-    v8dR5 = _mm512_loadu_pd(&data->reliabilities[(4 * data->numTimes) + time]);
+    v8dR1 = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(0 * data->numTimes) + time]);
+    v8dR2 = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(1 * data->numTimes) + time]);
+    v8dR3 = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(2 * data->numTimes) + time]);
+    v8dR4 = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(3 * data->numTimes) + time]);
+    v8dR5 = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(4 * data->numTimes) + time]);
 
     /**
      * Formula:
@@ -87,7 +89,7 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeGenericStepV8dAvx512f(struct rbd
     v8dRes = _mm512_fmadd_pd(v8dR5, v8dRes, v8dTmp1);
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 /**
@@ -98,6 +100,7 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeGenericStepV8dAvx512f(struct rbd
  * Input:
  *      struct rbdBridgeData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -110,15 +113,16 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeGenericStepV8dAvx512f(struct rbd
  * Parameters:
  *      data: Bridge RBD data structure
  *      time: current time instant over which Bridge RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeIdenticalStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeIdenticalStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time, __mmask8 mask)
 {
     __m512d v8dR, v8dU;
     __m512d v8dTmp;
     __m512d v8dRes;
 
     /* Load reliability */
-    v8dR = _mm512_loadu_pd(&data->reliabilities[time]);
+    v8dR = _mm512_maskz_loadu_pd(mask, &data->reliabilities[time]);
 
     /* Compute unreliability */
     v8dU = _mm512_sub_pd(v8dOnes, v8dR);
@@ -134,7 +138,7 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdBridgeIdenticalStepV8dAvx512f(struct r
     v8dRes = _mm512_mul_pd(v8dTmp, v8dR);
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 
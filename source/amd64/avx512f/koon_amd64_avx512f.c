@@ -27,9 +27,6 @@
 #include "../koon_amd64.h"
 
 
-static FUNCTION_TARGET("avx512f") __m512d rbdKooNRecursiveStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k);
-
-
 /**
  * rbdKooNGenericSuccessStepV8dAvx512f
  *
@@ -38,6 +35,7 @@ static FUNCTION_TARGET("avx512f") __m512d rbdKooNRecursiveStepV8dAvx512f(struct
  * Input:
  *      struct rbdKooNGenericData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -45,65 +43,112 @@ static FUNCTION_TARGET("avx512f") __m512d rbdKooNRecursiveStepV8dAvx512f(struct
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 AVX512F 512bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  taking into account the working components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  *
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNGenericSuccessStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNGenericSuccessStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask)
 {
+    __m512d v8dR[data->numComponents];
+    __m512d v8dU[data->numComponents];
+    __m512d v8dG[data->numComponents];
+    __m512d v8dS[data->numComponents + 1];
     __m512d v8dStep;
-    __m512d v8dTmp;
     __m512d v8dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v8dS[data->numComponents] = v8dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v8dR[jj] = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(jj * data->numTimes) + time]);
+        v8dU[jj] = _mm512_sub_pd(v8dOnes, v8dR[jj]);
+        /* Compute suffix product of unreliabilities of components */
+        v8dS[jj] = _mm512_mul_pd(v8dS[jj + 1], v8dU[jj]);
+    }
 
     /* Initialize reliability of current time instant to 0 */
     v8dRes = v8dZeros;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v8dStep = v8dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v8dTmp = _mm512_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step reliability for reliability of current component */
-                    v8dStep = _mm512_mul_pd(v8dStep, v8dTmp);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step reliability for unreliability of current component */
-                    v8dStep = _mm512_fnmadd_pd(v8dTmp, v8dStep, v8dStep);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for unreliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v8dStep = _mm512_mul_pd(v8dStep, v8dU[component]);
                 }
+                v8dG[jj] = v8dStep;
+                v8dStep = _mm512_mul_pd(v8dStep, v8dR[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial sum for computation of KooN reliability */
-            v8dRes = _mm512_add_pd(v8dRes, v8dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+            v8dRes = _mm512_fmadd_pd(v8dStep, v8dS[combination[comb->k - 1] + 1], v8dRes);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now failed */
+                v8dG[pivot] = _mm512_mul_pd(v8dG[pivot], v8dU[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for reliability of pivot component */
+                v8dStep = _mm512_mul_pd(v8dG[pivot], v8dR[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v8dG[jj] = v8dStep;
+                    v8dStep = _mm512_mul_pd(v8dStep, v8dR[combination[jj]]);
+                }
+
+                /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+                v8dRes = _mm512_fmadd_pd(v8dStep, v8dS[combination[comb->k - 1] + 1], v8dRes);
+            }
         }
     }
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 /**
@@ -114,6 +159,7 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNGenericSuccessStepV8dAvx512f(struc
  * Input:
  *      struct rbdKooNGenericData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -121,172 +167,474 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNGenericSuccessStepV8dAvx512f(struc
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 AVX512F 512bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the failed components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  *
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNGenericFailStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNGenericFailStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask)
 {
+    __m512d v8dR[data->numComponents];
+    __m512d v8dU[data->numComponents];
+    __m512d v8dG[data->numComponents];
+    __m512d v8dS[data->numComponents + 1];
     __m512d v8dStep;
-    __m512d v8dTmp;
     __m512d v8dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v8dS[data->numComponents] = v8dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v8dR[jj] = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(jj * data->numTimes) + time]);
+        v8dU[jj] = _mm512_sub_pd(v8dOnes, v8dR[jj]);
+        /* Compute suffix product of reliabilities of components */
+        v8dS[jj] = _mm512_mul_pd(v8dS[jj + 1], v8dR[jj]);
+    }
 
     /* Initialize reliability of current time instant to 1 */
     v8dRes = v8dOnes;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v8dStep = v8dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v8dTmp = _mm512_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step unreliability for unreliability of current component */
-                    v8dStep = _mm512_fnmadd_pd(v8dTmp, v8dStep, v8dStep);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for reliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v8dStep = _mm512_mul_pd(v8dStep, v8dR[component]);
+                }
+                v8dG[jj] = v8dStep;
+                v8dStep = _mm512_mul_pd(v8dStep, v8dU[combination[jj]]);
+                ++component;
+            }
+
+            /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+            v8dRes = _mm512_fnmadd_pd(v8dStep, v8dS[combination[comb->k - 1] + 1], v8dRes);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now working */
+                v8dG[pivot] = _mm512_mul_pd(v8dG[pivot], v8dR[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for unreliability of pivot component */
+                v8dStep = _mm512_mul_pd(v8dG[pivot], v8dU[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v8dG[jj] = v8dStep;
+                    v8dStep = _mm512_mul_pd(v8dStep, v8dU[combination[jj]]);
+                }
+
+                /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+                v8dRes = _mm512_fnmadd_pd(v8dStep, v8dS[combination[comb->k - 1] + 1], v8dRes);
+            }
+        }
+    }
+
+    /* Cap the computed reliability and set it into output array */
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
+}
+
+/**
+ * koonLanesProductV8dAvx512f
+ *
+ * Compute products of 8 combinations with amd64 AVX512F 512bit
+ *
+ * Input:
+ *      const __m512d *v8dLo
+ *      const __m512d *v8dHi
+ *      __m512i v8lMasks
+ *      int numNibbles
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes, for each lane, the product over all components of their reliability
+ *  or unreliability, depending on the combination stored as bitmask into the lane.
+ *  Components are grouped by 4 (nibbles of bitmask), each group having a 16 entries table of
+ *  the products of all its possible combinations, split into a low and a high vector:
+ *  the product of each group is retrieved through a single permutation indexed by the nibble.
+ *  Even and odd groups are multiplied over two independent chains to hide the latency
+ *  of multiplications
+ *
+ * Parameters:
+ *      v8dLo: tables of products of groups of components, entries from 0 to 7
+ *      v8dHi: tables of products of groups of components, entries from 8 to 15
+ *      v8lMasks: bitmasks of 8 combinations
+ *      numNibbles: number of groups of 4 components
+ *
+ * Return (__m512d):
+ *  The products of the 8 combinations
+ */
+static inline ALWAYS_INLINE FUNCTION_TARGET("avx512f") __m512d koonLanesProductV8dAvx512f(const __m512d *v8dLo, const __m512d *v8dHi, __m512i v8lMasks, int numNibbles)
+{
+    __m512d v8dEven;
+    __m512d v8dOdd;
+    int jj;
+
+    /* Retrieve products of first group, permutation only uses the lowest 4 bits of each index */
+    v8dEven = _mm512_permutex2var_pd(v8dLo[0], v8lMasks, v8dHi[0]);
+    v8dOdd = v8dOnes;
+    /* For each following pair of groups... */
+    for (jj = 1; jj < (numNibbles - 1); jj += 2) {
+        v8dOdd = _mm512_mul_pd(v8dOdd, _mm512_permutex2var_pd(v8dLo[jj], _mm512_srli_epi64(v8lMasks, 4 * jj), v8dHi[jj]));
+        v8dEven = _mm512_mul_pd(v8dEven, _mm512_permutex2var_pd(v8dLo[jj + 1], _mm512_srli_epi64(v8lMasks, 4 * (jj + 1)), v8dHi[jj + 1]));
+    }
+    /* Is last group remaining? */
+    if (jj < numNibbles) {
+        v8dOdd = _mm512_mul_pd(v8dOdd, _mm512_permutex2var_pd(v8dLo[jj], _mm512_srli_epi64(v8lMasks, 4 * jj), v8dHi[jj]));
+    }
+
+    return _mm512_mul_pd(v8dEven, v8dOdd);
+}
+
+/**
+ * rbdKooNGenericLanesStepV8dAvx512f
+ *
+ * Generic KooN RBD Step function over combinations with amd64 AVX512F 512bit
+ *
+ * Input:
+ *      struct rbdKooNGenericData *data
+ *      unsigned int time
+ *      __mmask8 mask
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the generic KooN RBD function exploiting amd64 AVX512F 512bit.
+ *  It is responsible to compute the reliability of a KooN RBD system at (at most) 8 time instants,
+ *  taking into account the working components or the failed ones depending on the compute
+ *  unreliability flag. Differently from the other Step functions, the vector lanes are
+ *  filled with different combinations rather than with different time instants, hence it
+ *  is meant for the few time instants that would leave most lanes of a vector idle.
+ *  Each combination is tracked as a bitmask of its elements, updated from the previous
+ *  one through its pivot, so that the bitmasks are shared by all the time instants to be
+ *  computed; blocks of 8 combinations are evaluated through tables of the products of groups
+ *  of 4 components, and the partial results of all the lanes are horizontally reduced at the end.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers.
+ *  This function requires the KooN RBD system to have at most KOON_LANES_MAX_COMPONENTS
+ *  components
+ *
+ * Parameters:
+ *      data: KooN RBD data structure
+ *      time: current time instant over which KooN RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
+ *
+ * Return:
+ *  None
+ */
+HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNGenericLanesStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask)
+{
+    __m512d v8dLo[V8D][(data->numComponents + 3) / 4];
+    __m512d v8dHi[V8D][(data->numComponents + 3) / 4];
+    __m512d v8dX[4];
+    __m512d v8dY[4];
+    __m512d v8dTable;
+    __m512d v8dAcc[V8D];
+    __m512i v8lMasks;
+    struct combinations *comb;
+    unsigned long long masks[V8D];
+    unsigned long long elements;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    unsigned char element;
+    unsigned int numLanes;
+    unsigned int numInstants;
+    unsigned int tt;
+    int numNibbles;
+    int ii, jj, kk;
+    unsigned long long idx;
+    unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+    double s1dRes;
+
+    /* Retrieve number of time instants to be computed, they are the lowest bits of mask */
+    for (numInstants = 0; (numInstants < V8D) && (((mask >> numInstants) & 1) != 0); ++numInstants);
+    numNibbles = (data->numComponents + 3) / 4;
+
+    /* For each time instant to be computed... */
+    for (tt = 0; tt < numInstants; ++tt) {
+        /* For each group of 4 components... */
+        for (jj = 0; jj < numNibbles; ++jj) {
+            /* Broadcast reliability and unreliability of components, elements of combinations select the X ones */
+            for (kk = 0; kk < 4; ++kk) {
+                /* Components following the last one do not affect products */
+                if (((4 * jj) + kk) >= data->numComponents) {
+                    v8dX[kk] = v8dOnes;
+                    v8dY[kk] = v8dOnes;
+                    continue;
+                }
+                s1dRes = data->reliabilities[(((4 * jj) + kk) * data->numTimes) + time + tt];
+                if (data->bComputeUnreliability == 0) {
+                    v8dX[kk] = _mm512_set1_pd(s1dRes);
+                    v8dY[kk] = _mm512_set1_pd(1.0 - s1dRes);
                 }
                 else {
-                    /* Multiply step unreliability for reliability of current component */
-                    v8dStep = _mm512_mul_pd(v8dStep, v8dTmp);
+                    v8dX[kk] = _mm512_set1_pd(1.0 - s1dRes);
+                    v8dY[kk] = _mm512_set1_pd(s1dRes);
                 }
             }
+            /* Compute products of all combinations of first 3 components of group, entry bits select the X ones */
+            v8dTable = _mm512_mul_pd(_mm512_mask_blend_pd(0xAA, v8dY[0], v8dX[0]), _mm512_mask_blend_pd(0xCC, v8dY[1], v8dX[1]));
+            v8dTable = _mm512_mul_pd(v8dTable, _mm512_mask_blend_pd(0xF0, v8dY[2], v8dX[2]));
+            /* Fill table of group into scratch tile, highest bit selects X of last component */
+            v8dLo[tt][jj] = _mm512_mul_pd(v8dTable, v8dY[3]);
+            v8dHi[tt][jj] = _mm512_mul_pd(v8dTable, v8dX[3]);
+        }
+        /* Initialize partial results of all lanes to 0 */
+        v8dAcc[tt] = v8dZeros;
+    }
+
+    /* No lane is filled yet */
+    numLanes = 0;
+
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
+    /* For each possible set of combinations... */
+    for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute bitmask of first combination */
+            elements = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                elements |= 1ULL << combination[jj];
+            }
+
+            /* For each combination, in lexicographic order... */
+            for (idx = first; idx < last; ++idx) {
+                if (idx > first) {
+                    /* Retrieve index of first element changed from previous combination */
+                    pivot = comb->pivots[idx];
+                    /* Pivot element is incremented by 1 and the following ones are consecutive to it */
+                    element = combination[pivot]++;
+                    elements &= (1ULL << element) - 1ULL;
+                    elements |= (~0ULL >> (64 - (comb->k - pivot))) << (element + 1);
+                    for (jj = pivot + 1; jj < comb->k; ++jj) {
+                        combination[jj] = combination[jj - 1] + 1;
+                    }
+                }
+
+                /* Store bitmask of current combination into its lane */
+                masks[numLanes++] = elements;
 
-            /* Perform partial subtraction for computation of KooN reliability */
-            v8dRes = _mm512_sub_pd(v8dRes, v8dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+                /* Are all lanes filled? */
+                if (numLanes == V8D) {
+                    /* Compute products of 8 combinations and perform their partial sum, for each time instant */
+                    v8lMasks = _mm512_loadu_si512((const void *)&masks[0]);
+                    for (tt = 0; tt < numInstants; ++tt) {
+                        v8dAcc[tt] = _mm512_add_pd(v8dAcc[tt], koonLanesProductV8dAvx512f(v8dLo[tt], v8dHi[tt], v8lMasks, numNibbles));
+                    }
+                    numLanes = 0;
+                }
+            }
         }
     }
 
-    /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    /* For each time instant to be computed... */
+    for (tt = 0; tt < numInstants; ++tt) {
+        /* Are some lanes still filled? */
+        if (numLanes > 0) {
+            /* Compute products of remaining combinations and perform their partial sum, unused lanes are discarded */
+            v8lMasks = _mm512_maskz_loadu_epi64(V8D_MASK(numLanes), (const void *)&masks[0]);
+            v8dAcc[tt] = _mm512_mask_add_pd(v8dAcc[tt], V8D_MASK(numLanes), v8dAcc[tt], koonLanesProductV8dAvx512f(v8dLo[tt], v8dHi[tt], v8lMasks, numNibbles));
+        }
+
+        /* Horizontally reduce partial results of all lanes */
+        s1dRes = _mm512_reduce_add_pd(v8dAcc[tt]);
+        /* Is compute unreliability flag set? */
+        if (data->bComputeUnreliability != 0) {
+            s1dRes = 1.0 - s1dRes;
+        }
+
+        /* Cap the computed reliability and set it into output array */
+        data->output[time + tt] = capReliabilityS1d(s1dRes);
+    }
 }
 
 /**
- * rbdKooNRecursionV8dAvx512f
+ * rbdKooNDynamicStepV8dAvx512f
  *
- * Compute KooN RBD though Recursive method with amd64 AVX512F 512bit
+ * Compute KooN RBD through Dynamic Programming with amd64 AVX512F 512bit
  *
  * Input:
  *      struct rbdKooNGenericData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
  *
  * Description:
- *  This function computes the reliability of KooN RBD system through recursion
- *  exploiting amd64 AVX512F 512bit
+ *  This function computes the reliability of KooN RBD system through Dynamic Programming
+ *  exploiting amd64 AVX512F 512bit.
+ *  It keeps a rolling array of the probabilities of having at least k working components, with
+ *  k in [0, K], among the first n components. Each component updates such probabilities, from
+ *  the highest k down to the lowest one, skipping the ones that do not contribute anymore to the
+ *  final result, thus requiring O(N*K) operations per time instant
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  *
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNRecursionV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNDynamicStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask)
 {
-    __m512d v8dRes;
+    __m512d v8dA[data->minComponents + 1];
+    __m512d v8dR;
+    unsigned char n;
+    unsigned char k;
+    unsigned char kMin;
+    unsigned char kMax;
+
+    /* Initialize probabilities of having at least k working components out of no components */
+    v8dA[0] = v8dOnes;
+    for (k = 1; k <= data->minComponents; ++k) {
+        v8dA[k] = v8dZeros;
+    }
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v8dR = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute range of probabilities affecting the one of at least K working components */
+        kMax = (n < data->minComponents) ? (n + 1) : data->minComponents;
+        kMin = ((data->minComponents + n) >= data->numComponents) ? ((data->minComponents + n + 1) - data->numComponents) : 1;
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = kMax; k >= kMin; --k) {
+            v8dA[k] = _mm512_fmadd_pd(v8dR, _mm512_sub_pd(v8dA[k - 1], v8dA[k]), v8dA[k]);
+        }
+    }
 
-    /* Recursively compute reliability of KooN RBD at current time instant */
-    v8dRes = rbdKooNRecursiveStepV8dAvx512f(data, time, data->numComponents, data->minComponents);
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dA[data->minComponents]));
 }
 
 /**
- * rbdKooNIdenticalSuccessStepV8dAvx512f
+ * rbdKooNAllStepV8dAvx512f
  *
- * Identical KooN RBD Step function from working components with amd64 AVX512F 512bit
+ * Compute all KooN RBDs with K in [1, N] through Dynamic Programming with amd64 AVX512F 512bit
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      struct rbdKooNGenericData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the identical KooN RBD function exploiting amd64 AVX512F 512bit.
- *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  This function computes the reliabilities of all KooN RBD systems with K in [1, N] sharing the
+ *  same components exploiting
+ *  amd64 AVX512F 512bit. It keeps a rolling array of the probabilities of having at least k
+ *  working components among the first n components, which requires O(N^2) operations per time
+ *  instant. The reliability of the KooN RBD system with K=k is stored into row k-1 of output matrix
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  *
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNIdenticalSuccessStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNAllStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask)
 {
+    __m512d v8dA[data->numComponents + 1];
     __m512d v8dR;
-    __m512d v8dTmp1, v8dTmp2;
-    __m512d v8dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned char n;
+    unsigned char k;
 
-    /* Retrieve reliability */
-    v8dR = _mm512_loadu_pd(&data->reliabilities[time]);
-    /* Initialize reliability to 0 */
-    v8dRes = v8dZeros;
-    /* Compute product between reliability and unreliability */
-    v8dTmp2 = _mm512_fnmadd_pd(v8dR, v8dR, v8dR);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v8dTmp1 = _mm512_set1_pd((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->minComponents + ii;
-        numFail = data->numComponents - data->minComponents - ii;
-        /* For each failed component... */
-        for (jj = (numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for product of reliability and unreliability of component */
-            v8dTmp1 = _mm512_mul_pd(v8dTmp1, v8dTmp2);
-        }
-        /* For each non-considered working component... */
-        for (jj = (numWork - numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for reliability of component */
-            v8dTmp1 = _mm512_mul_pd(v8dTmp1, v8dR);
+    /* Initialize probability of having at least 0 working components out of no components */
+    v8dA[0] = v8dOnes;
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v8dR = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute probability of having all the first n+1 components working */
+        v8dA[n + 1] = _mm512_mul_pd(v8dR, v8dA[n]);
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = n; k > 0; --k) {
+            v8dA[k] = _mm512_fmadd_pd(v8dR, _mm512_sub_pd(v8dA[k - 1], v8dA[k]), v8dA[k]);
         }
-        /* Add reliability of current iteration */
-        v8dRes = _mm512_add_pd(v8dRes, v8dTmp1);
     }
 
-    /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    /* For each K in [1, N]... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Cap the computed reliability and set it into output matrix */
+        _mm512_mask_storeu_pd(&data->output[(n * data->numTimes) + time], mask, capReliabilityV8dAvx512f(v8dA[n + 1]));
+    }
 }
 
 /**
- * rbdKooNIdenticalFailStepV8dAvx512f
+ * rbdKooNIdenticalSuccessStepV8dAvx512f
  *
- * Identical KooN RBD Step function from failed components with amd64 AVX512F 512bit
+ * Identical KooN RBD Step function from working components with amd64 AVX512F 512bit
  *
  * Input:
  *      struct rbdKooNIdenticalData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -294,103 +642,124 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNIdenticalSuccessStepV8dAvx512f(str
  * Description:
  *  This function implements the identical KooN RBD function exploiting amd64 AVX512F 512bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the working components. The reliability is a polynomial of the reliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of unreliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  *
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNIdenticalFailStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNIdenticalSuccessStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time, __mmask8 mask)
 {
+    __m512d v8dR;
     __m512d v8dU;
-    __m512d v8dTmp1, v8dTmp2;
+    __m512d v8dPow;
     __m512d v8dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned int exponent;
+    int ii;
 
     /* Retrieve reliability */
-    v8dTmp2 = _mm512_loadu_pd(&data->reliabilities[time]);
+    v8dR = _mm512_maskz_loadu_pd(mask, &data->reliabilities[time]);
     /* Compute unreliability */
-    v8dU = _mm512_sub_pd(v8dOnes, v8dTmp2);
-    /* Initialize reliability to 1 */
-    v8dRes = v8dOnes;
-    /* Compute product between reliability and unreliability */
-    v8dTmp2 = _mm512_mul_pd(v8dTmp2, v8dU);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v8dTmp1 = _mm512_set1_pd((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->numComponents - data->minComponents - ii;
-        numFail = data->minComponents + ii;
-        /* For each working component... */
-        for (jj = (numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for product of reliability and unreliability of component */
-            v8dTmp1 = _mm512_mul_pd(v8dTmp1, v8dTmp2);
-        }
-        /* For each non-considered failed component... */
-        for (jj = (numFail - numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for unreliability of component */
-            v8dTmp1 = _mm512_mul_pd(v8dTmp1, v8dU);
+    v8dU = _mm512_sub_pd(v8dOnes, v8dR);
+
+    /* Initialize Horner accumulator to nCN, i.e. all components working */
+    v8dRes = _mm512_set1_pd(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of unreliability to 1 */
+    v8dPow = v8dOnes;
+    /* For each number of working components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of unreliability of the other components */
+        v8dPow = _mm512_mul_pd(v8dPow, v8dU);
+        /* Horner step: multiply accumulator for reliability and add nCi weighted by power of unreliability */
+        v8dRes = _mm512_fmadd_pd(v8dRes, v8dR, _mm512_mul_pd(_mm512_set1_pd(data->nCi[ii]), v8dPow));
+    }
+    /* Multiply accumulator for reliability of K working components through exponentiation by squaring */
+    v8dPow = v8dR;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v8dRes = _mm512_mul_pd(v8dRes, v8dPow);
         }
-        /* Subtract unreliability of current iteration */
-        v8dRes = _mm512_sub_pd(v8dRes, v8dTmp1);
+        v8dPow = _mm512_mul_pd(v8dPow, v8dPow);
     }
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 /**
- * rbdKooNRecursiveStepV8dAvx512f
+ * rbdKooNIdenticalFailStepV8dAvx512f
  *
- * Recursive KooN RBD Step function with amd64 AVX512F 512bit
+ * Identical KooN RBD Step function from failed components with amd64 AVX512F 512bit
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      struct rbdKooNIdenticalData *data
  *      unsigned int time
- *      unsigned char n
- *      unsigned char k
+ *      __mmask8 mask
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the recursive KooN RBD function exploiting amd64 AVX512F 512bit.
- *  It is responsible to recursively compute the reliability of a KooN RBD system
+ *  This function implements the identical KooN RBD function exploiting amd64 AVX512F 512bit.
+ *  It is responsible to compute the reliability of a KooN RBD system
+ *  taking into account the failed components. The unreliability is a polynomial of the unreliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of reliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
- *      n: current number of components in KooN RBD
- *      k: minimum number of working components in KooN RBD
+ *      mask: mask of time instants to be computed, starting from current one
  *
- * Return (__m512d):
- *  Computed reliability
+ * Return:
+ *  None
  */
-static FUNCTION_TARGET("avx512f") __m512d rbdKooNRecursiveStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdKooNIdenticalFailStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time, __mmask8 mask)
 {
-    __m512d v8dTmp1, v8dTmp2;
+    __m512d v8dR;
+    __m512d v8dU;
+    __m512d v8dPow;
     __m512d v8dRes;
+    unsigned int exponent;
+    int ii;
 
-    /* Load reliabilities and compute unreliabilities */
-    --n;
-    v8dRes = _mm512_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
-    v8dTmp1 = _mm512_sub_pd(v8dOnes, v8dRes);
-    /* Recursively compute the reliabilities */
-    if ((k-1) > 0) {
-        v8dTmp2 = rbdKooNRecursiveStepV8dAvx512f(data, time, n, k-1);
-        v8dRes = _mm512_mul_pd(v8dRes, v8dTmp2);
+    /* Retrieve reliability */
+    v8dR = _mm512_maskz_loadu_pd(mask, &data->reliabilities[time]);
+    /* Compute unreliability */
+    v8dU = _mm512_sub_pd(v8dOnes, v8dR);
+
+    /* Initialize Horner accumulator to nCN, i.e. all components failed */
+    v8dRes = _mm512_set1_pd(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of reliability to 1 */
+    v8dPow = v8dOnes;
+    /* For each number of failed components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of reliability of the other components */
+        v8dPow = _mm512_mul_pd(v8dPow, v8dR);
+        /* Horner step: multiply accumulator for unreliability and add nCi weighted by power of reliability */
+        v8dRes = _mm512_fmadd_pd(v8dRes, v8dU, _mm512_mul_pd(_mm512_set1_pd(data->nCi[ii]), v8dPow));
     }
-    if (k <= n) {
-        v8dTmp2 = rbdKooNRecursiveStepV8dAvx512f(data, time, n, k);
-        v8dRes = _mm512_fmadd_pd(v8dTmp1, v8dTmp2, v8dRes);
+    /* Multiply accumulator for unreliability of K failed components through exponentiation by squaring */
+    v8dPow = v8dU;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v8dRes = _mm512_mul_pd(v8dRes, v8dPow);
+        }
+        v8dPow = _mm512_mul_pd(v8dPow, v8dPow);
     }
-    return v8dRes;
+    /* Compute reliability from unreliability */
+    v8dRes = _mm512_sub_pd(v8dOnes, v8dRes);
+
+    /* Cap the computed reliability and set it into output array */
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 
@@ -35,6 +35,7 @@
  * Input:
  *      struct rbdParallelData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -47,24 +48,25 @@
  * Parameters:
  *      data: Parallel RBD data structure
  *      time: current time instant over which Parallel RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdParallelGenericStepV8dAvx512f(struct rbdParallelData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdParallelGenericStepV8dAvx512f(struct rbdParallelData *data, unsigned int time, __mmask8 mask)
 {
     unsigned char component;
     __m512d v8dTmp;
     __m512d v8dRes;
 
     /* Compute reliability of Parallel RBD at current time instant */
-    v8dRes = _mm512_loadu_pd(&data->reliabilities[(0 * data->numTimes) + time]);
+    v8dRes = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(0 * data->numTimes) + time]);
     v8dRes = _mm512_sub_pd(v8dOnes, v8dRes);
     for (component = 1; component < data->numComponents; ++component) {
-        v8dTmp = _mm512_loadu_pd(&data->reliabilities[(component * data->numTimes) + time]);
+        v8dTmp = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(component * data->numTimes) + time]);
         v8dRes = _mm512_fnmadd_pd(v8dRes, v8dTmp, v8dRes);
     }
     v8dRes = _mm512_sub_pd(v8dOnes, v8dRes);
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 /**
@@ -75,6 +77,7 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdParallelGenericStepV8dAvx512f(struct r
  * Input:
  *      struct rbdParallelData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -82,31 +85,41 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdParallelGenericStepV8dAvx512f(struct r
  * Description:
  *  This function implements the identical Parallel RBD step exploiting amd64 AVX512F 512bit.
  *  It is responsible to compute the reliability of a Parallel block with identical components
- *  given their reliability
+ *  given their reliability. The power of the unreliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Parallel RBD data structure
  *      time: current time instant over which Parallel RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdParallelIdenticalStepV8dAvx512f(struct rbdParallelData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdParallelIdenticalStepV8dAvx512f(struct rbdParallelData *data, unsigned int time, __mmask8 mask)
 {
-    unsigned char component;
+    unsigned char bit;
     __m512d v8dU;
     __m512d v8dRes;
 
     /* Load unreliability */
-    v8dU = _mm512_loadu_pd(&data->reliabilities[time]);
+    v8dU = _mm512_maskz_loadu_pd(mask, &data->reliabilities[time]);
     v8dU = _mm512_sub_pd(v8dOnes, v8dU);
 
-    /* Compute reliability of Parallel RBD at current time instant */
+    /* Compute reliability of Parallel RBD at current time instant through exponentiation by squaring */
     v8dRes = v8dU;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        v8dRes = _mm512_mul_pd(v8dRes, v8dU);
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        v8dRes = _mm512_mul_pd(v8dRes, v8dRes);
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            v8dRes = _mm512_mul_pd(v8dRes, v8dU);
+        }
     }
     v8dRes = _mm512_sub_pd(v8dOnes, v8dRes);
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 
@@ -35,6 +35,7 @@
  * Input:
  *      struct rbdSeriesData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -47,22 +48,23 @@
  * Parameters:
  *      data: Series RBD data structure
  *      time: current time instant over which Series RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdSeriesGenericStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdSeriesGenericStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time, __mmask8 mask)
 {
     unsigned char component;
     __m512d v8dTmp;
     __m512d v8dRes;
 
     /* Compute reliability of Series RBD at current time instant */
-    v8dRes = _mm512_loadu_pd(&data->reliabilities[(0 * data->numTimes) + time]);
+    v8dRes = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(0 * data->numTimes) + time]);
     for (component = 1; component < data->numComponents; ++component) {
-        v8dTmp = _mm512_loadu_pd(&data->reliabilities[(component * data->numTimes) + time]);
+        v8dTmp = _mm512_maskz_loadu_pd(mask, &data->reliabilities[(component * data->numTimes) + time]);
         v8dRes = _mm512_mul_pd(v8dRes, v8dTmp);
     }
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 /**
@@ -73,6 +75,7 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdSeriesGenericStepV8dAvx512f(struct rbd
  * Input:
  *      struct rbdSeriesData *data
  *      unsigned int time
+ *      __mmask8 mask
  *
  * Output:
  *      None
@@ -80,29 +83,39 @@ HIDDEN FUNCTION_TARGET("avx512f") void rbdSeriesGenericStepV8dAvx512f(struct rbd
  * Description:
  *  This function implements the identical Series RBD step exploiting amd64 AVX512F 512bit.
  *  It is responsible to compute the reliability of a Series block with identical components
- *  given their reliability
+ *  given their reliability. The power of the reliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Series RBD data structure
  *      time: current time instant over which Series RBD shall be computed
+ *      mask: mask of time instants to be computed, starting from current one
  */
-HIDDEN FUNCTION_TARGET("avx512f") void rbdSeriesIdenticalStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("avx512f") void rbdSeriesIdenticalStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time, __mmask8 mask)
 {
-    unsigned char component;
+    unsigned char bit;
     __m512d v8dTmp;
     __m512d v8dRes;
 
     /* Load reliability */
-    v8dTmp = _mm512_loadu_pd(&data->reliabilities[time]);
+    v8dTmp = _mm512_maskz_loadu_pd(mask, &data->reliabilities[time]);
 
-    /* Compute reliability of Series RBD at current time instant */
+    /* Compute reliability of Series RBD at current time instant through exponentiation by squaring */
     v8dRes = v8dTmp;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        v8dRes = _mm512_mul_pd(v8dRes, v8dTmp);
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        v8dRes = _mm512_mul_pd(v8dRes, v8dRes);
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            v8dRes = _mm512_mul_pd(v8dRes, v8dTmp);
+        }
     }
 
     /* Cap the computed reliability and set it into output array */
-    _mm512_storeu_pd(&data->output[time], capReliabilityV8dAvx512f(v8dRes));
+    _mm512_mask_storeu_pd(&data->output[time], mask, capReliabilityV8dAvx512f(v8dRes));
 }
 
 
@@ -29,132 +29,71 @@
 #include "../bridge.h"
 
 
-static void *rbdBridgeGenericWorkerAvx512f(struct rbdBridgeData *data);
-static void *rbdBridgeGenericWorkerFma3(struct rbdBridgeData *data);
-static void *rbdBridgeGenericWorkerAvx(struct rbdBridgeData *data);
-static void *rbdBridgeIdenticalWorkerAvx512f(struct rbdBridgeData *data);
-static void *rbdBridgeIdenticalWorkerFma3(struct rbdBridgeData *data);
-static void *rbdBridgeIdenticalWorkerAvx(struct rbdBridgeData *data);
+static void *rbdBridgeGenericWorkerAvx512f(void *arg);
+static void *rbdBridgeGenericWorkerFma3(void *arg);
+static void *rbdBridgeGenericWorkerAvx(void *arg);
+static void *rbdBridgeIdenticalWorkerAvx512f(void *arg);
+static void *rbdBridgeIdenticalWorkerFma3(void *arg);
+static void *rbdBridgeIdenticalWorkerAvx(void *arg);
 
 
 /**
- * rbdBridgeGenericWorker
+ * rbdBridgeResolveWorkers
  *
- * Bridge RBD Worker function with amd64 platform-specific instruction sets
+ * Resolve Bridge RBD Workers with amd64 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the generic Bridge RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a Bridge RBD system
+ *  This function selects, for each Bridge RBD Worker, the implementation exploiting the widest
+ *  amd64 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a Bridge RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Bridge RBD
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdBridgeGenericWorker(void *arg)
+HIDDEN void rbdBridgeResolveWorkers(void)
 {
-    struct rbdBridgeData *data;
-    unsigned int time;
-
-    /* Retrieve Bridge RBD data */
-    data = (struct rbdBridgeData *)arg;
-
+    /* Resolve generic Bridge RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdBridgeGenericWorkerAvx512f(data);
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerAvx512f;
     }
-
-    if (amd64Fma3Supported()) {
-        return rbdBridgeGenericWorkerFma3(data);
+    else if (amd64Fma3Supported()) {
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerFma3;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdBridgeGenericWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdBridgeGenericWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeGenericStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numTimes;
+    else {
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdBridgeIdenticalWorker
- *
- * Identical Bridge RBD Worker function with amd64 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical Bridge RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of an identical Bridge RBD system
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a Bridge RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Bridge RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
-{
-    struct rbdBridgeData *data;
-    unsigned int time;
-
-    /* Retrieve Bridge RBD data */
-    data = (struct rbdBridgeData *)arg;
-
+    /* Resolve identical Bridge RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdBridgeIdenticalWorkerAvx512f(data);
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerAvx512f;
     }
-
-    if (amd64Fma3Supported()) {
-        return rbdBridgeIdenticalWorkerFma3(data);
+    else if (amd64Fma3Supported()) {
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerFma3;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdBridgeIdenticalWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdBridgeIdenticalWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeIdenticalStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerS1d;
     }
-
-    return NULL;
 }
 
 /**
@@ -163,7 +102,7 @@ HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
  * Bridge RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -173,46 +112,36 @@ HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
  *  It is responsible to compute the reliabilities over a given batch of a Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdBridgeGenericWorkerAvx512f(struct rbdBridgeData *data)
+static void *rbdBridgeGenericWorkerAvx512f(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
 
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
     /* For each time instant to be processed (blocks of 8 time instants)... */
-    while ((time + V8D) <= data->numTimes) {
+    while ((time + V8D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V8D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeGenericStepV8dAvx512f(data, time);
-        /* Increment current time instant */
-        time += (data->numCores * V8D);
-    }
-    /* Are (at least) 4 time instants remaining? */
-    if ((time + V4D) <= data->numTimes) {
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeGenericStepV4dFma3(data, time);
-        /* Increment current time instant */
-        time += V4D;
-    }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
         /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeGenericStepV2dFma3(data, time);
+        rbdBridgeGenericStepV8dAvx512f(data, time, V8D_MASK(V8D));
         /* Increment current time instant */
-        time += V2D;
+        time += (data->batch.numBatches * V8D);
     }
-    /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeGenericStepS1d(data, time);
+        rbdBridgeGenericStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
     }
 
     return NULL;
@@ -224,7 +153,7 @@ static void *rbdBridgeGenericWorkerAvx512f(struct rbdBridgeData *data)
  * Bridge RBD Worker function with amd64 FMA3 instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -234,37 +163,41 @@ static void *rbdBridgeGenericWorkerAvx512f(struct rbdBridgeData *data)
  *  It is responsible to compute the reliabilities over a given batch of a Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdBridgeGenericWorkerFma3(struct rbdBridgeData *data)
+static void *rbdBridgeGenericWorkerFma3(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
 
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepV4dFma3(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepV2dFma3(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepS1d(data, time);
     }
@@ -278,7 +211,7 @@ static void *rbdBridgeGenericWorkerFma3(struct rbdBridgeData *data)
  * Bridge RBD Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -288,37 +221,41 @@ static void *rbdBridgeGenericWorkerFma3(struct rbdBridgeData *data)
  *  It is responsible to compute the reliabilities over a given batch of a Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdBridgeGenericWorkerAvx(struct rbdBridgeData *data)
+static void *rbdBridgeGenericWorkerAvx(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
 
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepV4dAvx(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepV2dSse2(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepS1d(data, time);
     }
@@ -332,7 +269,7 @@ static void *rbdBridgeGenericWorkerAvx(struct rbdBridgeData *data)
  * Identical Bridge RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -342,67 +279,48 @@ static void *rbdBridgeGenericWorkerAvx(struct rbdBridgeData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdBridgeIdenticalWorkerAvx512f(struct rbdBridgeData *data)
+static void *rbdBridgeIdenticalWorkerAvx512f(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
+    unsigned int head;
+
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
 
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        /* Compute number of time instants preceding the first aligned one */
+        head = (unsigned int)(((V8D * sizeof(double)) - ((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1))) / sizeof(double)) & (V8D - 1);
+        if ((head != 0) && ((time + head) <= data->batch.tEnd)) {
             /* Compute reliability of Bridge RBD at current time instant */
-            rbdBridgeIdenticalStepS1d(data, time);
+            rbdBridgeIdenticalStepV8dAvx512f(data, time, V8D_MASK(head));
             /* Increment current time instant */
-            time += S1D;
-        }
-        if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
-            /* Compute reliability of Bridge RBD at current time instant */
-            rbdBridgeIdenticalStepV2dFma3(data, time);
-            /* Increment current time instant */
-            time += V2D;
-        }
-        if (((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1)) != 0) {
-            /* Compute reliability of Bridge RBD at current time instant */
-            rbdBridgeIdenticalStepV4dFma3(data, time);
-            /* Increment current time instant */
-            time += V4D;
+            time += head;
         }
     }
     /* For each time instant to be processed (blocks of 8 time instants)... */
-    while ((time + V8D) <= data->numTimes) {
+    while ((time + V8D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V8D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeIdenticalStepV8dAvx512f(data, time);
-        /* Increment current time instant */
-        time += (data->numCores * V8D);
-    }
-    /* Are (at least) 4 time instants remaining? */
-    if ((time + V4D) <= data->numTimes) {
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeIdenticalStepV4dFma3(data, time);
-        /* Increment current time instant */
-        time += V4D;
-    }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V8D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
         /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeIdenticalStepV2dFma3(data, time);
+        rbdBridgeIdenticalStepV8dAvx512f(data, time, V8D_MASK(V8D));
         /* Increment current time instant */
-        time += V2D;
+        time += (data->batch.numBatches * V8D);
     }
-    /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeIdenticalStepS1d(data, time);
+        rbdBridgeIdenticalStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
     }
 
     return NULL;
@@ -414,7 +332,7 @@ static void *rbdBridgeIdenticalWorkerAvx512f(struct rbdBridgeData *data)
  * Identical Bridge RBD Worker function with amd64 FMA3 instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -424,27 +342,31 @@ static void *rbdBridgeIdenticalWorkerAvx512f(struct rbdBridgeData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdBridgeIdenticalWorkerFma3(struct rbdBridgeData *data)
+static void *rbdBridgeIdenticalWorkerFma3(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
 
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Bridge RBD at current time instant */
             rbdBridgeIdenticalStepS1d(data, time);
             /* Increment current time instant */
             time += S1D;
         }
-        if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
             /* Compute reliability of Bridge RBD at current time instant */
             rbdBridgeIdenticalStepV2dFma3(data, time);
             /* Increment current time instant */
@@ -452,24 +374,24 @@ static void *rbdBridgeIdenticalWorkerFma3(struct rbdBridgeData *data)
         }
     }
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepV4dFma3(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepV2dFma3(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepS1d(data, time);
     }
@@ -483,7 +405,7 @@ static void *rbdBridgeIdenticalWorkerFma3(struct rbdBridgeData *data)
  * Identical Bridge RBD Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -493,27 +415,31 @@ static void *rbdBridgeIdenticalWorkerFma3(struct rbdBridgeData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdBridgeIdenticalWorkerAvx(struct rbdBridgeData *data)
+static void *rbdBridgeIdenticalWorkerAvx(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
 
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Bridge RBD at current time instant */
             rbdBridgeIdenticalStepS1d(data, time);
             /* Increment current time instant */
             time += S1D;
         }
-        if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
             /* Compute reliability of Bridge RBD at current time instant */
             rbdBridgeIdenticalStepV2dSse2(data, time);
             /* Increment current time instant */
@@ -521,24 +447,24 @@ static void *rbdBridgeIdenticalWorkerAvx(struct rbdBridgeData *data)
         }
     }
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepV4dAvx(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepV2dSse2(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepS1d(data, time);
     }
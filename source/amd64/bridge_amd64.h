@@ -24,6 +24,7 @@
 
 
 #include "../generic/rbd_internal_generic.h"
+#include "rbd_internal_amd64.h"
 #include "../bridge.h"
 
 #if defined(ARCH_AMD64) && (CPU_ENABLE_SIMD != 0)
@@ -38,8 +39,8 @@ void rbdBridgeGenericStepV2dFma3(struct rbdBridgeData *data, unsigned int time);
 void rbdBridgeIdenticalStepV2dFma3(struct rbdBridgeData *data, unsigned int time);
 
 /* Platform-specific functions for amd64 AVX512F instruction set */
-void rbdBridgeGenericStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time);
-void rbdBridgeIdenticalStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time);
+void rbdBridgeGenericStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time, __mmask8 mask);
+void rbdBridgeIdenticalStepV8dAvx512f(struct rbdBridgeData *data, unsigned int time, __mmask8 mask);
 #endif /* defined(ARCH_AMD64) && (CPU_ENABLE_SIMD != 0) */
 
 
@@ -27,10 +27,6 @@
 #include "../koon_amd64.h"
 
 
-static FUNCTION_TARGET("fma") __m256d rbdKooNRecursiveStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k);
-static FUNCTION_TARGET("fma") __m128d rbdKooNRecursiveStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k);
-
-
 /**
  * rbdKooNGenericSuccessStepV4dFma3
  *
@@ -46,7 +42,13 @@ static FUNCTION_TARGET("fma") __m128d rbdKooNRecursiveStepV2dFma3(struct rbdKooN
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 FMA3 256bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  taking into account the working components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -57,49 +59,89 @@ static FUNCTION_TARGET("fma") __m128d rbdKooNRecursiveStepV2dFma3(struct rbdKooN
  */
 HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericSuccessStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m256d v4dR[data->numComponents];
+    __m256d v4dU[data->numComponents];
+    __m256d v4dG[data->numComponents];
+    __m256d v4dS[data->numComponents + 1];
     __m256d v4dStep;
-    __m256d v4dTmp;
     __m256d v4dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v4dS[data->numComponents] = v4dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v4dR[jj] = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
+        v4dU[jj] = _mm256_sub_pd(v4dOnes, v4dR[jj]);
+        /* Compute suffix product of unreliabilities of components */
+        v4dS[jj] = _mm256_mul_pd(v4dS[jj + 1], v4dU[jj]);
+    }
 
     /* Initialize reliability of current time instant to 0 */
     v4dRes = v4dZeros;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v4dStep = v4dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v4dTmp = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step reliability for reliability of current component */
-                    v4dStep = _mm256_mul_pd(v4dStep, v4dTmp);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step reliability for unreliability of current component */
-                    v4dStep = _mm256_fnmadd_pd(v4dTmp, v4dStep, v4dStep);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for unreliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dU[component]);
                 }
+                v4dG[jj] = v4dStep;
+                v4dStep = _mm256_mul_pd(v4dStep, v4dR[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial sum for computation of KooN reliability */
-            v4dRes = _mm256_add_pd(v4dRes, v4dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+            v4dRes = _mm256_fmadd_pd(v4dStep, v4dS[combination[comb->k - 1] + 1], v4dRes);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now failed */
+                v4dG[pivot] = _mm256_mul_pd(v4dG[pivot], v4dU[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for reliability of pivot component */
+                v4dStep = _mm256_mul_pd(v4dG[pivot], v4dR[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v4dG[jj] = v4dStep;
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dR[combination[jj]]);
+                }
+
+                /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+                v4dRes = _mm256_fmadd_pd(v4dStep, v4dS[combination[comb->k - 1] + 1], v4dRes);
+            }
         }
     }
 
@@ -122,7 +164,13 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericSuccessStepV4dFma3(struct rbdKo
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 FMA3 256bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the failed components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -133,49 +181,89 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericSuccessStepV4dFma3(struct rbdKo
  */
 HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m256d v4dR[data->numComponents];
+    __m256d v4dU[data->numComponents];
+    __m256d v4dG[data->numComponents];
+    __m256d v4dS[data->numComponents + 1];
     __m256d v4dStep;
-    __m256d v4dTmp;
     __m256d v4dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v4dS[data->numComponents] = v4dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v4dR[jj] = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
+        v4dU[jj] = _mm256_sub_pd(v4dOnes, v4dR[jj]);
+        /* Compute suffix product of reliabilities of components */
+        v4dS[jj] = _mm256_mul_pd(v4dS[jj + 1], v4dR[jj]);
+    }
 
     /* Initialize reliability of current time instant to 1 */
     v4dRes = v4dOnes;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v4dStep = v4dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v4dTmp = _mm256_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step unreliability for unreliability of current component */
-                    v4dStep = _mm256_fnmadd_pd(v4dTmp, v4dStep, v4dStep);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step unreliability for reliability of current component */
-                    v4dStep = _mm256_mul_pd(v4dStep, v4dTmp);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for reliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dR[component]);
                 }
+                v4dG[jj] = v4dStep;
+                v4dStep = _mm256_mul_pd(v4dStep, v4dU[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial subtraction for computation of KooN reliability */
-            v4dRes = _mm256_sub_pd(v4dRes, v4dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+            v4dRes = _mm256_fnmadd_pd(v4dStep, v4dS[combination[comb->k - 1] + 1], v4dRes);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now working */
+                v4dG[pivot] = _mm256_mul_pd(v4dG[pivot], v4dR[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for unreliability of pivot component */
+                v4dStep = _mm256_mul_pd(v4dG[pivot], v4dU[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v4dG[jj] = v4dStep;
+                    v4dStep = _mm256_mul_pd(v4dStep, v4dU[combination[jj]]);
+                }
+
+                /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+                v4dRes = _mm256_fnmadd_pd(v4dStep, v4dS[combination[comb->k - 1] + 1], v4dRes);
+            }
         }
     }
 
@@ -184,9 +272,9 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV4dFma3(struct rbdKooNG
 }
 
 /**
- * rbdKooNRecursionV4dFma3
+ * rbdKooNDynamicStepV4dFma3
  *
- * Compute KooN RBD though Recursive method with amd64 FMA3 256bit
+ * Compute KooN RBD through Dynamic Programming with amd64 FMA3 256bit
  *
  * Input:
  *      struct rbdKooNGenericData *data
@@ -196,8 +284,12 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV4dFma3(struct rbdKooNG
  *      None
  *
  * Description:
- *  This function computes the reliability of KooN RBD system through recursion
- *  exploiting amd64 FMA3 256bit
+ *  This function computes the reliability of KooN RBD system through Dynamic Programming
+ *  exploiting amd64 FMA3 256bit.
+ *  It keeps a rolling array of the probabilities of having at least k working components, with
+ *  k in [0, K], among the first n components. Each component updates such probabilities, from
+ *  the highest k down to the lowest one, skipping the ones that do not contribute anymore to the
+ *  final result, thus requiring O(N*K) operations per time instant
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -206,14 +298,91 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV4dFma3(struct rbdKooNG
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("fma") void rbdKooNRecursionV4dFma3(struct rbdKooNGenericData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("fma") void rbdKooNDynamicStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time)
 {
-    __m256d v4dRes;
+    __m256d v4dA[data->minComponents + 1];
+    __m256d v4dR;
+    unsigned char n;
+    unsigned char k;
+    unsigned char kMin;
+    unsigned char kMax;
+
+    /* Initialize probabilities of having at least k working components out of no components */
+    v4dA[0] = v4dOnes;
+    for (k = 1; k <= data->minComponents; ++k) {
+        v4dA[k] = v4dZeros;
+    }
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v4dR = _mm256_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute range of probabilities affecting the one of at least K working components */
+        kMax = (n < data->minComponents) ? (n + 1) : data->minComponents;
+        kMin = ((data->minComponents + n) >= data->numComponents) ? ((data->minComponents + n + 1) - data->numComponents) : 1;
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = kMax; k >= kMin; --k) {
+            v4dA[k] = _mm256_fmadd_pd(v4dR, _mm256_sub_pd(v4dA[k - 1], v4dA[k]), v4dA[k]);
+        }
+    }
 
-    /* Recursively compute reliability of KooN RBD at current time instant */
-    v4dRes = rbdKooNRecursiveStepV4dFma3(data, time, data->numComponents, data->minComponents);
     /* Cap the computed reliability and set it into output array */
-    _mm256_storeu_pd(&data->output[time], capReliabilityV4dAvx(v4dRes));
+    _mm256_storeu_pd(&data->output[time], capReliabilityV4dAvx(v4dA[data->minComponents]));
+}
+
+/**
+ * rbdKooNAllStepV4dFma3
+ *
+ * Compute all KooN RBDs with K in [1, N] through Dynamic Programming with amd64 FMA3 256bit
+ *
+ * Input:
+ *      struct rbdKooNGenericData *data
+ *      unsigned int time
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the reliabilities of all KooN RBD systems with K in [1, N] sharing the
+ *  same components exploiting
+ *  amd64 FMA3 256bit. It keeps a rolling array of the probabilities of having at least k
+ *  working components among the first n components, which requires O(N^2) operations per time
+ *  instant. The reliability of the KooN RBD system with K=k is stored into row k-1 of output matrix
+ *
+ * Parameters:
+ *      data: KooN RBD data structure
+ *      time: current time instant over which KooN RBD shall be computed
+ *
+ * Return:
+ *  None
+ */
+HIDDEN FUNCTION_TARGET("fma") void rbdKooNAllStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time)
+{
+    __m256d v4dA[data->numComponents + 1];
+    __m256d v4dR;
+    unsigned char n;
+    unsigned char k;
+
+    /* Initialize probability of having at least 0 working components out of no components */
+    v4dA[0] = v4dOnes;
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v4dR = _mm256_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute probability of having all the first n+1 components working */
+        v4dA[n + 1] = _mm256_mul_pd(v4dR, v4dA[n]);
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = n; k > 0; --k) {
+            v4dA[k] = _mm256_fmadd_pd(v4dR, _mm256_sub_pd(v4dA[k - 1], v4dA[k]), v4dA[k]);
+        }
+    }
+
+    /* For each K in [1, N]... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Cap the computed reliability and set it into output matrix */
+        _mm256_storeu_pd(&data->output[(n * data->numTimes) + time], capReliabilityV4dAvx(v4dA[n + 1]));
+    }
 }
 
 /**
@@ -231,7 +400,10 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNRecursionV4dFma3(struct rbdKooNGeneric
  * Description:
  *  This function implements the identical KooN RBD function exploiting amd64 FMA3 256bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  taking into account the working components. The reliability is a polynomial of the reliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of unreliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -243,37 +415,35 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNRecursionV4dFma3(struct rbdKooNGeneric
 HIDDEN FUNCTION_TARGET("fma") void rbdKooNIdenticalSuccessStepV4dFma3(struct rbdKooNIdenticalData *data, unsigned int time)
 {
     __m256d v4dR;
-    __m256d v4dTmp1, v4dTmp2;
+    __m256d v4dU;
+    __m256d v4dPow;
     __m256d v4dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned int exponent;
+    int ii;
 
     /* Retrieve reliability */
     v4dR = _mm256_loadu_pd(&data->reliabilities[time]);
-    /* Initialize reliability to 0 */
-    v4dRes = v4dZeros;
-    /* Compute product between reliability and unreliability */
-    v4dTmp2 = _mm256_fnmadd_pd(v4dR, v4dR, v4dR);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v4dTmp1 = _mm256_set1_pd((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->minComponents + ii;
-        numFail = data->numComponents - data->minComponents - ii;
-        /* For each failed component... */
-        for (jj = (numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for product of reliability and unreliability of component */
-            v4dTmp1 = _mm256_mul_pd(v4dTmp1, v4dTmp2);
-        }
-        /* For each non-considered working component... */
-        for (jj = (numWork - numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for reliability of component */
-            v4dTmp1 = _mm256_mul_pd(v4dTmp1, v4dR);
+    /* Compute unreliability */
+    v4dU = _mm256_sub_pd(v4dOnes, v4dR);
+
+    /* Initialize Horner accumulator to nCN, i.e. all components working */
+    v4dRes = _mm256_set1_pd(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of unreliability to 1 */
+    v4dPow = v4dOnes;
+    /* For each number of working components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of unreliability of the other components */
+        v4dPow = _mm256_mul_pd(v4dPow, v4dU);
+        /* Horner step: multiply accumulator for reliability and add nCi weighted by power of unreliability */
+        v4dRes = _mm256_fmadd_pd(v4dRes, v4dR, _mm256_mul_pd(_mm256_set1_pd(data->nCi[ii]), v4dPow));
+    }
+    /* Multiply accumulator for reliability of K working components through exponentiation by squaring */
+    v4dPow = v4dR;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v4dRes = _mm256_mul_pd(v4dRes, v4dPow);
         }
-        /* Add reliability of current iteration */
-        v4dRes = _mm256_add_pd(v4dRes, v4dTmp1);
+        v4dPow = _mm256_mul_pd(v4dPow, v4dPow);
     }
 
     /* Cap the computed reliability and set it into output array */
@@ -295,7 +465,13 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNIdenticalSuccessStepV4dFma3(struct rbd
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 FMA3 128bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  taking into account the working components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -306,49 +482,89 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNIdenticalSuccessStepV4dFma3(struct rbd
  */
 HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericSuccessStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m128d v2dR[data->numComponents];
+    __m128d v2dU[data->numComponents];
+    __m128d v2dG[data->numComponents];
+    __m128d v2dS[data->numComponents + 1];
     __m128d v2dStep;
-    __m128d v2dTmp;
     __m128d v2dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v2dS[data->numComponents] = v2dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v2dR[jj] = _mm_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
+        v2dU[jj] = _mm_sub_pd(v2dOnes, v2dR[jj]);
+        /* Compute suffix product of unreliabilities of components */
+        v2dS[jj] = _mm_mul_pd(v2dS[jj + 1], v2dU[jj]);
+    }
 
     /* Initialize reliability of current time instant to 0 */
     v2dRes = v2dZeros;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v2dStep = v2dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v2dTmp = _mm_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step reliability for reliability of current component */
-                    v2dStep = _mm_mul_pd(v2dStep, v2dTmp);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step reliability for unreliability of current component */
-                    v2dStep = _mm_fnmadd_pd(v2dTmp, v2dStep, v2dStep);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for unreliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v2dStep = _mm_mul_pd(v2dStep, v2dU[component]);
                 }
+                v2dG[jj] = v2dStep;
+                v2dStep = _mm_mul_pd(v2dStep, v2dR[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial sum for computation of KooN reliability */
-            v2dRes = _mm_add_pd(v2dRes, v2dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+            v2dRes = _mm_fmadd_pd(v2dStep, v2dS[combination[comb->k - 1] + 1], v2dRes);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now failed */
+                v2dG[pivot] = _mm_mul_pd(v2dG[pivot], v2dU[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for reliability of pivot component */
+                v2dStep = _mm_mul_pd(v2dG[pivot], v2dR[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v2dG[jj] = v2dStep;
+                    v2dStep = _mm_mul_pd(v2dStep, v2dR[combination[jj]]);
+                }
+
+                /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+                v2dRes = _mm_fmadd_pd(v2dStep, v2dS[combination[comb->k - 1] + 1], v2dRes);
+            }
         }
     }
 
@@ -371,7 +587,13 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericSuccessStepV2dFma3(struct rbdKo
  * Description:
  *  This function implements the generic KooN RBD function exploiting amd64 FMA3 128bit.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the failed components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -382,49 +604,89 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericSuccessStepV2dFma3(struct rbdKo
  */
 HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m128d v2dR[data->numComponents];
+    __m128d v2dU[data->numComponents];
+    __m128d v2dG[data->numComponents];
+    __m128d v2dS[data->numComponents + 1];
     __m128d v2dStep;
-    __m128d v2dTmp;
     __m128d v2dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    v2dS[data->numComponents] = v2dOnes;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        v2dR[jj] = _mm_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
+        v2dU[jj] = _mm_sub_pd(v2dOnes, v2dR[jj]);
+        /* Compute suffix product of reliabilities of components */
+        v2dS[jj] = _mm_mul_pd(v2dS[jj + 1], v2dR[jj]);
+    }
 
     /* Initialize reliability of current time instant to 1 */
     v2dRes = v2dOnes;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             v2dStep = v2dOnes;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Load reliabilities */
-                v2dTmp = _mm_loadu_pd(&data->reliabilities[(jj * data->numTimes) + time]);
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step unreliability for unreliability of current component */
-                    v2dStep = _mm_fnmadd_pd(v2dTmp, v2dStep, v2dStep);
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step unreliability for reliability of current component */
-                    v2dStep = _mm_mul_pd(v2dStep, v2dTmp);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for reliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    v2dStep = _mm_mul_pd(v2dStep, v2dR[component]);
                 }
+                v2dG[jj] = v2dStep;
+                v2dStep = _mm_mul_pd(v2dStep, v2dU[combination[jj]]);
+                ++component;
             }
 
-            /* Perform partial subtraction for computation of KooN reliability */
-            v2dRes = _mm_sub_pd(v2dRes, v2dStep);
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+            v2dRes = _mm_fnmadd_pd(v2dStep, v2dS[combination[comb->k - 1] + 1], v2dRes);
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now working */
+                v2dG[pivot] = _mm_mul_pd(v2dG[pivot], v2dR[combination[pivot]]);
+                ++combination[pivot];
+                /* Multiply products of preceding components for unreliability of pivot component */
+                v2dStep = _mm_mul_pd(v2dG[pivot], v2dU[combination[pivot]]);
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    v2dG[jj] = v2dStep;
+                    v2dStep = _mm_mul_pd(v2dStep, v2dU[combination[jj]]);
+                }
+
+                /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+                v2dRes = _mm_fnmadd_pd(v2dStep, v2dS[combination[comb->k - 1] + 1], v2dRes);
+            }
         }
     }
 
@@ -433,9 +695,9 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV2dFma3(struct rbdKooNG
 }
 
 /**
- * rbdKooNRecursionV2dFma3
+ * rbdKooNDynamicStepV2dFma3
  *
- * Compute KooN RBD though Recursive method with amd64 FMA3 128bit
+ * Compute KooN RBD through Dynamic Programming with amd64 FMA3 128bit
  *
  * Input:
  *      struct rbdKooNGenericData *data
@@ -445,8 +707,12 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV2dFma3(struct rbdKooNG
  *      None
  *
  * Description:
- *  This function computes the reliability of KooN RBD system through recursion
- *  exploiting amd64 FMA3 128bit
+ *  This function computes the reliability of KooN RBD system through Dynamic Programming
+ *  exploiting amd64 FMA3 128bit.
+ *  It keeps a rolling array of the probabilities of having at least k working components, with
+ *  k in [0, K], among the first n components. Each component updates such probabilities, from
+ *  the highest k down to the lowest one, skipping the ones that do not contribute anymore to the
+ *  final result, thus requiring O(N*K) operations per time instant
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -455,174 +721,156 @@ HIDDEN FUNCTION_TARGET("fma") void rbdKooNGenericFailStepV2dFma3(struct rbdKooNG
  * Return:
  *  None
  */
-HIDDEN FUNCTION_TARGET("fma") void rbdKooNRecursionV2dFma3(struct rbdKooNGenericData *data, unsigned int time)
-{
-    __m128d v2dRes;
-
-    /* Recursively compute reliability of KooN RBD at current time instant */
-    v2dRes = rbdKooNRecursiveStepV2dFma3(data, time, data->numComponents, data->minComponents);
-    /* Cap the computed reliability and set it into output array */
-    _mm_storeu_pd(&data->output[time], capReliabilityV2dSse2(v2dRes));
-}
-
-/**
- * rbdKooNIdenticalSuccessStepV2dFma3
- *
- * Identical KooN RBD Step function from working components with amd64 FMA3 128bit
- *
- * Input:
- *      struct rbdKooNIdenticalData *data
- *      unsigned int time
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical KooN RBD function exploiting amd64 FMA3 128bit.
- *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
- *
- * Parameters:
- *      data: KooN RBD data structure
- *      time: current time instant over which KooN RBD shall be computed
- *
- * Return:
- *  None
- */
-HIDDEN FUNCTION_TARGET("fma") void rbdKooNIdenticalSuccessStepV2dFma3(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN FUNCTION_TARGET("fma") void rbdKooNDynamicStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time)
 {
+    __m128d v2dA[data->minComponents + 1];
     __m128d v2dR;
-    __m128d v2dTmp1, v2dTmp2;
-    __m128d v2dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned char n;
+    unsigned char k;
+    unsigned char kMin;
+    unsigned char kMax;
+
+    /* Initialize probabilities of having at least k working components out of no components */
+    v2dA[0] = v2dOnes;
+    for (k = 1; k <= data->minComponents; ++k) {
+        v2dA[k] = v2dZeros;
+    }
 
-    /* Retrieve reliability */
-    v2dR = _mm_loadu_pd(&data->reliabilities[time]);
-    /* Initialize reliability to 0 */
-    v2dRes = v2dZeros;
-    /* Compute product between reliability and unreliability */
-    v2dTmp2 = _mm_fnmadd_pd(v2dR, v2dR, v2dR);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        v2dTmp1 = _mm_set1_pd((double)data->nCi[ii]);
-        /* Compute number of working and failed components */
-        numWork = data->minComponents + ii;
-        numFail = data->numComponents - data->minComponents - ii;
-        /* For each failed component... */
-        for (jj = (numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for product of reliability and unreliability of component */
-            v2dTmp1 = _mm_mul_pd(v2dTmp1, v2dTmp2);
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v2dR = _mm_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute range of probabilities affecting the one of at least K working components */
+        kMax = (n < data->minComponents) ? (n + 1) : data->minComponents;
+        kMin = ((data->minComponents + n) >= data->numComponents) ? ((data->minComponents + n + 1) - data->numComponents) : 1;
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = kMax; k >= kMin; --k) {
+            v2dA[k] = _mm_fmadd_pd(v2dR, _mm_sub_pd(v2dA[k - 1], v2dA[k]), v2dA[k]);
         }
-        /* For each non-considered working component... */
-        for (jj = (numWork - numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for reliability of component */
-            v2dTmp1 = _mm_mul_pd(v2dTmp1, v2dR);
-        }
-        /* Add reliability of current iteration */
-        v2dRes = _mm_add_pd(v2dRes, v2dTmp1);
     }
 
     /* Cap the computed reliability and set it into output array */
-    _mm_storeu_pd(&data->output[time], capReliabilityV2dSse2(v2dRes));
+    _mm_storeu_pd(&data->output[time], capReliabilityV2dSse2(v2dA[data->minComponents]));
 }
 
 /**
- * rbdKooNRecursiveStepV4dFma3
+ * rbdKooNAllStepV2dFma3
  *
- * Recursive KooN RBD Step function with amd64 FMA3 256bit
+ * Compute all KooN RBDs with K in [1, N] through Dynamic Programming with amd64 FMA3 128bit
  *
  * Input:
  *      struct rbdKooNGenericData *data
  *      unsigned int time
- *      unsigned char n
- *      unsigned char k
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the recursive KooN RBD function exploiting amd64 FMA3 256bit.
- *  It is responsible to recursively compute the reliability of a KooN RBD system
+ *  This function computes the reliabilities of all KooN RBD systems with K in [1, N] sharing the
+ *  same components exploiting
+ *  amd64 FMA3 128bit. It keeps a rolling array of the probabilities of having at least k
+ *  working components among the first n components, which requires O(N^2) operations per time
+ *  instant. The reliability of the KooN RBD system with K=k is stored into row k-1 of output matrix
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
- *      n: current number of components in KooN RBD
- *      k: minimum number of working components in KooN RBD
  *
- * Return (__m256d):
- *  Computed reliability
+ * Return:
+ *  None
  */
-static FUNCTION_TARGET("fma") __m256d rbdKooNRecursiveStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k)
+HIDDEN FUNCTION_TARGET("fma") void rbdKooNAllStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time)
 {
-    __m256d v4dTmp1, v4dTmp2;
-    __m256d v4dRes;
-
-    /* Load reliabilities and compute unreliabilities */
-    --n;
-    v4dRes = _mm256_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
-    v4dTmp1 = _mm256_sub_pd(v4dOnes, v4dRes);
-    /* Recursively compute the reliabilities */
-    if ((k-1) > 0) {
-        v4dTmp2 = rbdKooNRecursiveStepV4dFma3(data, time, n, k-1);
-        v4dRes = _mm256_mul_pd(v4dRes, v4dTmp2);
+    __m128d v2dA[data->numComponents + 1];
+    __m128d v2dR;
+    unsigned char n;
+    unsigned char k;
+
+    /* Initialize probability of having at least 0 working components out of no components */
+    v2dA[0] = v2dOnes;
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        v2dR = _mm_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
+        /* Compute probability of having all the first n+1 components working */
+        v2dA[n + 1] = _mm_mul_pd(v2dR, v2dA[n]);
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = n; k > 0; --k) {
+            v2dA[k] = _mm_fmadd_pd(v2dR, _mm_sub_pd(v2dA[k - 1], v2dA[k]), v2dA[k]);
+        }
     }
-    if (k <= n) {
-        v4dTmp2 = rbdKooNRecursiveStepV4dFma3(data, time, n, k);
-        v4dRes = _mm256_fmadd_pd(v4dTmp1, v4dTmp2, v4dRes);
+
+    /* For each K in [1, N]... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Cap the computed reliability and set it into output matrix */
+        _mm_storeu_pd(&data->output[(n * data->numTimes) + time], capReliabilityV2dSse2(v2dA[n + 1]));
     }
-    return v4dRes;
 }
 
 /**
- * rbdKooNRecursiveStepV2dFma3
+ * rbdKooNIdenticalSuccessStepV2dFma3
  *
- * Recursive KooN RBD Step function with amd64 FMA3 128bit
+ * Identical KooN RBD Step function from working components with amd64 FMA3 128bit
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      struct rbdKooNIdenticalData *data
  *      unsigned int time
- *      unsigned char n
- *      unsigned char k
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the recursive KooN RBD function exploiting amd64 FMA3 128bit.
- *  It is responsible to recursively compute the reliability of a KooN RBD system
+ *  This function implements the identical KooN RBD function exploiting amd64 FMA3 128bit.
+ *  It is responsible to compute the reliability of a KooN RBD system
+ *  taking into account the working components. The reliability is a polynomial of the reliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of unreliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
- *      n: current number of components in KooN RBD
- *      k: minimum number of working components in KooN RBD
  *
- * Return (__m128d):
- *  Computed reliability
+ * Return:
+ *  None
  */
-static FUNCTION_TARGET("fma") __m128d rbdKooNRecursiveStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k)
+HIDDEN FUNCTION_TARGET("fma") void rbdKooNIdenticalSuccessStepV2dFma3(struct rbdKooNIdenticalData *data, unsigned int time)
 {
-    __m128d v2dTmp1, v2dTmp2;
+    __m128d v2dR;
+    __m128d v2dU;
+    __m128d v2dPow;
     __m128d v2dRes;
+    unsigned int exponent;
+    int ii;
 
-    /* Load reliabilities and compute unreliabilities */
-    --n;
-    v2dRes = _mm_loadu_pd(&data->reliabilities[(n * data->numTimes) + time]);
-    v2dTmp1 = _mm_sub_pd(v2dOnes, v2dRes);
-    /* Recursively compute the reliabilities */
-    if ((k-1) > 0) {
-        v2dTmp2 = rbdKooNRecursiveStepV2dFma3(data, time, n, k-1);
-        v2dRes = _mm_mul_pd(v2dRes, v2dTmp2);
+    /* Retrieve reliability */
+    v2dR = _mm_loadu_pd(&data->reliabilities[time]);
+    /* Compute unreliability */
+    v2dU = _mm_sub_pd(v2dOnes, v2dR);
+
+    /* Initialize Horner accumulator to nCN, i.e. all components working */
+    v2dRes = _mm_set1_pd(data->nCi[data->numComponents - data->minComponents]);
+    /* Initialize power of unreliability to 1 */
+    v2dPow = v2dOnes;
+    /* For each number of working components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of unreliability of the other components */
+        v2dPow = _mm_mul_pd(v2dPow, v2dU);
+        /* Horner step: multiply accumulator for reliability and add nCi weighted by power of unreliability */
+        v2dRes = _mm_fmadd_pd(v2dRes, v2dR, _mm_mul_pd(_mm_set1_pd(data->nCi[ii]), v2dPow));
     }
-    if (k <= n) {
-        v2dTmp2 = rbdKooNRecursiveStepV2dFma3(data, time, n, k);
-        v2dRes = _mm_fmadd_pd(v2dTmp1, v2dTmp2, v2dRes);
+    /* Multiply accumulator for reliability of K working components through exponentiation by squaring */
+    v2dPow = v2dR;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            v2dRes = _mm_mul_pd(v2dRes, v2dPow);
+        }
+        v2dPow = _mm_mul_pd(v2dPow, v2dPow);
     }
-    return v2dRes;
+
+    /* Cap the computed reliability and set it into output array */
+    _mm_storeu_pd(&data->output[time], capReliabilityV2dSse2(v2dRes));
 }
 
 
@@ -29,225 +29,107 @@
 #include "../koon.h"
 
 
-static void *rbdKooNFillWorkerAvx512f(struct rbdKooNFillData *data);
-static void *rbdKooNFillWorkerAvx(struct rbdKooNFillData *data);
-static void *rbdKooNGenericWorkerAvx512f(struct rbdKooNGenericData *data);
-static void *rbdKooNGenericWorkerFma3(struct rbdKooNGenericData *data);
-static void *rbdKooNGenericWorkerAvx(struct rbdKooNGenericData *data);
-static void *rbdKooNIdenticalWorkerAvx512f(struct rbdKooNIdenticalData *data);
-static void *rbdKooNIdenticalWorkerFma3(struct rbdKooNIdenticalData *data);
-static void *rbdKooNIdenticalWorkerAvx(struct rbdKooNIdenticalData *data);
+static void *rbdKooNFillWorkerAvx512f(void *arg);
+static void *rbdKooNFillWorkerAvx(void *arg);
+static void *rbdKooNGenericWorkerAvx512f(void *arg);
+static void *rbdKooNGenericWorkerFma3(void *arg);
+static void *rbdKooNGenericWorkerAvx(void *arg);
+static void *rbdKooNIdenticalWorkerAvx512f(void *arg);
+static void *rbdKooNIdenticalWorkerFma3(void *arg);
+static void *rbdKooNIdenticalWorkerAvx(void *arg);
+static void *rbdKooNAllWorkerAvx512f(void *arg);
+static void *rbdKooNAllWorkerFma3(void *arg);
+static void *rbdKooNAllWorkerAvx(void *arg);
 
 
 /**
- * rbdKooNFillWorker
+ * rbdKooNResolveWorkers
  *
- * Fill output Reliability with fixed value Worker function with amd64 platform-specific instruction sets
+ * Resolve KooN RBD Workers with amd64 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function fills Reliability with fixed value for KooN Worker amd64 platform-specific instruction sets.
- *  It is responsible to fill a given batch of output Reliabilities with a given fixed value
+ *  This function selects, for each KooN RBD Worker, the implementation exploiting the widest
+ *  amd64 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a fill KooN data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdKooNFillWorker(void *arg)
+HIDDEN void rbdKooNResolveWorkers(void)
 {
-    struct rbdKooNFillData *data;
-    unsigned int time;
-
-    /* Retrieve fill KooN RBD data */
-    data = (struct rbdKooNFillData *)arg;
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-
+    /* Resolve fill KooN output Worker */
     if (amd64Avx512fSupported()) {
-        return rbdKooNFillWorkerAvx512f(data);
+        koonWorkers.fillWorker = &rbdKooNFillWorkerAvx512f;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdKooNFillWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        koonWorkers.fillWorker = &rbdKooNFillWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdKooNFillWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        koonWorkers.fillWorker = &rbdKooNFillWorkerSse2;
     }
-
-    /* For each time instant... */
-    while (time < data->numTimes) {
-        /* Fill output Reliability array with fixed value */
-        data->output[time] = data->value;
-        time += data->numCores;
+    else {
+        koonWorkers.fillWorker = &rbdKooNFillWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdKooNGenericWorker
- *
- * Generic KooN RBD Worker function with amd64 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the generic KooN RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a generic KooN RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of KooN RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdKooNGenericWorker(void *arg)
-{
-    struct rbdKooNGenericData *data;
-    unsigned int time;
-
-    /* Retrieve generic KooN RBD data */
-    data = (struct rbdKooNGenericData *)arg;
-
+    /* Resolve generic KooN RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdKooNGenericWorkerAvx512f(data);
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerAvx512f;
     }
-
-    if (amd64Fma3Supported()) {
-        return rbdKooNGenericWorkerFma3(data);
+    else if (amd64Fma3Supported()) {
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerFma3;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdKooNGenericWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdKooNGenericWorkerSse2(data);
-    }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    if (data->bRecursive == 0) {
-        /* If compute unreliability flag is not set... */
-        if (data->bComputeUnreliability == 0) {
-            /* For each time instant to be processed... */
-            while (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNGenericSuccessStepS1d(data, time);
-                /* Increment current time instant */
-                time += data->numCores;
-            }
-        }
-        else {
-            /* For each time instant to be processed... */
-            while (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNGenericFailStepS1d(data, time);
-                /* Increment current time instant */
-                time += data->numCores;
-            }
-        }
+    else if (amd64Sse2Supported()) {
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerSse2;
     }
     else {
-        /* For each time instant to be processed... */
-        while (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
-            /* Increment current time instant */
-            time += data->numCores;
-        }
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdKooNIdenticalWorker
- *
- * Identical KooN RBD Worker function with amd64 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical KooN RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system by using
- *  previously computed nCk values
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a identical KooN RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of KooN RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdKooNIdenticalWorker(void *arg)
-{
-    struct rbdKooNIdenticalData *data;
-    unsigned int time;
-
-    /* Retrieve identical KooN RBD data */
-    data = (struct rbdKooNIdenticalData *)arg;
-
+    /* Resolve identical KooN RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdKooNIdenticalWorkerAvx512f(data);
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerAvx512f;
     }
-
-    if (amd64Fma3Supported()) {
-        return rbdKooNIdenticalWorkerFma3(data);
+    else if (amd64Fma3Supported()) {
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerFma3;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdKooNIdenticalWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdKooNIdenticalWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerSse2;
+    }
+    else {
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerS1d;
     }
 
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* If compute unreliability flag is not set... */
-    if (data->bComputeUnreliability == 0) {
-        /* For each time instant to be processed... */
-        while (time < data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from working components */
-            rbdKooNIdenticalSuccessStepS1d(data, time);
-            /* Increment current time instant */
-            time += data->numCores;
-        }
+    /* Resolve all KooN RBDs Worker */
+    if (amd64Avx512fSupported()) {
+        koonWorkers.allWorker = &rbdKooNAllWorkerAvx512f;
+    }
+    else if (amd64Fma3Supported()) {
+        koonWorkers.allWorker = &rbdKooNAllWorkerFma3;
+    }
+    else if (amd64AvxSupported()) {
+        koonWorkers.allWorker = &rbdKooNAllWorkerAvx;
+    }
+    else if (amd64Sse2Supported()) {
+        koonWorkers.allWorker = &rbdKooNAllWorkerSse2;
     }
     else {
-        /* For each time instant to be processed... */
-        while (time < data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from failed components */
-            rbdKooNIdenticalFailStepS1d(data, time);
-            /* Increment current time instant */
-            time += data->numCores;
-        }
+        koonWorkers.allWorker = &rbdKooNAllWorkerS1d;
     }
-
-    return NULL;
 }
 
 /**
@@ -256,7 +138,7 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
  * Fill output Reliability with fixed value Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdKooNFillData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -266,53 +148,39 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
  *  It is responsible to fill a given batch of output Reliabilities with a given fixed value
  *
  * Parameters:
- *      data: the pointer to a fill KooN data
+ *      arg: this parameter shall be the pointer to a fill KooN data
  *
  * Return (void *):
  *  NULL
  */
-static FUNCTION_TARGET("avx512f") void *rbdKooNFillWorkerAvx512f(struct rbdKooNFillData *data)
+static FUNCTION_TARGET("avx512f") void *rbdKooNFillWorkerAvx512f(void *arg)
 {
+    struct rbdKooNFillData *data;
     unsigned int time;
     __m512d m512d;
-    __m256d m256d;
-    __m128d m128d;
+
+    /* Retrieve fill KooN RBD data */
+    data = (struct rbdKooNFillData *)arg;
 
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
-    /* Define vector (8d, 4d and 2d) with provided value */
+    /* Define vector (8d) with provided value */
     m512d = _mm512_set1_pd(data->value);
-    m256d = _mm256_set1_pd(data->value);
-    m128d = _mm_set1_pd(data->value);
 
     /* For each time instant (blocks of 8 time instants)... */
-    while ((time + V8D) <= data->numTimes) {
+    while ((time + V8D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
         /* Fill output Reliability array with fixed value */
         _mm512_storeu_pd(&data->output[time], m512d);
         /* Increment current time instant */
-        time += (data->numCores * V8D);
-    }
-    /* Are (at least) 4 time instants remaining? */
-    if ((time + V4D) <= data->numTimes) {
-        /* Fill output Reliability array with fixed value */
-        _mm256_storeu_pd(&data->output[time], m256d);
-        /* Increment current time instant */
-        time += V4D;
-    }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
-        /* Fill output Reliability array with fixed value */
-        _mm_storeu_pd(&data->output[time], m128d);
-        /* Increment current time instant */
-        time += V2D;
+        time += (data->batch.numBatches * V8D);
     }
-    /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
         /* Fill output Reliability array with fixed value */
-        data->output[time++] = data->value;
+        _mm512_mask_storeu_pd(&data->output[time], V8D_MASK(data->batch.tEnd - time), m512d);
     }
 
     return NULL;
@@ -324,7 +192,7 @@ static FUNCTION_TARGET("avx512f") void *rbdKooNFillWorkerAvx512f(struct rbdKooNF
  * Fill output Reliability with fixed value Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdKooNFillData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -334,42 +202,46 @@ static FUNCTION_TARGET("avx512f") void *rbdKooNFillWorkerAvx512f(struct rbdKooNF
  *  It is responsible to fill a given batch of output Reliabilities with a given fixed value
  *
  * Parameters:
- *      data: the pointer to a fill KooN data
+ *      arg: this parameter shall be the pointer to a fill KooN data
  *
  * Return (void *):
  *  NULL
  */
-static FUNCTION_TARGET("avx") void *rbdKooNFillWorkerAvx(struct rbdKooNFillData *data)
+static FUNCTION_TARGET("avx") void *rbdKooNFillWorkerAvx(void *arg)
 {
+    struct rbdKooNFillData *data;
     unsigned int time;
     __m256d m256d;
     __m128d m128d;
 
+    /* Retrieve fill KooN RBD data */
+    data = (struct rbdKooNFillData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* Define vectors (4d and 2d) with provided value */
     m256d = _mm256_set1_pd(data->value);
     m128d = _mm_set1_pd(data->value);
 
     /* For each time instant (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Fill output Reliability array with fixed value */
         _mm256_storeu_pd(&data->output[time], m256d);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Fill output Reliability array with fixed value */
         _mm_storeu_pd(&data->output[time], m128d);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Fill output Reliability array with fixed value */
         data->output[time++] = data->value;
     }
@@ -383,7 +255,7 @@ static FUNCTION_TARGET("avx") void *rbdKooNFillWorkerAvx(struct rbdKooNFillData
  * Generic KooN RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -393,112 +265,90 @@ static FUNCTION_TARGET("avx") void *rbdKooNFillWorkerAvx(struct rbdKooNFillData
  *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system
  *
  * Parameters:
- *      data: the pointer to a generic KooN RBD data
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdKooNGenericWorkerAvx512f(struct rbdKooNGenericData *data)
+static void *rbdKooNGenericWorkerAvx512f(void *arg)
 {
+    struct rbdKooNGenericData *data;
     unsigned int time;
 
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
-    if (data->bRecursive == 0) {
+    if (data->bDynamic == 0) {
         /* If compute unreliability flag is not set... */
         if (data->bComputeUnreliability == 0) {
             /* For each time instant to be processed (blocks of 8 time instants)... */
-            while ((time + V8D) <= data->numTimes) {
+            while ((time + V8D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V8D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
                 /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNGenericSuccessStepV8dAvx512f(data, time);
+                rbdKooNGenericSuccessStepV8dAvx512f(data, time, V8D_MASK(V8D));
                 /* Increment current time instant */
-                time += (data->numCores * V8D);
+                time += (data->batch.numBatches * V8D);
             }
-            /* Are (at least) 4 time instants remaining? */
-            if ((time + V4D) <= data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNGenericSuccessStepV4dFma3(data, time);
-                /* Increment current time instant */
-                time += V4D;
-            }
-            /* Are (at least) 2 time instants remaining? */
-            if ((time + V2D) <= data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNGenericSuccessStepV2dFma3(data, time);
-                /* Increment current time instant */
-                time += V2D;
-            }
-            /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNGenericSuccessStepS1d(data, time);
+            /* Are (at most) 7 time instants remaining? */
+            if (time < data->batch.tEnd) {
+                /* Are remaining time instants too few to fill the lanes, while combinations are enough? */
+                if (((data->batch.tEnd - time) <= KOON_LANES_MAX_TIMES) && (data->numComponents <= KOON_LANES_MAX_COMPONENTS) &&
+                    ((data->combEnd - data->combBegin) >= KOON_LANES_MIN_COMBINATIONS)) {
+                    /* Compute reliability of KooN RBD at remaining time instants filling the lanes with combinations */
+                    rbdKooNGenericLanesStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
+                }
+                else {
+                    /* Compute reliability of KooN RBD at current time instant from working components */
+                    rbdKooNGenericSuccessStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
+                }
             }
         }
         else {
             /* For each time instant to be processed (blocks of 8 time instants)... */
-            while ((time + V8D) <= data->numTimes) {
+            while ((time + V8D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V8D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNGenericFailStepV8dAvx512f(data, time);
-                /* Increment current time instant */
-                time += (data->numCores * V8D);
-            }
-            /* Are (at least) 4 time instants remaining? */
-            if ((time + V4D) <= data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNGenericFailStepV4dFma3(data, time);
-                /* Increment current time instant */
-                time += V4D;
-            }
-            /* Are (at least) 2 time instants remaining? */
-            if ((time + V2D) <= data->numTimes) {
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
                 /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNGenericFailStepV2dFma3(data, time);
+                rbdKooNGenericFailStepV8dAvx512f(data, time, V8D_MASK(V8D));
                 /* Increment current time instant */
-                time += V2D;
+                time += (data->batch.numBatches * V8D);
             }
-            /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNGenericFailStepS1d(data, time);
+            /* Are (at most) 7 time instants remaining? */
+            if (time < data->batch.tEnd) {
+                /* Are remaining time instants too few to fill the lanes, while combinations are enough? */
+                if (((data->batch.tEnd - time) <= KOON_LANES_MAX_TIMES) && (data->numComponents <= KOON_LANES_MAX_COMPONENTS) &&
+                    ((data->combEnd - data->combBegin) >= KOON_LANES_MIN_COMBINATIONS)) {
+                    /* Compute reliability of KooN RBD at remaining time instants filling the lanes with combinations */
+                    rbdKooNGenericLanesStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
+                }
+                else {
+                    /* Compute reliability of KooN RBD at current time instant from failed components */
+                    rbdKooNGenericFailStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
+                }
             }
         }
     }
     else {
         /* For each time instant to be processed (blocks of 8 time instants)... */
-        while ((time + V8D) <= data->numTimes) {
+        while ((time + V8D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V8D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV8dAvx512f(data, time);
+            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV8dAvx512f(data, time, V8D_MASK(V8D));
             /* Increment current time instant */
-            time += (data->numCores * V8D);
+            time += (data->batch.numBatches * V8D);
         }
-        /* Are (at least) 4 time instants remaining? */
-        if ((time + V4D) <= data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV4dFma3(data, time);
-            /* Increment current time instant */
-            time += V4D;
-        }
-        /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV2dFma3(data, time);
-            /* Increment current time instant */
-            time += V2D;
-        }
-        /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
+        /* Are (at most) 7 time instants remaining? */
+        if (time < data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
         }
     }
 
@@ -511,7 +361,7 @@ static void *rbdKooNGenericWorkerAvx512f(struct rbdKooNGenericData *data)
  * Generic KooN RBD Worker function with amd64 FMA3 instruction set
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -521,64 +371,68 @@ static void *rbdKooNGenericWorkerAvx512f(struct rbdKooNGenericData *data)
  *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system
  *
  * Parameters:
- *      data: the pointer to a generic KooN RBD data
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdKooNGenericWorkerFma3(struct rbdKooNGenericData *data)
+static void *rbdKooNGenericWorkerFma3(void *arg)
 {
+    struct rbdKooNGenericData *data;
     unsigned int time;
 
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
-    if (data->bRecursive == 0) {
+    if (data->bDynamic == 0) {
         /* If compute unreliability flag is not set... */
         if (data->bComputeUnreliability == 0) {
             /* For each time instant to be processed (blocks of 4 time instants)... */
-            while ((time + V4D) <= data->numTimes) {
+            while ((time + V4D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepV4dFma3(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V4D);
+                time += (data->batch.numBatches * V4D);
             }
             /* Are (at least) 2 time instants remaining? */
-            if ((time + V2D) <= data->numTimes) {
+            if ((time + V2D) <= data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepV2dFma3(data, time);
                 /* Increment current time instant */
                 time += V2D;
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepS1d(data, time);
             }
         }
         else {
             /* For each time instant to be processed (blocks of 4 time instants)... */
-            while ((time + V4D) <= data->numTimes) {
+            while ((time + V4D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepV4dFma3(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V4D);
+                time += (data->batch.numBatches * V4D);
             }
             /* Are (at least) 2 time instants remaining? */
-            if ((time + V2D) <= data->numTimes) {
+            if ((time + V2D) <= data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepV2dFma3(data, time);
                 /* Increment current time instant */
                 time += V2D;
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepS1d(data, time);
             }
@@ -587,40 +441,40 @@ static void *rbdKooNGenericWorkerFma3(struct rbdKooNGenericData *data)
     else {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
-                /* Recursively compute reliability of KooN RBD at current time instant */
-                rbdKooNRecursionS1d(data, time);
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
+                /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+                rbdKooNDynamicStepS1d(data, time);
                 /* Increment current time instant */
                 time += S1D;
             }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
-                /* Recursively compute reliability of KooN RBD at current time instant */
-                rbdKooNRecursionV2dFma3(data, time);
+            if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
+                /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+                rbdKooNDynamicStepV2dFma3(data, time);
                 /* Increment current time instant */
                 time += V2D;
             }
         }
         /* For each time instant to be processed (blocks of 4 time instants)... */
-        while ((time + V4D) <= data->numTimes) {
+        while ((time + V4D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV4dFma3(data, time);
+            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV4dFma3(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V4D);
+            time += (data->batch.numBatches * V4D);
         }
         /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV2dFma3(data, time);
+        if ((time + V2D) <= data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV2dFma3(data, time);
             /* Increment current time instant */
             time += V2D;
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
+        if (time < data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepS1d(data, time);
         }
     }
 
@@ -633,7 +487,7 @@ static void *rbdKooNGenericWorkerFma3(struct rbdKooNGenericData *data)
  * Generic KooN RBD Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -643,64 +497,68 @@ static void *rbdKooNGenericWorkerFma3(struct rbdKooNGenericData *data)
  *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system
  *
  * Parameters:
- *      data: the pointer to a generic KooN RBD data
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdKooNGenericWorkerAvx(struct rbdKooNGenericData *data)
+static void *rbdKooNGenericWorkerAvx(void *arg)
 {
+    struct rbdKooNGenericData *data;
     unsigned int time;
 
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
-    if (data->bRecursive == 0) {
+    if (data->bDynamic == 0) {
         /* If compute unreliability flag is not set... */
         if (data->bComputeUnreliability == 0) {
             /* For each time instant to be processed (blocks of 4 time instants)... */
-            while ((time + V4D) <= data->numTimes) {
+            while ((time + V4D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepV4dAvx(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V4D);
+                time += (data->batch.numBatches * V4D);
             }
             /* Are (at least) 2 time instants remaining? */
-            if ((time + V2D) <= data->numTimes) {
+            if ((time + V2D) <= data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepV2dSse2(data, time);
                 /* Increment current time instant */
                 time += V2D;
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepS1d(data, time);
             }
         }
         else {
             /* For each time instant to be processed (blocks of 4 time instants)... */
-            while ((time + V4D) <= data->numTimes) {
+            while ((time + V4D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepV4dAvx(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V4D);
+                time += (data->batch.numBatches * V4D);
             }
             /* Are (at least) 2 time instants remaining? */
-            if ((time + V2D) <= data->numTimes) {
+            if ((time + V2D) <= data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepV2dSse2(data, time);
                 /* Increment current time instant */
                 time += V2D;
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepS1d(data, time);
             }
@@ -709,53 +567,105 @@ static void *rbdKooNGenericWorkerAvx(struct rbdKooNGenericData *data)
     else {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
-                /* Recursively compute reliability of KooN RBD at current time instant */
-                rbdKooNRecursionS1d(data, time);
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
+                /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+                rbdKooNDynamicStepS1d(data, time);
                 /* Increment current time instant */
                 time += S1D;
             }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
-                /* Recursively compute reliability of KooN RBD at current time instant */
-                rbdKooNRecursionV2dSse2(data, time);
+            if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
+                /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+                rbdKooNDynamicStepV2dSse2(data, time);
                 /* Increment current time instant */
                 time += V2D;
             }
         }
         /* For each time instant to be processed (blocks of 4 time instants)... */
-        while ((time + V4D) <= data->numTimes) {
+        while ((time + V4D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV4dAvx(data, time);
+            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV4dAvx(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V4D);
+            time += (data->batch.numBatches * V4D);
         }
         /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV2dSse2(data, time);
+        if ((time + V2D) <= data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV2dSse2(data, time);
             /* Increment current time instant */
             time += V2D;
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
+        if (time < data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepS1d(data, time);
         }
     }
 
     return NULL;
 }
 
+/**
+ * rbdKooNAllWorkerAvx512f
+ *
+ * All KooN RBDs Worker function with amd64 AVX512F instruction set
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the all KooN RBDs Worker exploiting amd64 AVX512F instruction set.
+ *  It is responsible to compute the reliabilities over a given batch of the KooN RBD systems
+ *  with K in [1, N] sharing the same components
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *rbdKooNAllWorkerAvx512f(void *arg)
+{
+    struct rbdKooNGenericData *data;
+    unsigned int time;
+
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
+    /* Retrieve first time instant to be processed by worker */
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
+
+    /* For each time instant to be processed (blocks of 8 time instants)... */
+    while ((time + V8D) <= data->batch.tEnd) {
+        /* Prefetch for next iteration */
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+        prefetchWrite(data->output, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV8dAvx512f(data, time, V8D_MASK(V8D));
+        /* Increment current time instant */
+        time += (data->batch.numBatches * V8D);
+    }
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
+    }
+
+    return NULL;
+}
+
 /**
  * rbdKooNIdenticalWorkerAvx512f
  *
  * Identical KooN RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -766,134 +676,150 @@ static void *rbdKooNGenericWorkerAvx(struct rbdKooNGenericData *data)
  *  previously computed nCk values
  *
  * Parameters:
- *      data: the pointer to a identical KooN RBD data
+ *      arg: this parameter shall be the pointer to a identical KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdKooNIdenticalWorkerAvx512f(struct rbdKooNIdenticalData *data)
+static void *rbdKooNIdenticalWorkerAvx512f(void *arg)
 {
+    struct rbdKooNIdenticalData *data;
     unsigned int time;
+    unsigned int head;
+
+    /* Retrieve identical KooN RBD data */
+    data = (struct rbdKooNIdenticalData *)arg;
 
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
     /* If compute unreliability flag is not set... */
     if (data->bComputeUnreliability == 0) {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNIdenticalSuccessStepS1d(data, time);
-                /* Increment current time instant */
-                time += S1D;
-            }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+            /* Compute number of time instants preceding the first aligned one */
+            head = (unsigned int)(((V8D * sizeof(double)) - ((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1))) / sizeof(double)) & (V8D - 1);
+            if ((head != 0) && ((time + head) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNIdenticalSuccessStepV2dFma3(data, time);
+                rbdKooNIdenticalSuccessStepV8dAvx512f(data, time, V8D_MASK(head));
                 /* Increment current time instant */
-                time += V2D;
-            }
-            if (((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1)) != 0) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNIdenticalSuccessStepV4dFma3(data, time);
-                /* Increment current time instant */
-                time += V4D;
+                time += head;
             }
         }
         /* For each time instant to be processed (blocks of 8 time instants)... */
-        while ((time + V8D) <= data->numTimes) {
+        while ((time + V8D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V8D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V8D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
             /* Compute reliability of KooN RBD at current time instant from working components */
-            rbdKooNIdenticalSuccessStepV8dAvx512f(data, time);
+            rbdKooNIdenticalSuccessStepV8dAvx512f(data, time, V8D_MASK(V8D));
             /* Increment current time instant */
-            time += (data->numCores * V8D);
+            time += (data->batch.numBatches * V8D);
         }
-        /* Are (at least) 4 time instants remaining? */
-        if ((time + V4D) <= data->numTimes) {
+        /* Are (at most) 7 time instants remaining? */
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
-            rbdKooNIdenticalSuccessStepV4dFma3(data, time);
-            /* Increment current time instant */
-            time += V4D;
-        }
-        /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from working components */
-            rbdKooNIdenticalSuccessStepV2dFma3(data, time);
-            /* Increment current time instant */
-            time += V2D;
-        }
-        /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from working components */
-            rbdKooNIdenticalSuccessStepS1d(data, time);
+            rbdKooNIdenticalSuccessStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
         }
     }
     else {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNIdenticalFailStepS1d(data, time);
-                /* Increment current time instant */
-                time += S1D;
-            }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNIdenticalFailStepV2dSse2(data, time);
-                /* Increment current time instant */
-                time += V2D;
-            }
-            if (((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1)) != 0) {
+            /* Compute number of time instants preceding the first aligned one */
+            head = (unsigned int)(((V8D * sizeof(double)) - ((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1))) / sizeof(double)) & (V8D - 1);
+            if ((head != 0) && ((time + head) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNIdenticalFailStepV4dAvx(data, time);
+                rbdKooNIdenticalFailStepV8dAvx512f(data, time, V8D_MASK(head));
                 /* Increment current time instant */
-                time += V4D;
+                time += head;
             }
         }
         /* For each time instant to be processed (blocks of 8 time instants)... */
-        while ((time + V8D) <= data->numTimes) {
+        while ((time + V8D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V8D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V8D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
             /* Compute reliability of KooN RBD at current time instant from failed components */
-            rbdKooNIdenticalFailStepV8dAvx512f(data, time);
+            rbdKooNIdenticalFailStepV8dAvx512f(data, time, V8D_MASK(V8D));
             /* Increment current time instant */
-            time += (data->numCores * V8D);
+            time += (data->batch.numBatches * V8D);
         }
-        /* Are (at least) 4 time instants remaining? */
-        if ((time + V4D) <= data->numTimes) {
+        /* Are (at most) 7 time instants remaining? */
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
-            rbdKooNIdenticalFailStepV4dAvx(data, time);
-            /* Increment current time instant */
-            time += V4D;
-        }
-        /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from failed components */
-            rbdKooNIdenticalFailStepV2dSse2(data, time);
-            /* Increment current time instant */
-            time += V2D;
-        }
-        /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from failed components */
-            rbdKooNIdenticalFailStepS1d(data, time);
+            rbdKooNIdenticalFailStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
         }
     }
 
     return NULL;
 }
 
+/**
+ * rbdKooNAllWorkerFma3
+ *
+ * All KooN RBDs Worker function with amd64 FMA3 instruction set
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the all KooN RBDs Worker exploiting amd64 FMA3 instruction set.
+ *  It is responsible to compute the reliabilities over a given batch of the KooN RBD systems
+ *  with K in [1, N] sharing the same components
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *rbdKooNAllWorkerFma3(void *arg)
+{
+    struct rbdKooNGenericData *data;
+    unsigned int time;
+
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
+    /* Retrieve first time instant to be processed by worker */
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
+
+    /* For each time instant to be processed (blocks of 4 time instants)... */
+    while ((time + V4D) <= data->batch.tEnd) {
+        /* Prefetch for next iteration */
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV4dFma3(data, time);
+        /* Increment current time instant */
+        time += (data->batch.numBatches * V4D);
+    }
+    /* Are (at least) 2 time instants remaining? */
+    if ((time + V2D) <= data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV2dFma3(data, time);
+        /* Increment current time instant */
+        time += V2D;
+    }
+    /* Is 1 time instant remaining? */
+    if (time < data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepS1d(data, time);
+    }
+
+    return NULL;
+}
+
 /**
  * rbdKooNIdenticalWorkerFma3
  *
  * Identical KooN RBD Worker function with amd64 FMA3 instruction set
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -904,29 +830,33 @@ static void *rbdKooNIdenticalWorkerAvx512f(struct rbdKooNIdenticalData *data)
  *  previously computed nCk values
  *
  * Parameters:
- *      data: the pointer to a identical KooN RBD data
+ *      arg: this parameter shall be the pointer to a identical KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdKooNIdenticalWorkerFma3(struct rbdKooNIdenticalData *data)
+static void *rbdKooNIdenticalWorkerFma3(void *arg)
 {
+    struct rbdKooNIdenticalData *data;
     unsigned int time;
 
+    /* Retrieve identical KooN RBD data */
+    data = (struct rbdKooNIdenticalData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* If compute unreliability flag is not set... */
     if (data->bComputeUnreliability == 0) {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNIdenticalSuccessStepS1d(data, time);
                 /* Increment current time instant */
                 time += S1D;
             }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNIdenticalSuccessStepV2dFma3(data, time);
                 /* Increment current time instant */
@@ -934,24 +864,24 @@ static void *rbdKooNIdenticalWorkerFma3(struct rbdKooNIdenticalData *data)
             }
         }
         /* For each time instant to be processed (blocks of 4 time instants)... */
-        while ((time + V4D) <= data->numTimes) {
+        while ((time + V4D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepV4dFma3(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V4D);
+            time += (data->batch.numBatches * V4D);
         }
         /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
+        if ((time + V2D) <= data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepV2dFma3(data, time);
             /* Increment current time instant */
             time += V2D;
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepS1d(data, time);
         }
@@ -959,13 +889,13 @@ static void *rbdKooNIdenticalWorkerFma3(struct rbdKooNIdenticalData *data)
     else {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNIdenticalFailStepS1d(data, time);
                 /* Increment current time instant */
                 time += S1D;
             }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNIdenticalFailStepV2dSse2(data, time);
                 /* Increment current time instant */
@@ -973,24 +903,24 @@ static void *rbdKooNIdenticalWorkerFma3(struct rbdKooNIdenticalData *data)
             }
         }
         /* For each time instant to be processed (blocks of 4 time instants)... */
-        while ((time + V4D) <= data->numTimes) {
+        while ((time + V4D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepV4dAvx(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V4D);
+            time += (data->batch.numBatches * V4D);
         }
         /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
+        if ((time + V2D) <= data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepV2dSse2(data, time);
             /* Increment current time instant */
             time += V2D;
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepS1d(data, time);
         }
@@ -999,13 +929,72 @@ static void *rbdKooNIdenticalWorkerFma3(struct rbdKooNIdenticalData *data)
     return NULL;
 }
 
+/**
+ * rbdKooNAllWorkerAvx
+ *
+ * All KooN RBDs Worker function with amd64 AVX instruction set
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the all KooN RBDs Worker exploiting amd64 AVX instruction set.
+ *  It is responsible to compute the reliabilities over a given batch of the KooN RBD systems
+ *  with K in [1, N] sharing the same components
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *rbdKooNAllWorkerAvx(void *arg)
+{
+    struct rbdKooNGenericData *data;
+    unsigned int time;
+
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
+    /* Retrieve first time instant to be processed by worker */
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
+
+    /* For each time instant to be processed (blocks of 4 time instants)... */
+    while ((time + V4D) <= data->batch.tEnd) {
+        /* Prefetch for next iteration */
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV4dAvx(data, time);
+        /* Increment current time instant */
+        time += (data->batch.numBatches * V4D);
+    }
+    /* Are (at least) 2 time instants remaining? */
+    if ((time + V2D) <= data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV2dSse2(data, time);
+        /* Increment current time instant */
+        time += V2D;
+    }
+    /* Is 1 time instant remaining? */
+    if (time < data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepS1d(data, time);
+    }
+
+    return NULL;
+}
+
 /**
  * rbdKooNIdenticalWorkerAvx
  *
  * Identical KooN RBD Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -1016,29 +1005,33 @@ static void *rbdKooNIdenticalWorkerFma3(struct rbdKooNIdenticalData *data)
  *  previously computed nCk values
  *
  * Parameters:
- *      data: the pointer to a identical KooN RBD data
+ *      arg: this parameter shall be the pointer to a identical KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdKooNIdenticalWorkerAvx(struct rbdKooNIdenticalData *data)
+static void *rbdKooNIdenticalWorkerAvx(void *arg)
 {
+    struct rbdKooNIdenticalData *data;
     unsigned int time;
 
+    /* Retrieve identical KooN RBD data */
+    data = (struct rbdKooNIdenticalData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* If compute unreliability flag is not set... */
     if (data->bComputeUnreliability == 0) {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNIdenticalSuccessStepS1d(data, time);
                 /* Increment current time instant */
                 time += S1D;
             }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNIdenticalSuccessStepV2dSse2(data, time);
                 /* Increment current time instant */
@@ -1046,24 +1039,24 @@ static void *rbdKooNIdenticalWorkerAvx(struct rbdKooNIdenticalData *data)
             }
         }
         /* For each time instant to be processed (blocks of 4 time instants)... */
-        while ((time + V4D) <= data->numTimes) {
+        while ((time + V4D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepV4dAvx(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V4D);
+            time += (data->batch.numBatches * V4D);
         }
         /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
+        if ((time + V2D) <= data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepV2dSse2(data, time);
             /* Increment current time instant */
             time += V2D;
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepS1d(data, time);
         }
@@ -1071,13 +1064,13 @@ static void *rbdKooNIdenticalWorkerAvx(struct rbdKooNIdenticalData *data)
     else {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNIdenticalFailStepS1d(data, time);
                 /* Increment current time instant */
                 time += S1D;
             }
-            if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNIdenticalFailStepV2dSse2(data, time);
                 /* Increment current time instant */
@@ -1085,24 +1078,24 @@ static void *rbdKooNIdenticalWorkerAvx(struct rbdKooNIdenticalData *data)
             }
         }
         /* For each time instant to be processed (blocks of 4 time instants)... */
-        while ((time + V4D) <= data->numTimes) {
+        while ((time + V4D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepV4dAvx(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V4D);
+            time += (data->batch.numBatches * V4D);
         }
         /* Are (at least) 2 time instants remaining? */
-        if ((time + V2D) <= data->numTimes) {
+        if ((time + V2D) <= data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepV2dSse2(data, time);
             /* Increment current time instant */
             time += V2D;
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepS1d(data, time);
         }
@@ -24,33 +24,44 @@
 
 
 #include "../generic/rbd_internal_generic.h"
+#include "rbd_internal_amd64.h"
 #include "../koon.h"
 
 
+#define KOON_LANES_MAX_COMPONENTS       (64)    /* Maximum number of components of KooN RBD Step over combinations (bitmask of 64 bits) */
+#define KOON_LANES_MAX_TIMES            (3)     /* Maximum number of time instants computed through KooN RBD Step over combinations */
+#define KOON_LANES_MIN_COMBINATIONS     (128)   /* Minimum number of combinations computed through KooN RBD Step over combinations */
+
+
 #if defined(ARCH_AMD64) && (CPU_ENABLE_SIMD != 0)
 /* Platform-specific functions for amd64 AVX instruction set */
 void rbdKooNGenericSuccessStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNGenericFailStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNRecursionV4dAvx(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNDynamicStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNAllStepV4dAvx(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNIdenticalSuccessStepV4dAvx(struct rbdKooNIdenticalData *data, unsigned int time);
 void rbdKooNIdenticalFailStepV4dAvx(struct rbdKooNIdenticalData *data, unsigned int time);
 
 /* Platform-specific functions for amd64 FMA3 instruction set */
 void rbdKooNGenericSuccessStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNGenericFailStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNRecursionV4dFma3(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNDynamicStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNAllStepV4dFma3(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNIdenticalSuccessStepV4dFma3(struct rbdKooNIdenticalData *data, unsigned int time);
 void rbdKooNGenericSuccessStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNGenericFailStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNRecursionV2dFma3(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNDynamicStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNAllStepV2dFma3(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNIdenticalSuccessStepV2dFma3(struct rbdKooNIdenticalData *data, unsigned int time);
 
 /* Platform-specific functions for amd64 AVX512F instruction set */
-void rbdKooNGenericSuccessStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNGenericFailStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNRecursionV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNIdenticalSuccessStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time);
-void rbdKooNIdenticalFailStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time);
+void rbdKooNGenericSuccessStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask);
+void rbdKooNGenericFailStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask);
+void rbdKooNGenericLanesStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask);
+void rbdKooNDynamicStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask);
+void rbdKooNAllStepV8dAvx512f(struct rbdKooNGenericData *data, unsigned int time, __mmask8 mask);
+void rbdKooNIdenticalSuccessStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time, __mmask8 mask);
+void rbdKooNIdenticalFailStepV8dAvx512f(struct rbdKooNIdenticalData *data, unsigned int time, __mmask8 mask);
 #endif /* defined(ARCH_AMD64) && (CPU_ENABLE_SIMD != 0) */
 
 
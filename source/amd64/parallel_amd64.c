@@ -29,127 +29,67 @@
 #include "../parallel.h"
 
 
-static void *rbdParallelGenericWorkerAvx512f(struct rbdParallelData *data);
-static void *rbdParallelGenericWorkerFma3(struct rbdParallelData *data);
-static void *rbdParallelGenericWorkerAvx(struct rbdParallelData *data);
-static void *rbdParallelIdenticalWorkerAvx512f(struct rbdParallelData *data);
+static void *rbdParallelGenericWorkerAvx512f(void *arg);
+static void *rbdParallelGenericWorkerFma3(void *arg);
+static void *rbdParallelGenericWorkerAvx(void *arg);
+static void *rbdParallelIdenticalWorkerAvx512f(void *arg);
 static void *rbdParallelIdenticalWorkerAvx(void *arg);
 
 
 /**
- * rbdParallelGenericWorker
+ * rbdParallelResolveWorkers
  *
- * Parallel RBD Worker function with amd64 platform-specific instruction sets
+ * Resolve Parallel RBD Workers with amd64 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the generic Parallel RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a Parallel RBD system
+ *  This function selects, for each Parallel RBD Worker, the implementation exploiting the widest
+ *  amd64 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a Parallel RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Parallel RBD
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdParallelGenericWorker(void *arg)
+HIDDEN void rbdParallelResolveWorkers(void)
 {
-    struct rbdParallelData *data;
-    unsigned int time;
-
-    /* Retrieve Parallel RBD data */
-    data = (struct rbdParallelData *)arg;
-
+    /* Resolve generic Parallel RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdParallelGenericWorkerAvx512f(data);
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerAvx512f;
     }
-
-    if (amd64Fma3Supported()) {
-        return rbdParallelGenericWorkerFma3(data);
+    else if (amd64Fma3Supported()) {
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerFma3;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdParallelGenericWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdParallelGenericWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelGenericStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdParallelIdenticalWorker
- *
- * Identical Parallel RBD Worker function with amd64 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical Parallel RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of an identical Parallel RBD system
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a Parallel RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Parallel RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdParallelIdenticalWorker(void *arg)
-{
-    struct rbdParallelData *data;
-    unsigned int time;
-
-    /* Retrieve Parallel RBD data */
-    data = (struct rbdParallelData *)arg;
-
+    /* Resolve identical Parallel RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdParallelIdenticalWorkerAvx512f(data);
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerAvx512f;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdParallelIdenticalWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdParallelIdenticalWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelIdenticalStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerS1d;
     }
-
-    return NULL;
 }
 
 /**
@@ -158,7 +98,7 @@ HIDDEN void *rbdParallelIdenticalWorker(void *arg)
  * Parallel RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdParallelData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -168,46 +108,36 @@ HIDDEN void *rbdParallelIdenticalWorker(void *arg)
  *  It is responsible to compute the reliabilities over a given batch of a Parallel RBD system
  *
  * Parameters:
- *      data: the pointer to a Parallel RBD data
+ *      arg: this parameter shall be the pointer to a Parallel RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdParallelGenericWorkerAvx512f(struct rbdParallelData *data)
+static void *rbdParallelGenericWorkerAvx512f(void *arg)
 {
+    struct rbdParallelData *data;
     unsigned int time;
 
+    /* Retrieve Parallel RBD data */
+    data = (struct rbdParallelData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
     /* For each time instant to be processed (blocks of 8 time instants)... */
-    while ((time + V8D) <= data->numTimes) {
+    while ((time + V8D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V8D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
         /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelGenericStepV8dAvx512f(data, time);
-        /* Increment current time instant */
-        time += (data->numCores * V8D);
-    }
-    /* Are (at least) 4 time instants remaining? */
-    if ((time + V4D) <= data->numTimes) {
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelGenericStepV4dFma3(data, time);
+        rbdParallelGenericStepV8dAvx512f(data, time, V8D_MASK(V8D));
         /* Increment current time instant */
-        time += V4D;
+        time += (data->batch.numBatches * V8D);
     }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelGenericStepV2dFma3(data, time);
-        /* Increment current time instant */
-        time += V2D;
-    }
-    /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelGenericStepS1d(data, time);
+        rbdParallelGenericStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
     }
 
     return NULL;
@@ -219,7 +149,7 @@ static void *rbdParallelGenericWorkerAvx512f(struct rbdParallelData *data)
  * Parallel RBD Worker function with amd64 FMA3 instruction set
  *
  * Input:
- *      struct rbdParallelData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -229,37 +159,41 @@ static void *rbdParallelGenericWorkerAvx512f(struct rbdParallelData *data)
  *  It is responsible to compute the reliabilities over a given batch of a Parallel RBD system
  *
  * Parameters:
- *      data: the pointer to a Parallel RBD data
+ *      arg: this parameter shall be the pointer to a Parallel RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdParallelGenericWorkerFma3(struct rbdParallelData *data)
+static void *rbdParallelGenericWorkerFma3(void *arg)
 {
+    struct rbdParallelData *data;
     unsigned int time;
 
+    /* Retrieve Parallel RBD data */
+    data = (struct rbdParallelData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepV4dFma3(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepV2dFma3(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepS1d(data, time);
     }
@@ -273,7 +207,7 @@ static void *rbdParallelGenericWorkerFma3(struct rbdParallelData *data)
  * Parallel RBD Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdParallelData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -283,37 +217,41 @@ static void *rbdParallelGenericWorkerFma3(struct rbdParallelData *data)
  *  It is responsible to compute the reliabilities over a given batch of a Parallel RBD system
  *
  * Parameters:
- *      data: the pointer to a Parallel RBD data
+ *      arg: this parameter shall be the pointer to a Parallel RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdParallelGenericWorkerAvx(struct rbdParallelData *data)
+static void *rbdParallelGenericWorkerAvx(void *arg)
 {
+    struct rbdParallelData *data;
     unsigned int time;
 
+    /* Retrieve Parallel RBD data */
+    data = (struct rbdParallelData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepV4dAvx(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepV2dSse2(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepS1d(data, time);
     }
@@ -327,7 +265,7 @@ static void *rbdParallelGenericWorkerAvx(struct rbdParallelData *data)
  * Identical Parallel RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdParallelData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -337,67 +275,48 @@ static void *rbdParallelGenericWorkerAvx(struct rbdParallelData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Parallel RBD system
  *
  * Parameters:
- *      data: the pointer to a Parallel RBD data
+ *      arg: this parameter shall be the pointer to a Parallel RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdParallelIdenticalWorkerAvx512f(struct rbdParallelData *data)
+static void *rbdParallelIdenticalWorkerAvx512f(void *arg)
 {
+    struct rbdParallelData *data;
     unsigned int time;
+    unsigned int head;
+
+    /* Retrieve Parallel RBD data */
+    data = (struct rbdParallelData *)arg;
 
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        /* Compute number of time instants preceding the first aligned one */
+        head = (unsigned int)(((V8D * sizeof(double)) - ((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1))) / sizeof(double)) & (V8D - 1);
+        if ((head != 0) && ((time + head) <= data->batch.tEnd)) {
             /* Compute reliability of Parallel RBD at current time instant */
-            rbdParallelIdenticalStepS1d(data, time);
+            rbdParallelIdenticalStepV8dAvx512f(data, time, V8D_MASK(head));
             /* Increment current time instant */
-            time += S1D;
-        }
-        if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
-            /* Compute reliability of Parallel RBD at current time instant */
-            rbdParallelIdenticalStepV2dSse2(data, time);
-            /* Increment current time instant */
-            time += V2D;
-        }
-        if (((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1)) != 0) {
-            /* Compute reliability of Parallel RBD at current time instant from working components */
-            rbdParallelIdenticalStepV4dAvx(data, time);
-            /* Increment current time instant */
-            time += V4D;
+            time += head;
         }
     }
     /* For each time instant to be processed (blocks of 8 time instants)... */
-    while ((time + V8D) <= data->numTimes) {
+    while ((time + V8D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V8D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelIdenticalStepV8dAvx512f(data, time);
-        /* Increment current time instant */
-        time += (data->numCores * V8D);
-    }
-    /* Are (at least) 4 time instants remaining? */
-    if ((time + V4D) <= data->numTimes) {
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelIdenticalStepV4dAvx(data, time);
-        /* Increment current time instant */
-        time += V4D;
-    }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V8D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
         /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelIdenticalStepV2dSse2(data, time);
+        rbdParallelIdenticalStepV8dAvx512f(data, time, V8D_MASK(V8D));
         /* Increment current time instant */
-        time += V2D;
+        time += (data->batch.numBatches * V8D);
     }
-    /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelIdenticalStepS1d(data, time);
+        rbdParallelIdenticalStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
     }
 
     return NULL;
@@ -431,18 +350,19 @@ static void *rbdParallelIdenticalWorkerAvx(void *arg)
 
     /* Retrieve Parallel RBD data */
     data = (struct rbdParallelData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Parallel RBD at current time instant */
             rbdParallelIdenticalStepS1d(data, time);
             /* Increment current time instant */
             time += S1D;
         }
-        if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
             /* Compute reliability of Parallel RBD at current time instant */
             rbdParallelIdenticalStepV2dSse2(data, time);
             /* Increment current time instant */
@@ -450,24 +370,24 @@ static void *rbdParallelIdenticalWorkerAvx(void *arg)
         }
     }
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepV4dAvx(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepV2dSse2(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepS1d(data, time);
     }
@@ -24,6 +24,7 @@
 
 
 #include "../generic/rbd_internal_generic.h"
+#include "rbd_internal_amd64.h"
 #include "../parallel.h"
 
 
@@ -37,8 +38,8 @@ void rbdParallelGenericStepV4dFma3(struct rbdParallelData *data, unsigned int ti
 void rbdParallelGenericStepV2dFma3(struct rbdParallelData *data, unsigned int time);
 
 /* Platform-specific functions for amd64 AVX512F instruction set */
-void rbdParallelGenericStepV8dAvx512f(struct rbdParallelData *data, unsigned int time);
-void rbdParallelIdenticalStepV8dAvx512f(struct rbdParallelData *data, unsigned int time);
+void rbdParallelGenericStepV8dAvx512f(struct rbdParallelData *data, unsigned int time, __mmask8 mask);
+void rbdParallelIdenticalStepV8dAvx512f(struct rbdParallelData *data, unsigned int time, __mmask8 mask);
 #endif /* defined(ARCH_AMD64) && (CPU_ENABLE_SIMD != 0) */
 
 
@@ -49,7 +49,8 @@ static struct amd64Cpu amd64Cpu;
  *      None
  *
  * Description:
- *  This function retrieves the availability of SSE2 instruction set
+ *  This function retrieves the availability of SSE2 instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -62,8 +63,8 @@ HIDDEN unsigned int amd64Sse2Supported(void)
     /* Get CPU-specific information */
     getCpuInfo();
 
-    /* Return x86 SSE2 instruction set supported by the system */
-    return amd64Cpu.sse2Supported;
+    /* Return x86 SSE2 instruction set supported by the system and enabled */
+    return (amd64Cpu.sse2Supported != 0) && (isaEnabled(RBD_ISA_SSE2) != 0);
 }
 
 /**
@@ -78,7 +79,8 @@ HIDDEN unsigned int amd64Sse2Supported(void)
  *      None
  *
  * Description:
- *  This function retrieves the availability of AVX instruction set
+ *  This function retrieves the availability of AVX instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -91,8 +93,8 @@ HIDDEN unsigned int amd64AvxSupported(void)
     /* Get CPU-specific information */
     getCpuInfo();
 
-    /* Return amd64 AVX instruction set supported by the system */
-    return amd64Cpu.avxSupported;
+    /* Return amd64 AVX instruction set supported by the system and enabled */
+    return (amd64Cpu.avxSupported != 0) && (isaEnabled(RBD_ISA_AVX) != 0);
 }
 
 /**
@@ -107,7 +109,8 @@ HIDDEN unsigned int amd64AvxSupported(void)
  *      None
  *
  * Description:
- *  This function retrieves the availability of FMA3 instruction set
+ *  This function retrieves the availability of FMA3 instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -120,8 +123,8 @@ HIDDEN unsigned int amd64Fma3Supported(void)
     /* Get CPU-specific information */
     getCpuInfo();
 
-    /* Return amd64 FMA3 instruction set supported by the system */
-    return amd64Cpu.fma3Supported;
+    /* Return amd64 FMA3 instruction set supported by the system and enabled */
+    return (amd64Cpu.fma3Supported != 0) && (isaEnabled(RBD_ISA_FMA3) != 0);
 }
 
 /**
@@ -136,7 +139,8 @@ HIDDEN unsigned int amd64Fma3Supported(void)
  *      None
  *
  * Description:
- *  This function retrieves the availability of AVX512F instruction set
+ *  This function retrieves the availability of AVX512F instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -149,8 +153,8 @@ HIDDEN unsigned int amd64Avx512fSupported(void)
     /* Get CPU-specific information */
     getCpuInfo();
 
-    /* Return amd64 AVX512F instruction set supported by the system */
-    return amd64Cpu.avx512fSupported;
+    /* Return amd64 AVX512F instruction set supported by the system and enabled */
+    return (amd64Cpu.avx512fSupported != 0) && (isaEnabled(RBD_ISA_AVX512F) != 0);
 }
 
 /**
@@ -187,6 +191,8 @@ HIDDEN void retrieveAmd64CpuInfo(void)
     amd64Cpu.avxSupported = 0;
     amd64Cpu.fma3Supported = 0;
     amd64Cpu.avx512fSupported = 0;
+    /* Initialize CPU features detection, required when invoked from library constructors */
+    __builtin_cpu_init();
     if (__builtin_cpu_supports("sse2") > 0) {
         amd64Cpu.sse2Supported = 1;
         if (__builtin_cpu_supports("avx") > 0) {
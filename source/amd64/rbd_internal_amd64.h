@@ -31,6 +31,9 @@
 #include "../x86/rbd_internal_x86.h"
 
 
+#define V8D_MASK(N)                 ((__mmask8)((1U << (N)) - 1U))      /* Mask of first N doubles of a 512bit vector */
+
+
 VARIABLE_TARGET("avx") extern const __m256d v4dZeros;
 VARIABLE_TARGET("avx") extern const __m256d v4dOnes;
 VARIABLE_TARGET("avx") extern const __m256d v4dTwos;
@@ -55,7 +58,8 @@ FUNCTION_TARGET("avx512f") __m512d capReliabilityV8dAvx512f(__m512d v8dR);
  *      None
  *
  * Description:
- *  This function retrieves the availability of SSE2 instruction set
+ *  This function retrieves the availability of SSE2 instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -77,7 +81,8 @@ unsigned int amd64Sse2Supported(void);
  *      None
  *
  * Description:
- *  This function retrieves the availability of AVX instruction set
+ *  This function retrieves the availability of AVX instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -99,7 +104,8 @@ unsigned int amd64AvxSupported(void);
  *      None
  *
  * Description:
- *  This function retrieves the availability of FMA3 instruction set
+ *  This function retrieves the availability of FMA3 instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -121,7 +127,8 @@ unsigned int amd64Fma3Supported(void);
  *      None
  *
  * Description:
- *  This function retrieves the availability of AVX512F instruction set
+ *  This function retrieves the availability of AVX512F instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -29,122 +29,63 @@
 #include "../series.h"
 
 
-static void *rbdSeriesGenericWorkerAvx512f(struct rbdSeriesData *data);
-static void *rbdSeriesGenericWorkerAvx(struct rbdSeriesData *data);
-static void *rbdSeriesIdenticalWorkerAvx512f(struct rbdSeriesData *data);
-static void *rbdSeriesIdenticalWorkerAvx(struct rbdSeriesData *data);
+static void *rbdSeriesGenericWorkerAvx512f(void *arg);
+static void *rbdSeriesGenericWorkerAvx(void *arg);
+static void *rbdSeriesIdenticalWorkerAvx512f(void *arg);
+static void *rbdSeriesIdenticalWorkerAvx(void *arg);
 
 
 /**
- * rbdSeriesGenericWorker
+ * rbdSeriesResolveWorkers
  *
- * Generic Series RBD Worker function with amd64 platform-specific instruction sets
+ * Resolve Series RBD Workers with amd64 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the generic Series RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a generic Series RBD system
+ *  This function selects, for each Series RBD Worker, the implementation exploiting the widest
+ *  amd64 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a Series RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Series RBD
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdSeriesGenericWorker(void *arg)
+HIDDEN void rbdSeriesResolveWorkers(void)
 {
-    struct rbdSeriesData *data;
-    unsigned int time;
-
-    /* Retrieve Series RBD data */
-    data = (struct rbdSeriesData *)arg;
-
+    /* Resolve generic Series RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdSeriesGenericWorkerAvx512f(data);
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorkerAvx512f;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdSeriesGenericWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdSeriesGenericWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesGenericStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numTimes;
+    else {
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdSeriesIdenticalWorker
- *
- * Identical Series RBD Worker function with amd64 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical Series RBD Worker exploiting amd64 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of an identical Series RBD system
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a Series RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Series RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
-{
-    struct rbdSeriesData *data;
-    unsigned int time;
-
-    /* Retrieve Series RBD data */
-    data = (struct rbdSeriesData *)arg;
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-
+    /* Resolve identical Series RBD Worker */
     if (amd64Avx512fSupported()) {
-        return rbdSeriesIdenticalWorkerAvx512f(data);
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerAvx512f;
     }
-
-    if (amd64AvxSupported()) {
-        return rbdSeriesIdenticalWorkerAvx(data);
+    else if (amd64AvxSupported()) {
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerAvx;
     }
-
-    if (amd64Sse2Supported()) {
-        return rbdSeriesIdenticalWorkerSse2(data);
+    else if (amd64Sse2Supported()) {
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerSse2;
     }
-
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesIdenticalStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerS1d;
     }
-
-    return NULL;
 }
 
 /**
@@ -153,7 +94,7 @@ HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
  * Generic Series RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdSeriesData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -163,46 +104,36 @@ HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
  *  It is responsible to compute the reliabilities over a given batch of a generic Series RBD system
  *
  * Parameters:
- *      data: the pointer to a Series RBD data
+ *      arg: this parameter shall be the pointer to a Series RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdSeriesGenericWorkerAvx512f(struct rbdSeriesData *data)
+static void *rbdSeriesGenericWorkerAvx512f(void *arg)
 {
+    struct rbdSeriesData *data;
     unsigned int time;
 
+    /* Retrieve Series RBD data */
+    data = (struct rbdSeriesData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
     /* For each time instant to be processed (blocks of 8 time instants)... */
-    while ((time + V8D) <= data->numTimes) {
+    while ((time + V8D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V8D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesGenericStepV8dAvx512f(data, time);
-        /* Increment current time instant */
-        time += (data->numCores * V8D);
-    }
-    /* Are (at least) 4 time instants remaining? */
-    if ((time + V4D) <= data->numTimes) {
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V8D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
         /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesGenericStepV4dAvx(data, time);
-        /* Increment current time instant */
-        time += V4D;
-    }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesGenericStepV2dSse2(data, time);
+        rbdSeriesGenericStepV8dAvx512f(data, time, V8D_MASK(V8D));
         /* Increment current time instant */
-        time += V2D;
+        time += (data->batch.numBatches * V8D);
     }
-    /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesGenericStepS1d(data, time);
+        rbdSeriesGenericStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
     }
 
     return NULL;
@@ -214,7 +145,7 @@ static void *rbdSeriesGenericWorkerAvx512f(struct rbdSeriesData *data)
  * Generic Series RBD Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdSeriesData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -224,37 +155,41 @@ static void *rbdSeriesGenericWorkerAvx512f(struct rbdSeriesData *data)
  *  It is responsible to compute the reliabilities over a given batch of a generic Series RBD system
  *
  * Parameters:
- *      data: the pointer to a Series RBD data
+ *      arg: this parameter shall be the pointer to a Series RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdSeriesGenericWorkerAvx(struct rbdSeriesData *data)
+static void *rbdSeriesGenericWorkerAvx(void *arg)
 {
+    struct rbdSeriesData *data;
     unsigned int time;
 
+    /* Retrieve Series RBD data */
+    data = (struct rbdSeriesData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepV4dAvx(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepV2dSse2(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepS1d(data, time);
     }
@@ -268,7 +203,7 @@ static void *rbdSeriesGenericWorkerAvx(struct rbdSeriesData *data)
  * Identical Series RBD Worker function with amd64 AVX512F instruction set
  *
  * Input:
- *      struct rbdSeriesData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -278,67 +213,48 @@ static void *rbdSeriesGenericWorkerAvx(struct rbdSeriesData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Series RBD system
  *
  * Parameters:
- *      data: the pointer to a Series RBD data
+ *      arg: this parameter shall be the pointer to a Series RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdSeriesIdenticalWorkerAvx512f(struct rbdSeriesData *data)
+static void *rbdSeriesIdenticalWorkerAvx512f(void *arg)
 {
+    struct rbdSeriesData *data;
     unsigned int time;
+    unsigned int head;
+
+    /* Retrieve Series RBD data */
+    data = (struct rbdSeriesData *)arg;
 
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V8D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V8D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        /* Compute number of time instants preceding the first aligned one */
+        head = (unsigned int)(((V8D * sizeof(double)) - ((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1))) / sizeof(double)) & (V8D - 1);
+        if ((head != 0) && ((time + head) <= data->batch.tEnd)) {
             /* Compute reliability of Series RBD at current time instant */
-            rbdSeriesIdenticalStepS1d(data, time);
+            rbdSeriesIdenticalStepV8dAvx512f(data, time, V8D_MASK(head));
             /* Increment current time instant */
-            time += S1D;
-        }
-        if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
-            /* Compute reliability of Series RBD at current time instant */
-            rbdSeriesIdenticalStepV2dSse2(data, time);
-            /* Increment current time instant */
-            time += V2D;
-        }
-        if (((long)&data->reliabilities[time] & (V8D * sizeof(double) - 1)) != 0) {
-            /* Compute reliability of Series RBD at current time instant */
-            rbdSeriesIdenticalStepV4dAvx(data, time);
-            /* Increment current time instant */
-            time += V4D;
+            time += head;
         }
     }
     /* For each time instant to be processed (blocks of 8 time instants)... */
-    while ((time + V8D) <= data->numTimes) {
+    while ((time + V8D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V8D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V8D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V8D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V8D));
         /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesIdenticalStepV8dAvx512f(data, time);
+        rbdSeriesIdenticalStepV8dAvx512f(data, time, V8D_MASK(V8D));
         /* Increment current time instant */
-        time += (data->numCores * V8D);
+        time += (data->batch.numBatches * V8D);
     }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V4D) <= data->numTimes) {
+    /* Are (at most) 7 time instants remaining? */
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesIdenticalStepV4dAvx(data, time);
-        /* Increment current time instant */
-        time += V4D;
-    }
-    /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesIdenticalStepV2dSse2(data, time);
-        /* Increment current time instant */
-        time += V2D;
-    }
-    /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesIdenticalStepS1d(data, time);
+        rbdSeriesIdenticalStepV8dAvx512f(data, time, V8D_MASK(data->batch.tEnd - time));
     }
 
     return NULL;
@@ -350,7 +266,7 @@ static void *rbdSeriesIdenticalWorkerAvx512f(struct rbdSeriesData *data)
  * Identical Series RBD Worker function with amd64 AVX instruction set
  *
  * Input:
- *      struct rbdSeriesData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -360,27 +276,31 @@ static void *rbdSeriesIdenticalWorkerAvx512f(struct rbdSeriesData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Series RBD system
  *
  * Parameters:
- *      data: the pointer to a Series RBD data
+ *      arg: this parameter shall be the pointer to a Series RBD data
  *
  * Return (void *):
  *  NULL
  */
-static void *rbdSeriesIdenticalWorkerAvx(struct rbdSeriesData *data)
+static void *rbdSeriesIdenticalWorkerAvx(void *arg)
 {
+    struct rbdSeriesData *data;
     unsigned int time;
 
+    /* Retrieve Series RBD data */
+    data = (struct rbdSeriesData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V4D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V4D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Series RBD at current time instant */
             rbdSeriesIdenticalStepS1d(data, time);
             /* Increment current time instant */
             time += S1D;
         }
-        if (((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V4D * sizeof(double) - 1)) != 0) && ((time + V2D) <= data->batch.tEnd)) {
             /* Compute reliability of Series RBD at current time instant */
             rbdSeriesIdenticalStepV2dSse2(data, time);
             /* Increment current time instant */
@@ -388,24 +308,24 @@ static void *rbdSeriesIdenticalWorkerAvx(struct rbdSeriesData *data)
         }
     }
     /* For each time instant to be processed (blocks of 4 time instants)... */
-    while ((time + V4D) <= data->numTimes) {
+    while ((time + V4D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V4D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V4D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V4D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V4D));
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepV4dAvx(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V4D);
+        time += (data->batch.numBatches * V4D);
     }
     /* Are (at least) 2 time instants remaining? */
-    if ((time + V2D) <= data->numTimes) {
+    if ((time + V2D) <= data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepV2dSse2(data, time);
         /* Increment current time instant */
         time += V2D;
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepS1d(data, time);
     }
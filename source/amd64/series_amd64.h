@@ -24,6 +24,7 @@
 
 
 #include "../generic/rbd_internal_generic.h"
+#include "rbd_internal_amd64.h"
 #include "../series.h"
 
 
@@ -33,8 +34,8 @@ void rbdSeriesGenericStepV4dAvx(struct rbdSeriesData *data, unsigned int time);
 void rbdSeriesIdenticalStepV4dAvx(struct rbdSeriesData *data, unsigned int time);
 
 /* Platform-specific functions for amd64 AVX512F instruction set */
-void rbdSeriesGenericStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time);
-void rbdSeriesIdenticalStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time);
+void rbdSeriesGenericStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time, __mmask8 mask);
+void rbdSeriesIdenticalStepV8dAvx512f(struct rbdSeriesData *data, unsigned int time, __mmask8 mask);
 #endif /* defined(ARCH_AMD64) && (CPU_ENABLE_SIMD != 0) */
 
 
@@ -22,10 +22,16 @@
 
 #include "generic/rbd_internal_generic.h"
 
+#include "generic/threadpool.h"
 #include "bridge.h"
 
 
-static int rbdBridgeInternal(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes, fpWorker fpWorker);
+static int rbdBridgeInternal(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes, fpWorker fpWorker, enum rbdWorkload workload);
+static CONSTRUCTOR void rbdBridgeInitialize(void);
+
+
+/* Platform-generic and platform-specific Workers, resolved at library load time */
+HIDDEN struct rbdBridgeWorkers bridgeWorkers;
 
 
 /**
@@ -60,7 +66,7 @@ static int rbdBridgeInternal(double *reliabilities, double *output, unsigned cha
  */
 EXTERN int rbdBridgeGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes)
 {
-    return rbdBridgeInternal(reliabilities, output, numComponents, numTimes, &rbdBridgeGenericWorker);
+    return rbdBridgeInternal(reliabilities, output, numComponents, numTimes, bridgeWorkers.genericWorker, WORKLOAD_BRIDGE_GENERIC);
 }
 
 /**
@@ -93,7 +99,7 @@ EXTERN int rbdBridgeGeneric(double *reliabilities, double *output, unsigned char
  */
 EXTERN int rbdBridgeIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes)
 {
-    return rbdBridgeInternal(reliabilities, output, numComponents, numTimes, &rbdBridgeIdenticalWorker);
+    return rbdBridgeInternal(reliabilities, output, numComponents, numTimes, bridgeWorkers.identicalWorker, WORKLOAD_BRIDGE_IDENTICAL);
 }
 
 
@@ -107,6 +113,7 @@ EXTERN int rbdBridgeIdentical(double *reliabilities, double *output, unsigned ch
  *      unsigned char numComponents
  *      unsigned int numTimes
  *      fpWorker fpWorker
+ *      enum rbdWorkload workload
  *
  * Output:
  *      double *output
@@ -122,15 +129,16 @@ EXTERN int rbdBridgeIdentical(double *reliabilities, double *output, unsigned ch
  *      numComponents: number of components in Bridge RBD system
  *      numTimes: number of time instants over which Bridge RBD shall be computed
  *      fpWorker: function pointer to Worker used to compute reliability of Bridge RBD
+ *      workload: workload of Worker, used to estimate the cost of each time instant
  *
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-static int rbdBridgeInternal(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes, fpWorker fpWorker)
+static int rbdBridgeInternal(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes, fpWorker fpWorker, enum rbdWorkload workload)
 {
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
     struct rbdBridgeData *data;
-    void *threadHandles;
+    void *poolJobs;
     unsigned int numCores;
     unsigned int idx;
 #else                                           /* Under single processor-single thread conditional compiling */
@@ -146,8 +154,8 @@ static int rbdBridgeInternal(double *reliabilities, double *output, unsigned cha
     res = 0;
 
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
-    /* Compute the number of used cores given the number of times */
-    numCores = computeNumCores(numTimes);
+    /* Compute the number of used cores given the number of times and the estimated cost of each of them */
+    numCores = computeNumCores(numTimes, computeTimeCost(workload, numComponents, 0, 0));
 
     /* Allocate Bridge RBD data array, return -1 in case of allocation failure */
     data = (struct rbdBridgeData *)malloc(sizeof(struct rbdBridgeData) * numCores);
@@ -157,9 +165,9 @@ static int rbdBridgeInternal(double *reliabilities, double *output, unsigned cha
 
     /* Is number of used cores greater than 1 (is SMP really needed)? */
     if (numCores > 1) {
-        /* Allocate Thread ID array, return -1 in case of allocation failure */
-        threadHandles = allocateThreadHandles(numCores - 1);
-        if (threadHandles == NULL) {
+        /* Allocate thread pool jobs array, return -1 in case of allocation failure */
+        poolJobs = allocatePoolJobs(numCores - 1);
+        if (poolJobs == NULL) {
             free(data);
             return -1;
         }
@@ -167,22 +175,20 @@ static int rbdBridgeInternal(double *reliabilities, double *output, unsigned cha
         /* For each available core... */
         for (idx = 0; idx < (numCores - 1); ++idx) {
             /* Prepare Bridge RBD data structure */
-            data[idx].batchIdx = idx;
-            data[idx].numCores = numCores;
+            computeBatch(&data[idx].batch, output, numTimes, numCores, idx);
             data[idx].reliabilities = reliabilities;
             data[idx].output = output;
             data[idx].numComponents = numComponents;
             data[idx].numTimes = numTimes;
 
-            /* Create the Bridge RBD Worker thread */
-            if (createThread(threadHandles, idx, fpWorker, &data[idx]) < 0) {
+            /* Dispatch the Bridge RBD Worker onto thread pool */
+            if (submitPoolJob(poolJobs, idx, fpWorker, &data[idx]) < 0) {
                 res = -1;
             }
         }
 
         /* Prepare Bridge RBD data structure */
-        data[idx].batchIdx = idx;
-        data[idx].numCores = numCores;
+        computeBatch(&data[idx].batch, output, numTimes, numCores, idx);
         data[idx].reliabilities = reliabilities;
         data[idx].output = output;
         data[idx].numComponents = numComponents;
@@ -191,18 +197,17 @@ static int rbdBridgeInternal(double *reliabilities, double *output, unsigned cha
         /* Directly invoke the Bridge RBD Worker */
         (void)(*fpWorker)(&data[idx]);
 
-        /* Wait for created threads completion */
+        /* Wait for dispatched jobs completion */
         for (idx = 0; idx < (numCores - 1); ++idx) {
-            waitThread(threadHandles, idx);
+            waitPoolJob(poolJobs, idx);
         }
-        /* Free Thread ID array */
-        free(threadHandles);
+        /* Free thread pool jobs array */
+        free(poolJobs);
     }
     else {
 #endif /* CPU_SMP */
         /* Prepare Bridge RBD data structure */
-        data[0].batchIdx = 0;
-        data[0].numCores = 1;
+        computeBatch(&data[0].batch, output, numTimes, 1, 0);
         data[0].reliabilities = reliabilities;
         data[0].output = output;
         data[0].numComponents = numComponents;
@@ -211,10 +216,41 @@ static int rbdBridgeInternal(double *reliabilities, double *output, unsigned cha
         /* Directly invoke the Bridge RBD Worker */
         (void)(*fpWorker)(&data[0]);
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
-        /* Free Bridge RBD data array */
-        free(data);
     }
+
+    /* Free Bridge RBD data array */
+    free(data);
 #endif /* CPU_SMP */
 
     return res;
 }
+
+/**
+ * rbdBridgeInitialize
+ *
+ * Initialize Bridge RBD module
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function is executed once at library load time. It retrieves CPU-specific information
+ *  and resolves the Bridge RBD Workers exploiting the widest instruction set supported by the processor.
+ *  Since it runs before any user thread, no synchronization is required
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static CONSTRUCTOR void rbdBridgeInitialize(void)
+{
+    /* Get CPU-specific information */
+    getCpuInfo();
+    /* Resolve Bridge RBD Workers */
+    rbdBridgeResolveWorkers();
+}
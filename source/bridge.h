@@ -24,6 +24,7 @@
 
 
 #include "rbd.h"
+#include "generic/rbd_internal_generic.h"
 
 
 /**
@@ -31,8 +32,7 @@
  */
 struct rbdBridgeData
 {
-    unsigned char batchIdx;             /* Index of work batch */
-    unsigned int numCores;              /* Number of threads in SMP system */
+    struct rbdBatch batch;              /* Work batch (range of time instants) processed by Worker */
     double *reliabilities;              /* Reliabilities of Bridge RBD system (matrix for generic Bridge, array for identical Bridge) */
     double *output;                     /* Array of computed reliabilities */
     unsigned char numComponents;        /* Number of components of Bridge RBD system N */
@@ -40,11 +40,25 @@ struct rbdBridgeData
 };
 
 
+/**
+ * Bridge RBD Workers, resolved once at library load time
+ */
+struct rbdBridgeWorkers
+{
+    fpWorker genericWorker;             /* Generic Bridge RBD Worker */
+    fpWorker identicalWorker;           /* Identical Bridge RBD Worker */
+};
+
+
+/* Platform-generic and platform-specific Workers */
+extern struct rbdBridgeWorkers bridgeWorkers;
+
 /* Platform-generic and platform-specific functions */
-void *rbdBridgeGenericWorker(void *arg);
-void *rbdBridgeIdenticalWorker(void *arg);
+void rbdBridgeResolveWorkers(void);
 
 /* Platform-generic functions */
+void *rbdBridgeGenericWorkerS1d(void *arg);
+void *rbdBridgeIdenticalWorkerS1d(void *arg);
 void rbdBridgeGenericStepS1d(struct rbdBridgeData *data, unsigned int time);
 void rbdBridgeIdenticalStepS1d(struct rbdBridgeData *data, unsigned int time);
 
@@ -37,6 +37,9 @@
 /* Declare hidden symbols */
 #define HIDDEN                  __attribute__((visibility ("hidden")))
 
+/* Declare functions executed at library load time */
+#define CONSTRUCTOR             __attribute__((constructor))
+
 /**
  * compilerPrefetchRead
  *
@@ -91,7 +91,7 @@ HIDDEN int createThread(void *threadHandles, unsigned int threadIdx, fpWorker fp
     pthread_t *pHandles = (pthread_t *)threadHandles;
 
     /* Create the RBD Worker thread (pthread model) */
-    if (pthread_create(&pHandles[threadIdx], NULL, fpWorker, args) < 0) {
+    if (pthread_create(&pHandles[threadIdx], NULL, fpWorker, args) != 0) {
         return -1;
     }
     return 0;
@@ -29,8 +29,18 @@
 #include <stdio.h>
 
 
+#define BINOMIAL_ROW_OFFSET(N)      ((((N) / 2) + 1) * (((N) + 1) / 2))    /* Offset of row N into table of Binomial Coefficients (k <= N/2 only) */
+#define BINOMIAL_WORDS              (4)                                     /* Number of 64bit words of exact Binomial Coefficients (255C127 < 2^256) */
+
+
 static unsigned char computeGcd(unsigned long long a, unsigned char b);
 static void divideBy(unsigned long long *res, unsigned char *dividends, unsigned char numDividends);
+static double wordsToDouble(const unsigned long long *words);
+static CONSTRUCTOR void binomialInitialize(void);
+
+
+/* Table of Binomial Coefficients nCk as doubles, for all n in [0, 255] and k in [0, n/2] */
+static double binomialTable[BINOMIAL_ROW_OFFSET(UCHAR_MAX + 1)];
 
 
 /**
@@ -61,6 +71,7 @@ HIDDEN unsigned long long binomialCoefficient(unsigned char n, unsigned char k)
     unsigned long long res = 1;
     int idx;
     unsigned int i;
+    unsigned int nPlusOne;
     unsigned char dividends[UCHAR_MAX];
 
     /* In case k is greater than n, nCk computation is not possible. Return 0 */
@@ -90,16 +101,17 @@ HIDDEN unsigned long long binomialCoefficient(unsigned char n, unsigned char k)
 
     i = k;
     res = 1ULL;
-    ++n;
+    /* Compute n+1 without wrapping around for n equal to 255 */
+    nPlusOne = (unsigned int)n + 1;
 
     /* For i=0, ..., k */
     do {
-        if (res > (18446744073709551615ULL / (n - i))) {
+        if (res > (18446744073709551615ULL / (nPlusOne - i))) {
             /* Overflow condition detected, return 0. */
             return 0ULL;
         }
-        /* Multiply partial result by (n-i) */
-        res *= (n - i);
+        /* Multiply partial result by (n+1-i) */
+        res *= (nPlusOne - i);
         /* Divide partial result using all dividends */
         divideBy(&res, dividends, k);
     }
@@ -114,6 +126,39 @@ HIDDEN unsigned long long binomialCoefficient(unsigned char n, unsigned char k)
     return res;
 }
 
+/**
+ * binomialCoefficientS1d
+ *
+ * Retrieval of Binomial Coefficient as double
+ *
+ * Input:
+ *      unsigned char n
+ *      unsigned char k
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the Binomial Coefficient nCk, correctly rounded to double, from the table
+ *  precomputed at library load time. Since nCk is equal to nC(n-k), only k <= n/2 are stored.
+ *
+ * Parameters:
+ *      n: n parameter of nCk
+ *      k: k parameter of nCk. RANGE: (0 <= k <= n)
+ *
+ * Return (double):
+ *  The nCk rounded to double.
+ */
+HIDDEN double binomialCoefficientS1d(unsigned char n, unsigned char k)
+{
+    /* nCk is equal to nC(n-k). Resolve for k=min(k, n-k) */
+    if ((n - k) < k) {
+        k = n - k;
+    }
+
+    return binomialTable[BINOMIAL_ROW_OFFSET(n) + k];
+}
+
 /**
  * computeGcd
  *
@@ -187,3 +232,127 @@ static void divideBy(unsigned long long *res, unsigned char *dividends, unsigned
         dividends[idx] /= gcd;
     }
 }
+
+/**
+ * binomialInitialize
+ *
+ * Initialize table of Binomial Coefficients
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function is executed once at library load time. It computes the table of Binomial
+ *  Coefficients nCk for all n in [0, 255] through Pascal's triangle, i.e. nCk = (n-1)C(k-1) + (n-1)Ck.
+ *  Rows are accumulated as exact multi-word integers, since 255C127 requires 252 bits, and
+ *  each coefficient is rounded to double only once when stored into the table.
+ *  Since it runs before any user thread, no synchronization is required
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static CONSTRUCTOR void binomialInitialize(void)
+{
+    unsigned long long row[UCHAR_MAX + 1][BINOMIAL_WORDS];
+    unsigned long long carry;
+    int n, k, w;
+
+    /* 0C0 is equal to 1 */
+    for (w = 0; w < BINOMIAL_WORDS; ++w) {
+        row[0][w] = 0ULL;
+    }
+    row[0][0] = 1ULL;
+
+    /* For each row of Pascal's triangle... */
+    for (n = 0; n <= UCHAR_MAX; ++n) {
+        /* Update current row from previous one, from last element. nCn is equal to 1 */
+        for (w = 0; w < BINOMIAL_WORDS; ++w) {
+            row[n][w] = row[0][w];
+        }
+        for (k = n - 1; k > 0; --k) {
+            /* Add previous element with carry propagation */
+            carry = 0ULL;
+            for (w = 0; w < BINOMIAL_WORDS; ++w) {
+                row[k][w] += carry;
+                carry = (row[k][w] < carry) ? 1ULL : 0ULL;
+                row[k][w] += row[k - 1][w];
+                carry += (row[k][w] < row[k - 1][w]) ? 1ULL : 0ULL;
+            }
+        }
+        /* Store the first half of current row into table */
+        for (k = 0; k <= (n / 2); ++k) {
+            binomialTable[BINOMIAL_ROW_OFFSET(n) + k] = wordsToDouble(row[k]);
+        }
+    }
+}
+
+/**
+ * wordsToDouble
+ *
+ * Round multi-word integer to double
+ *
+ * Input:
+ *      const unsigned long long *words
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function rounds a multi-word integer, least significant word first, to the nearest double.
+ *  The 64 most significant bits are extracted, and any lower non-zero bit is folded into their
+ *  least significant one (sticky bit): since only 53 bits are kept, the conversion of such
+ *  64bit integer to double rounds exactly as the whole integer would.
+ *
+ * Parameters:
+ *      words: multi-word integer of BINOMIAL_WORDS words
+ *
+ * Return (double):
+ *  The multi-word integer rounded to double.
+ */
+static double wordsToDouble(const unsigned long long *words)
+{
+    unsigned long long bits;
+    double res;
+    int exponent;
+    int shift;
+    int w;
+
+    /* Search for most significant non-zero word */
+    for (w = BINOMIAL_WORDS - 1; (w > 0) && (words[w] == 0ULL); --w);
+    /* Does integer fit into a single word? */
+    if (w == 0) {
+        return (double)words[0];
+    }
+
+    /* Compute shift normalizing most significant word */
+    for (shift = 0; (words[w] << shift) < (1ULL << 63); ++shift);
+    /* Compute exponent of least significant extracted bit */
+    exponent = (64 * w) - shift;
+    /* Extract 64 most significant bits */
+    bits = words[w] << shift;
+    if (shift > 0) {
+        bits |= words[w - 1] >> (64 - shift);
+    }
+    /* Fold remaining bits into sticky bit */
+    if ((words[w - 1] << shift) != 0ULL) {
+        bits |= 1ULL;
+    }
+    while (--w > 0) {
+        if (words[w - 1] != 0ULL) {
+            bits |= 1ULL;
+        }
+    }
+
+    /* Round to double and scale by exponent of extracted bits (exact) */
+    res = (double)bits;
+    while (exponent-- > 0) {
+        res *= 2.0;
+    }
+    return res;
+}
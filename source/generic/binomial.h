@@ -48,5 +48,31 @@
  */
 unsigned long long binomialCoefficient(unsigned char n, unsigned char k);
 
+/**
+ * binomialCoefficientS1d
+ *
+ * Retrieval of Binomial Coefficient as double
+ *
+ * Input:
+ *      unsigned char n
+ *      unsigned char k
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the Binomial Coefficient nCk, correctly rounded to double, from the table
+ *  precomputed at library load time. Differently from binomialCoefficient(), it does not
+ *  overflow for any n representable as unsigned char.
+ *
+ * Parameters:
+ *      n: n parameter of nCk
+ *      k: k parameter of nCk. RANGE: (0 <= k <= n)
+ *
+ * Return (double):
+ *  The nCk rounded to double.
+ */
+double binomialCoefficientS1d(unsigned char n, unsigned char k);
+
 
 #endif /* BINOMIAL_H_ */
@@ -27,9 +27,39 @@
 
 #if defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0
 /**
- * rbdBridgeGenericWorker
+ * rbdBridgeResolveWorkers
  *
- * Bridge RBD Worker function
+ * Resolve Bridge RBD Workers
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the Bridge RBD Workers. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdBridgeResolveWorkers(void)
+{
+    /* Resolve generic Bridge RBD Worker */
+    bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerS1d;
+    /* Resolve identical Bridge RBD Worker */
+    bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerS1d;
+}
+#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
+
+/**
+ * rbdBridgeGenericWorkerS1d
+ *
+ * Generic Bridge RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -38,7 +68,7 @@
  *      None
  *
  * Description:
- *  This function implements the generic Bridge RBD Worker.
+ *  This function implements the generic Bridge RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of a Bridge RBD system
  *
  * Parameters:
@@ -49,7 +79,7 @@
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdBridgeGenericWorker(void *arg)
+HIDDEN void *rbdBridgeGenericWorkerS1d(void *arg)
 {
     struct rbdBridgeData *data;
     unsigned int time;
@@ -57,23 +87,23 @@ HIDDEN void *rbdBridgeGenericWorker(void *arg)
     /* Retrieve Bridge RBD data */
     data = (struct rbdBridgeData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* For each time instant to be processed... */
-    while (time < data->numTimes) {
+    while (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepS1d(data, time);
         /* Increment current time instant */
-        time += data->numCores;
+        time += data->batch.numBatches;
     }
 
     return NULL;
 }
 
 /**
- * rbdBridgeIdenticalWorker
+ * rbdBridgeIdenticalWorkerS1d
  *
- * Identical Bridge RBD Worker function
+ * Identical Bridge RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -82,7 +112,7 @@ HIDDEN void *rbdBridgeGenericWorker(void *arg)
  *      None
  *
  * Description:
- *  This function implements the identical Bridge RBD Worker.
+ *  This function implements the identical Bridge RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of an identical Bridge RBD system
  *
  * Parameters:
@@ -93,7 +123,7 @@ HIDDEN void *rbdBridgeGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
+HIDDEN void *rbdBridgeIdenticalWorkerS1d(void *arg)
 {
     struct rbdBridgeData *data;
     unsigned int time;
@@ -101,19 +131,18 @@ HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
     /* Retrieve Bridge RBD data */
     data = (struct rbdBridgeData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* For each time instant to be processed... */
-    while (time < data->numTimes) {
+    while (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepS1d(data, time);
         /* Increment current time instant */
-        time += data->numCores;
+        time += data->batch.numBatches;
     }
 
     return NULL;
 }
-#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
 
 /**
  * rbdBridgeGenericStepS1d
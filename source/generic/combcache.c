@@ -0,0 +1,536 @@
+/*
+ *  Component: combcache.c
+ *  Process-wide cache of combinations of k elements out of n
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "combcache.h"
+
+#include "rbd_internal_generic.h"
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+#include <pthread.h>
+#endif /* CPU_SMP */
+
+
+#define COMBINATIONS_CACHE_SIZE     (1048576ULL)    /* Default memory budget of combinations cache (in bytes) */
+#define COMBINATIONS_CACHE_BUCKETS  (256)           /* Number of buckets of combinations cache hash table */
+
+
+struct cacheEntry
+{
+    struct combinations *combinations;  /* Cached combinations of k elements out of n */
+    struct cacheEntry *hashNext;        /* Next entry in the same hash table bucket */
+    struct cacheEntry *lruPrev;         /* Previous (more recently used) entry in LRU list */
+    struct cacheEntry *lruNext;         /* Next (less recently used) entry in LRU list */
+    unsigned long long size;            /* Memory used by entry (in bytes) */
+    unsigned int refCount;              /* Number of RBD computations using cached combinations */
+};
+
+struct combinationsCache
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    pthread_mutex_t mutex;              /* Mutex protecting the combinations cache */
+#endif /* CPU_SMP */
+    struct cacheEntry *buckets[COMBINATIONS_CACHE_BUCKETS]; /* Hash table of cached combinations, keyed by (n, k) */
+    struct cacheEntry *lruHead;         /* Most recently used entry */
+    struct cacheEntry *lruTail;         /* Least recently used entry */
+    unsigned long long size;            /* Memory used by cached combinations (in bytes) */
+    unsigned long long maxSize;         /* Memory budget of cached combinations (in bytes) */
+    unsigned char forkHandlers;         /* Fork handlers registered */
+};
+
+
+static void cacheLock(void);
+static void cacheUnlock(void);
+static struct cacheEntry **cacheLookup(unsigned char n, unsigned char k);
+static void cacheUse(struct cacheEntry *entry);
+static void cacheEvict(unsigned long long maxSize);
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+static void cacheForkPrepare(void);
+static void cacheForkParent(void);
+static void cacheForkChild(void);
+#endif /* CPU_SMP */
+
+
+static struct combinationsCache cache = {
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    PTHREAD_MUTEX_INITIALIZER,
+#endif /* CPU_SMP */
+    { NULL },
+    NULL,
+    NULL,
+    0,
+    COMBINATIONS_CACHE_SIZE,
+    0
+};
+
+
+/**
+ * rbdSetCombinationsCacheSize
+ *
+ * Set the memory budget of the combinations cache
+ *
+ * Input:
+ *      unsigned long long maxSize
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function sets the memory budget of the process-wide cache of the combinations
+ *  used by generic KooN RBD blocks, evicting the least recently used combinations not
+ *  in use until the cache fits into the new budget
+ *
+ * Parameters:
+ *      maxSize: memory budget (in bytes), 0 to disable the cache
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdSetCombinationsCacheSize(unsigned long long maxSize)
+{
+    cacheLock();
+    cache.maxSize = maxSize;
+    cacheEvict(maxSize);
+    cacheUnlock();
+}
+
+/**
+ * acquireCombinations
+ *
+ * Retrieve combinations of k elements out of n from process-wide cache
+ *
+ * Input:
+ *      unsigned char n
+ *      unsigned char k
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the combinations of k elements out of n from the process-wide
+ *  cache, computing them through computeCombinations() in case they are not cached yet.
+ *  Computed combinations are inserted into the cache as long as they fit into its memory
+ *  budget, evicting the least recently used combinations not in use.
+ *  This function is thread-safe, the retrieved combinations are read-only and shall be
+ *  released through releaseCombinations()
+ *
+ * Parameters:
+ *      n: n parameter of nCk
+ *      k: k parameter of nCk. RANGE: (0 <= k <= n)
+ *
+ * Return (struct combinations *):
+ *  The structure containing nCk combinations of k out of n elements, NULL if an error occurred.
+ */
+HIDDEN struct combinations *acquireCombinations(unsigned char n, unsigned char k)
+{
+    struct cacheEntry **link;
+    struct cacheEntry *entry;
+    struct combinations *combinations;
+    unsigned long long size;
+
+    cacheLock();
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Register fork handlers, so that a forked child does not inherit a locked cache */
+    if (cache.forkHandlers == 0) {
+        if (pthread_atfork(&cacheForkPrepare, &cacheForkParent, &cacheForkChild) == 0) {
+            cache.forkHandlers = 1;
+        }
+    }
+#endif /* CPU_SMP */
+    /* Are combinations already cached? */
+    entry = *cacheLookup(n, k);
+    if (entry != NULL) {
+        ++entry->refCount;
+        cacheUse(entry);
+        cacheUnlock();
+        return entry->combinations;
+    }
+    cacheUnlock();
+
+    /* Compute combinations without holding the cache, check for its return value */
+    combinations = computeCombinations(n, k);
+    if (combinations == NULL) {
+        return NULL;
+    }
+
+    cacheLock();
+    /* Have the same combinations been cached by another thread in the meantime? */
+    link = cacheLookup(n, k);
+    if (*link != NULL) {
+        entry = *link;
+        ++entry->refCount;
+        cacheUse(entry);
+        cacheUnlock();
+        free(combinations);
+        return entry->combinations;
+    }
+
+    /* Do computed combinations fit into memory budget? */
+    size = sizeof(struct cacheEntry) + sizeof(struct combinations) + combinations->numCombinations;
+    if (size <= cache.maxSize) {
+        /* Evict least recently used combinations not in use to make room for computed ones */
+        cacheEvict(cache.maxSize - size);
+        if ((cache.size + size) <= cache.maxSize) {
+            /* Allocate cache entry, combinations are anyhow returned in case of allocation failure */
+            entry = (struct cacheEntry *)malloc(sizeof(struct cacheEntry));
+            if (entry != NULL) {
+                entry->combinations = combinations;
+                entry->hashNext = NULL;
+                entry->lruPrev = NULL;
+                entry->lruNext = NULL;
+                entry->size = size;
+                entry->refCount = 1;
+                /* Link entry at the end of its bucket, eviction may have changed the bucket */
+                link = cacheLookup(n, k);
+                *link = entry;
+                cacheUse(entry);
+                cache.size += size;
+            }
+        }
+    }
+    cacheUnlock();
+
+    return combinations;
+}
+
+/**
+ * releaseCombinations
+ *
+ * Release combinations retrieved from process-wide cache
+ *
+ * Input:
+ *      struct combinations *combinations
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the combinations retrieved through acquireCombinations().
+ *  Cached combinations are kept for subsequent retrievals, the other ones are freed.
+ *  This function is thread-safe
+ *
+ * Parameters:
+ *      combinations: combinations to be released
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void releaseCombinations(struct combinations *combinations)
+{
+    struct cacheEntry *entry;
+
+    cacheLock();
+    /* Are combinations cached? */
+    entry = *cacheLookup(combinations->n, combinations->k);
+    if ((entry != NULL) && (entry->combinations == combinations)) {
+        --entry->refCount;
+        /* Enforce memory budget, possibly reduced while combinations were in use */
+        if (cache.size > cache.maxSize) {
+            cacheEvict(cache.maxSize);
+        }
+        combinations = NULL;
+    }
+    cacheUnlock();
+
+    /* Free combinations not cached */
+    free(combinations);
+}
+
+/**
+ * cacheLock
+ *
+ * Lock the combinations cache
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function acquires the combinations cache mutex, if SMP is enabled
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void cacheLock(void)
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    (void)pthread_mutex_lock(&cache.mutex);
+#endif /* CPU_SMP */
+}
+
+/**
+ * cacheUnlock
+ *
+ * Unlock the combinations cache
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the combinations cache mutex, if SMP is enabled
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void cacheUnlock(void)
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    (void)pthread_mutex_unlock(&cache.mutex);
+#endif /* CPU_SMP */
+}
+
+/**
+ * cacheLookup
+ *
+ * Search combinations of k elements out of n into cache
+ *
+ * Input:
+ *      unsigned char n
+ *      unsigned char k
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function searches the hash table of the combinations cache for the entry of
+ *  combinations of k elements out of n.
+ *  It shall be invoked with the combinations cache mutex held
+ *
+ * Parameters:
+ *      n: n parameter of nCk
+ *      k: k parameter of nCk
+ *
+ * Return (struct cacheEntry **):
+ *  Link pointing to the requested entry, pointing to NULL (end of bucket) if not cached
+ */
+static struct cacheEntry **cacheLookup(unsigned char n, unsigned char k)
+{
+    struct cacheEntry **link;
+
+    link = &cache.buckets[((unsigned int)n + ((unsigned int)k * 31U)) % COMBINATIONS_CACHE_BUCKETS];
+    while ((*link != NULL) && (((*link)->combinations->n != n) || ((*link)->combinations->k != k))) {
+        link = &(*link)->hashNext;
+    }
+
+    return link;
+}
+
+/**
+ * cacheUse
+ *
+ * Mark cache entry as most recently used
+ *
+ * Input:
+ *      struct cacheEntry *entry
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function moves the provided entry to the head of the LRU list of the combinations cache.
+ *  It shall be invoked with the combinations cache mutex held
+ *
+ * Parameters:
+ *      entry: cache entry, possibly not yet linked into LRU list
+ *
+ * Return:
+ *      None
+ */
+static void cacheUse(struct cacheEntry *entry)
+{
+    /* Is entry already the most recently used one? */
+    if (cache.lruHead == entry) {
+        return;
+    }
+
+    /* Unlink entry from LRU list, if linked */
+    if (entry->lruPrev != NULL) {
+        entry->lruPrev->lruNext = entry->lruNext;
+        if (entry->lruNext != NULL) {
+            entry->lruNext->lruPrev = entry->lruPrev;
+        }
+        else {
+            cache.lruTail = entry->lruPrev;
+        }
+    }
+
+    /* Link entry at the head of LRU list */
+    entry->lruPrev = NULL;
+    entry->lruNext = cache.lruHead;
+    if (cache.lruHead != NULL) {
+        cache.lruHead->lruPrev = entry;
+    }
+    else {
+        cache.lruTail = entry;
+    }
+    cache.lruHead = entry;
+}
+
+/**
+ * cacheEvict
+ *
+ * Evict combinations from cache
+ *
+ * Input:
+ *      unsigned long long maxSize
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function frees the least recently used combinations not in use until the memory
+ *  used by the combinations cache does not exceed the provided size. Combinations in use
+ *  are never evicted, hence the resulting size can still exceed the provided one.
+ *  It shall be invoked with the combinations cache mutex held
+ *
+ * Parameters:
+ *      maxSize: requested maximum memory used by combinations cache (in bytes)
+ *
+ * Return:
+ *      None
+ */
+static void cacheEvict(unsigned long long maxSize)
+{
+    struct cacheEntry *entry;
+    struct cacheEntry *prev;
+    struct cacheEntry **link;
+
+    /* From the least recently used entry... */
+    entry = cache.lruTail;
+    while ((entry != NULL) && (cache.size > maxSize)) {
+        prev = entry->lruPrev;
+        /* Is entry not in use? */
+        if (entry->refCount == 0) {
+            /* Unlink entry from hash table */
+            link = cacheLookup(entry->combinations->n, entry->combinations->k);
+            *link = entry->hashNext;
+            /* Unlink entry from LRU list */
+            if (prev != NULL) {
+                prev->lruNext = entry->lruNext;
+            }
+            else {
+                cache.lruHead = entry->lruNext;
+            }
+            if (entry->lruNext != NULL) {
+                entry->lruNext->lruPrev = prev;
+            }
+            else {
+                cache.lruTail = prev;
+            }
+            /* Free entry */
+            cache.size -= entry->size;
+            free(entry->combinations);
+            free(entry);
+        }
+        entry = prev;
+    }
+}
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+/**
+ * cacheForkPrepare
+ *
+ * Fork handler executed by parent before fork()
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function acquires the combinations cache mutex, so that the combinations cache
+ *  is in a consistent state while the process is forked
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void cacheForkPrepare(void)
+{
+    (void)pthread_mutex_lock(&cache.mutex);
+}
+
+/**
+ * cacheForkParent
+ *
+ * Fork handler executed by parent after fork()
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the combinations cache mutex in the parent process
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void cacheForkParent(void)
+{
+    (void)pthread_mutex_unlock(&cache.mutex);
+}
+
+/**
+ * cacheForkChild
+ *
+ * Fork handler executed by child after fork()
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function resets the combinations cache mutex in the child process. Combinations
+ *  in use by other threads of the parent are never released by the child, hence they
+ *  remain cached
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void cacheForkChild(void)
+{
+    (void)pthread_mutex_init(&cache.mutex, NULL);
+}
+#endif /* CPU_SMP */
@@ -0,0 +1,83 @@
+/*
+ *  Component: combcache.h
+ *  Process-wide cache of combinations of k elements out of n
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef COMBCACHE_H_
+#define COMBCACHE_H_
+
+
+#include "combinations.h"
+
+
+/**
+ * acquireCombinations
+ *
+ * Retrieve combinations of k elements out of n from process-wide cache
+ *
+ * Input:
+ *      unsigned char n
+ *      unsigned char k
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the combinations of k elements out of n from the process-wide
+ *  cache, computing them through computeCombinations() in case they are not cached yet.
+ *  Computed combinations are inserted into the cache as long as they fit into its memory
+ *  budget, evicting the least recently used combinations not in use.
+ *  This function is thread-safe, the retrieved combinations are read-only and shall be
+ *  released through releaseCombinations()
+ *
+ * Parameters:
+ *      n: n parameter of nCk
+ *      k: k parameter of nCk. RANGE: (0 <= k <= n)
+ *
+ * Return (struct combinations *):
+ *  The structure containing nCk combinations of k out of n elements, NULL if an error occurred.
+ */
+struct combinations *acquireCombinations(unsigned char n, unsigned char k);
+
+/**
+ * releaseCombinations
+ *
+ * Release combinations retrieved from process-wide cache
+ *
+ * Input:
+ *      struct combinations *combinations
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the combinations retrieved through acquireCombinations().
+ *  Cached combinations are kept for subsequent retrievals, the other ones are freed.
+ *  This function is thread-safe
+ *
+ * Parameters:
+ *      combinations: combinations to be released
+ *
+ * Return:
+ *      None
+ */
+void releaseCombinations(struct combinations *combinations);
+
+
+#endif /* COMBCACHE_H_ */
@@ -26,11 +26,10 @@
 #include "../compiler/compiler.h"
 
 #include <stdlib.h>
-#include <string.h>
 #include <stddef.h>
 
 
-static unsigned long long combinationsGetSize(unsigned long long numCombinations, unsigned char k);
+static unsigned long long combinationsGetSize(unsigned long long numCombinations);
 
 
 /**
@@ -46,7 +45,11 @@ static unsigned long long combinationsGetSize(unsigned long long numCombinations
  *      None
  *
  * Description:
- *  This function computes the combinations of k elements out of n.
+ *  This function computes the combinations of k elements out of n in lexicographic order.
+ *  Each combination is stored as its pivot only, i.e. the index of its first element changed
+ *  from previous combination: the pivot element is the previous one incremented by 1 and the
+ *  following elements are consecutive, hence each combination is rebuilt from the previous one
+ *  starting from the first combination. This requires a single byte per combination.
  *  In case the nCk computation encounters an error, this function returns 0.
  *  This code is based on Rosetta Code Combinations: C code for Lexicographic ordered generation.
  *  https://rosettacode.org/wiki/Combinations#Lexicographic_ordered_generation
@@ -66,7 +69,7 @@ HIDDEN struct combinations *computeCombinations(unsigned char n, unsigned char k
     unsigned long long combSize;
     unsigned long long numCombinations;
     struct combinations *combinations;
-    static unsigned char buff[1 << (sizeof(unsigned char) * 8)];
+    unsigned char buff[1 << (sizeof(unsigned char) * 8)];
 
     /* Compute number of combinations nCk and check for its return value */
     numCombinations = binomialCoefficient(n, k);
@@ -75,7 +78,7 @@ HIDDEN struct combinations *computeCombinations(unsigned char n, unsigned char k
     }
 
     /* Compute size of combinations data structure and check for its return value */
-    combSize = combinationsGetSize(numCombinations, k);
+    combSize = combinationsGetSize(numCombinations);
     if (combSize == 0) {
         return NULL;
     }
@@ -91,13 +94,13 @@ HIDDEN struct combinations *computeCombinations(unsigned char n, unsigned char k
     combinations->n = n;
     combinations->k = k;
 
-    /* Initialize temporary buffer with first combination */
+    /* Initialize temporary buffer with first combination, whose pivot is its first element */
     firstCombination(k, &buff[0]);
+    res = 0;
 
     do {
-        /* Copy current combination into array of combinations data structure */
-        memcpy(&combinations->buff[combIdx], buff, k);
-        combIdx += k;
+        /* Store pivot of current combination into combinations data structure */
+        combinations->pivots[combIdx++] = (unsigned char)res;
 
         /* Compute next combination */
         res = nextCombination(n, k, &buff[0]);
@@ -139,6 +142,73 @@ HIDDEN void firstCombination(unsigned char k, unsigned char *combination)
     }
 }
 
+/**
+ * combinationFromRank
+ *
+ * Compute the combination of k elements out of n having the given rank
+ *
+ * Input:
+ *      unsigned char n
+ *      unsigned char k
+ *      unsigned long long rank
+ *
+ * Output:
+ *      unsigned char *combination
+ *
+ * Description:
+ *  This function computes the combination of k elements out of n having the given rank in
+ *  lexicographic order (unranking), i.e. the combination computed by computeCombinations()
+ *  at the given index. Each element is selected through the combinatorial number system:
+ *  the combinations starting with element c and followed by k-i-1 greater elements are
+ *  (n-c-1)C(k-i-1), hence candidate elements are skipped until the rank falls into their range.
+ *  This allows to split the combinations among Workers without computing the preceding ones
+ *
+ * Parameters:
+ *      n: n parameter of nCk
+ *      k: k parameter of nCk. RANGE: (0 <= k <= n)
+ *      rank: rank of requested combination. RANGE: (0 <= rank < nCk)
+ *      combination: buffer to be filled with requested combination
+ *
+ * Return (int):
+ *  0 in case the requested combination has been computed, -1 otherwise (invalid rank or
+ *  nCk computation error).
+ */
+HIDDEN int combinationFromRank(unsigned char n, unsigned char k, unsigned long long rank, unsigned char *combination)
+{
+    int i;
+    unsigned char c;
+    unsigned long long numCombinations;
+
+    /* Start from first element */
+    c = 0;
+
+    /* For each element of combination... */
+    for (i = 0; i < k; ++i) {
+        /* Skip candidate elements until rank falls into the combinations starting with current one */
+        for (;;) {
+            /* Is candidate element out of range? */
+            if (c >= n) {
+                return -1;
+            }
+            /* Compute number of combinations of remaining elements following current one */
+            numCombinations = binomialCoefficient(n - c - 1, k - i - 1);
+            if (numCombinations == 0) {
+                return -1;
+            }
+            if (rank < numCombinations) {
+                break;
+            }
+            rank -= numCombinations;
+            ++c;
+        }
+        /* Set current element, next one shall be greater */
+        combination[i] = c++;
+    }
+
+    /* Is rank within the nCk combinations? */
+    return (rank == 0) ? 0 : -1;
+}
+
 /**
  * nextCombination
  *
@@ -162,11 +232,13 @@ HIDDEN void firstCombination(unsigned char k, unsigned char *combination)
  *      combination: buffer to be filled with next combination in lexicographic order
  *
  * Return (int):
- *  0 in case the next combination in lexicographic order has been computed, -1 otherwise.
+ *  Index of first element changed from given combination in case the next combination in
+ *  lexicographic order has been computed, -1 otherwise.
  */
 HIDDEN int nextCombination(unsigned char n, unsigned char k, unsigned char *combination)
 {
     int i;
+    int pivot;
 
     /* Set index of current element into temporary buffer to last element */
     i = k - 1;
@@ -177,7 +249,7 @@ HIDDEN int nextCombination(unsigned char n, unsigned char k, unsigned char *comb
      * of combination buffer is not equal to n
      */
     if (++combination[i] < n) {
-        return 0;
+        return i;
     }
 
     /* Search for first index into combinations buffer that can be updated */
@@ -188,45 +260,44 @@ HIDDEN int nextCombination(unsigned char n, unsigned char k, unsigned char *comb
         }
     }
     /* Update combination: slow path */
+    pivot = i;
     for (++combination[i]; i < k - 1; ++i) {
         combination[i + 1] = combination[i] + 1;
     }
 
-    return 0;
+    return pivot;
 }
 
 /**
  * combinationsGetSize
  *
- * Computation size of combinations data structure based on number of combinations and k parameter
+ * Computation size of combinations data structure based on number of combinations
  *
  * Input:
  *      unsigned long long numCombinations
- *      unsigned char k
  *
  * Output:
  *      None
  *
  * Description:
  *  This function computes the size of combinations data structure based on number of
- *  combinations and k parameter.
+ *  combinations, each of them being stored as its pivot.
  *  In case the size computation encounters an overflow error, this function returns 0.
  *
  * Parameters:
  *      numCombinations: number of combinations corresponding to nCk
- *      k: k parameter of nCk.
  *
  * Return (unsigned long long):
  *  The size of combinations data structure if no error is encountered, 0 otherwise.
  */
-static unsigned long long combinationsGetSize(unsigned long long numCombinations, unsigned char k)
+static unsigned long long combinationsGetSize(unsigned long long numCombinations)
 {
-    /* Check for overflow in size computation */
-    if (numCombinations > ((18446744073709551615ULL - sizeof(struct combinations)) / k)) {
+    /* Check for overflow in size computation, each combination is stored as its pivot */
+    if (numCombinations > (18446744073709551615ULL - sizeof(struct combinations))) {
         /* Overflow detected, return 0 */
         return 0ULL;
     }
 
     /* Return size of combinations data structure */
-    return ((numCombinations * k) + sizeof(struct combinations));
+    return (numCombinations + sizeof(struct combinations));
 }
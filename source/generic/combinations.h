@@ -28,7 +28,7 @@ struct combinations
     unsigned long long numCombinations;     /* Number of combinations of k elements out of n (nCk) */
     unsigned char n;                        /* Dimension of set n */
     unsigned char k;                        /* Dimension of subsets k */
-    unsigned char buff[];                   /* Array of combinations: each combination is an array of k elements */
+    unsigned char pivots[];                 /* Array of pivots: index of first element of each combination changed from previous one */
 };
 
 
@@ -45,7 +45,11 @@ struct combinations
  *      None
  *
  * Description:
- *  This function computes the combinations of k elements out of n.
+ *  This function computes the combinations of k elements out of n in lexicographic order.
+ *  Each combination is stored as its pivot only, i.e. the index of its first element changed
+ *  from previous combination: the pivot element is the previous one incremented by 1 and the
+ *  following elements are consecutive, hence each combination is rebuilt from the previous one
+ *  starting from the first combination. This requires a single byte per combination.
  *  In case the nCk computation encounters an error, this function returns 0.
  *  This code is based on Rosetta Code Combinations: C code for Lexicographic ordered generation.
  *  https://rosettacode.org/wiki/Combinations#Lexicographic_ordered_generation
@@ -84,6 +88,39 @@ struct combinations *computeCombinations(unsigned char n, unsigned char k);
  */
 void firstCombination(unsigned char k, unsigned char *combination);
 
+/**
+ * combinationFromRank
+ *
+ * Compute the combination of k elements out of n having the given rank
+ *
+ * Input:
+ *      unsigned char n
+ *      unsigned char k
+ *      unsigned long long rank
+ *
+ * Output:
+ *      unsigned char *combination
+ *
+ * Description:
+ *  This function computes the combination of k elements out of n having the given rank in
+ *  lexicographic order (unranking), i.e. the combination computed by computeCombinations()
+ *  at the given index. Each element is selected through the combinatorial number system:
+ *  the combinations starting with element c and followed by k-i-1 greater elements are
+ *  (n-c-1)C(k-i-1), hence candidate elements are skipped until the rank falls into their range.
+ *  This allows to split the combinations among Workers without computing the preceding ones
+ *
+ * Parameters:
+ *      n: n parameter of nCk
+ *      k: k parameter of nCk. RANGE: (0 <= k <= n)
+ *      rank: rank of requested combination. RANGE: (0 <= rank < nCk)
+ *      combination: buffer to be filled with requested combination
+ *
+ * Return (int):
+ *  0 in case the requested combination has been computed, -1 otherwise (invalid rank or
+ *  nCk computation error).
+ */
+int combinationFromRank(unsigned char n, unsigned char k, unsigned long long rank, unsigned char *combination);
+
 /**
  * nextCombination
  *
@@ -107,7 +144,8 @@ void firstCombination(unsigned char k, unsigned char *combination);
  *      combination: buffer to be filled with next combination in lexicographic order
  *
  * Return (int):
- *  0 in case the next combination in lexicographic order has been computed, -1 otherwise.
+ *  Index of first element changed from given combination in case the next combination in
+ *  lexicographic order has been computed, -1 otherwise.
  */
 int nextCombination(unsigned char n, unsigned char k, unsigned char *combination);
 
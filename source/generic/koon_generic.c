@@ -25,14 +25,45 @@
 #include "../koon.h"
 
 
-static double rbdKooNRecursiveStepS1d(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k);
-
-
 #if defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0
 /**
- * rbdKooNFillWorker
+ * rbdKooNResolveWorkers
+ *
+ * Resolve KooN RBD Workers
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the KooN RBD Workers. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdKooNResolveWorkers(void)
+{
+    /* Resolve fill KooN output Worker */
+    koonWorkers.fillWorker = &rbdKooNFillWorkerS1d;
+    /* Resolve generic KooN RBD Worker */
+    koonWorkers.genericWorker = &rbdKooNGenericWorkerS1d;
+    /* Resolve identical KooN RBD Worker */
+    koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerS1d;
+    /* Resolve all KooN RBDs Worker */
+    koonWorkers.allWorker = &rbdKooNAllWorkerS1d;
+}
+#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
+
+/**
+ * rbdKooNFillWorkerS1d
  *
- * Fill output Reliability with fixed value Worker function
+ * Fill output Reliability with fixed value Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -52,7 +83,7 @@ static double rbdKooNRecursiveStepS1d(struct rbdKooNGenericData *data, unsigned
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdKooNFillWorker(void *arg)
+HIDDEN void *rbdKooNFillWorkerS1d(void *arg)
 {
     struct rbdKooNFillData *data;
     unsigned int time;
@@ -60,22 +91,22 @@ HIDDEN void *rbdKooNFillWorker(void *arg)
     /* Retrieve fill Output data structure */
     data = (struct rbdKooNFillData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* For each time instant... */
-    while (time < data->numTimes) {
+    while (time < data->batch.tEnd) {
         /* Fill output Reliability array with fixed value */
         data->output[time] = data->value;
-        time += data->numCores;
+        time += data->batch.numBatches;
     }
 
     return NULL;
 }
 
 /**
- * rbdKooNGenericWorker
+ * rbdKooNGenericWorkerS1d
  *
- * Generic KooN RBD Worker function
+ * Generic KooN RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -84,7 +115,7 @@ HIDDEN void *rbdKooNFillWorker(void *arg)
  *      None
  *
  * Description:
- *  This function implements the generic KooN RBD Worker.
+ *  This function implements the generic KooN RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system
  *
  * Parameters:
@@ -95,7 +126,7 @@ HIDDEN void *rbdKooNFillWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdKooNGenericWorker(void *arg)
+HIDDEN void *rbdKooNGenericWorkerS1d(void *arg)
 {
     struct rbdKooNGenericData *data;
     unsigned int time;
@@ -103,36 +134,36 @@ HIDDEN void *rbdKooNGenericWorker(void *arg)
     /* Retrieve generic KooN RBD data */
     data = (struct rbdKooNGenericData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
-    if (data->bRecursive == 0) {
+    if (data->bDynamic == 0) {
         /* If compute unreliability flag is not set... */
         if (data->bComputeUnreliability == 0) {
             /* For each time instant to be processed... */
-            while (time < data->numTimes) {
+            while (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepS1d(data, time);
                 /* Increment current time instant */
-                time += data->numCores;
+                time += data->batch.numBatches;
             }
         }
         else {
             /* For each time instant to be processed... */
-            while (time < data->numTimes) {
+            while (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepS1d(data, time);
                 /* Increment current time instant */
-                time += data->numCores;
+                time += data->batch.numBatches;
             }
         }
     }
     else {
         /* For each time instant to be processed... */
-        while (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
+        while (time < data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepS1d(data, time);
             /* Increment current time instant */
-            time += data->numCores;
+            time += data->batch.numBatches;
         }
     }
 
@@ -140,9 +171,54 @@ HIDDEN void *rbdKooNGenericWorker(void *arg)
 }
 
 /**
- * rbdKooNIdenticalWorker
+ * rbdKooNAllWorkerS1d
+ *
+ * All KooN RBDs Worker function without SIMD instruction sets
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the all KooN RBDs Worker without SIMD instruction sets.
+ *  It is responsible to compute the reliabilities over a given batch of the KooN RBD systems
+ *  with K in [1, N] sharing the same components
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data. It is provided as a
+ *                      void * in order to be compliant with pthread_create API and to thus allow
+ *                      SMP computation of KooN RBD
+ *
+ * Return (void *):
+ *  NULL
+ */
+HIDDEN void *rbdKooNAllWorkerS1d(void *arg)
+{
+    struct rbdKooNGenericData *data;
+    unsigned int time;
+
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+    /* Retrieve first time instant to be processed by worker */
+    time = data->batch.tBegin + data->batch.batchIdx;
+
+    /* For each time instant to be processed... */
+    while (time < data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepS1d(data, time);
+        /* Increment current time instant */
+        time += data->batch.numBatches;
+    }
+
+    return NULL;
+}
+
+/**
+ * rbdKooNIdenticalWorkerS1d
  *
- * Identical KooN RBD Worker function
+ * Identical KooN RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -151,7 +227,7 @@ HIDDEN void *rbdKooNGenericWorker(void *arg)
  *      None
  *
  * Description:
- *  This function implements the identical KooN RBD Worker.
+ *  This function implements the identical KooN RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system by using
  *  previously computed nCk values
  *
@@ -163,7 +239,7 @@ HIDDEN void *rbdKooNGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdKooNIdenticalWorker(void *arg)
+HIDDEN void *rbdKooNIdenticalWorkerS1d(void *arg)
 {
     struct rbdKooNIdenticalData *data;
     unsigned int time;
@@ -171,31 +247,30 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
     /* Retrieve identical KooN RBD data */
     data = (struct rbdKooNIdenticalData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* If compute unreliability flag is not set... */
     if (data->bComputeUnreliability == 0) {
         /* For each time instant to be processed... */
-        while (time < data->numTimes) {
+        while (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepS1d(data, time);
             /* Increment current time instant */
-            time += data->numCores;
+            time += data->batch.numBatches;
         }
     }
     else {
         /* For each time instant to be processed... */
-        while (time < data->numTimes) {
+        while (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepS1d(data, time);
             /* Increment current time instant */
-            time += data->numCores;
+            time += data->batch.numBatches;
         }
     }
 
     return NULL;
 }
-#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
 
 /**
  * rbdKooNGenericSuccessStepS1d
@@ -212,7 +287,13 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
  * Description:
  *  This function implements the generic KooN RBD function.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  taking into account the working components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -223,46 +304,89 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
  */
 HIDDEN void rbdKooNGenericSuccessStepS1d(struct rbdKooNGenericData *data, unsigned int time)
 {
+    double s1dR[data->numComponents];
+    double s1dU[data->numComponents];
+    double s1dG[data->numComponents];
+    double s1dS[data->numComponents + 1];
     double s1dStep;
     double s1dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    s1dS[data->numComponents] = 1.0;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        s1dR[jj] = data->reliabilities[(jj * data->numTimes) + time];
+        s1dU[jj] = 1.0 - s1dR[jj];
+        /* Compute suffix product of unreliabilities of components */
+        s1dS[jj] = s1dS[jj + 1] * s1dU[jj];
+    }
 
     /* Initialize reliability of current time instant to 0 */
     s1dRes = 0.0;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step reliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             s1dStep = 1.0;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Does the component belong to the working components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step reliability for reliability of current component */
-                    s1dStep *= data->reliabilities[(jj * data->numTimes) + time];
-                    /* Advance to next working component in combination */
-                    if (++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step reliability for unreliability of current component */
-                    s1dStep *= (1.0 - data->reliabilities[(jj * data->numTimes) + time]);
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for unreliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    s1dStep *= s1dU[component];
                 }
+                s1dG[jj] = s1dStep;
+                s1dStep *= s1dR[combination[jj]];
+                ++component;
             }
 
-            /* Perform partial sum for computation of KooN reliability */
-            s1dRes += s1dStep;
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+            s1dRes += s1dStep * s1dS[combination[comb->k - 1] + 1];
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now failed */
+                s1dG[pivot] *= s1dU[combination[pivot]];
+                ++combination[pivot];
+                /* Multiply products of preceding components for reliability of pivot component */
+                s1dStep = s1dG[pivot] * s1dR[combination[pivot]];
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    s1dG[jj] = s1dStep;
+                    s1dStep *= s1dR[combination[jj]];
+                }
+
+                /* Perform partial sum for computation of KooN reliability, accounting for components following last element */
+                s1dRes += s1dStep * s1dS[combination[comb->k - 1] + 1];
+            }
         }
     }
 
@@ -285,7 +409,13 @@ HIDDEN void rbdKooNGenericSuccessStepS1d(struct rbdKooNGenericData *data, unsign
  * Description:
  *  This function implements the generic KooN RBD function.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the failed components. Combinations are visited in lexicographic
+ *  order, so that the products of the components preceding the first changed element
+ *  are reused from previous combination, requiring O(1) products per combination on average.
+ *  Reliabilities and unreliabilities of all components are loaded once into a scratch tile,
+ *  so that combinations are evaluated without accessing the reliabilities matrix.
+ *  Only the range of combinations assigned to the Worker is visited, its first combination
+ *  being unranked by the caller, so that combinations can be split among Workers
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -296,46 +426,89 @@ HIDDEN void rbdKooNGenericSuccessStepS1d(struct rbdKooNGenericData *data, unsign
  */
 HIDDEN void rbdKooNGenericFailStepS1d(struct rbdKooNGenericData *data, unsigned int time)
 {
+    double s1dR[data->numComponents];
+    double s1dU[data->numComponents];
+    double s1dG[data->numComponents];
+    double s1dS[data->numComponents + 1];
     double s1dStep;
     double s1dRes;
-    int ii, jj, idx;
-    unsigned long long numCombinations;
+    struct combinations *comb;
+    unsigned char combination[UCHAR_MAX];
+    unsigned char pivot;
+    int ii, jj;
+    int component;
+    unsigned long long idx;
     unsigned long long offset;
+    unsigned long long first;
+    unsigned long long last;
+
+    /* For each component, from the last one... */
+    s1dS[data->numComponents] = 1.0;
+    for (jj = data->numComponents - 1; jj >= 0; --jj) {
+        /* Load reliability and compute unreliability of component once into scratch tile */
+        s1dR[jj] = data->reliabilities[(jj * data->numTimes) + time];
+        s1dU[jj] = 1.0 - s1dR[jj];
+        /* Compute suffix product of reliabilities of components */
+        s1dS[jj] = s1dS[jj + 1] * s1dR[jj];
+    }
 
     /* Initialize reliability of current time instant to 1 */
     s1dRes = 1.0;
 
+    /* Initialize rank of first combination of current set to 0 */
+    offset = 0;
+
     /* For each possible set of combinations... */
     for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
-        /* Retrieve number of combinations */
-        numCombinations = data->combs->combinations[ii]->numCombinations;
-        offset = 0;
-        /* For each combination... */
-        while (numCombinations-- > 0) {
-            /* Initialize step unreliability to 1 */
+        /* Retrieve current set of combinations */
+        comb = data->combs->combinations[ii];
+        /* Compute range of combinations of current set processed by Worker */
+        first = (data->combBegin > offset) ? (data->combBegin - offset) : 0;
+        last = (data->combEnd > offset) ? (data->combEnd - offset) : 0;
+        if (last > comb->numCombinations) {
+            last = comb->numCombinations;
+        }
+        offset += comb->numCombinations;
+
+        /* Is any combination of current set processed by Worker? */
+        if (first < last) {
+            /* Compute products of first combination, from first component */
             s1dStep = 1.0;
-            idx = 0;
-            /* For each component... */
-            for (jj = 0; jj < data->numComponents; ++jj) {
-                /* Does the component belong to the failed components for current combination? */
-                if (data->combs->combinations[ii]->buff[offset + idx] == jj) {
-                    /* Multiply step unreliability for unreliability of current component */
-                    s1dStep *= (1.0 - data->reliabilities[(jj * data->numTimes) + time]);
-                    /* Advance to next failed component in combination */
-                    if(++idx == data->combs->combinations[ii]->k) {
-                        idx = 0;
-                    }
-                }
-                else {
-                    /* Multiply step unreliability for reliability of current component */
-                    s1dStep *= data->reliabilities[(jj * data->numTimes) + time];
+            component = 0;
+            for (jj = 0; jj < comb->k; ++jj) {
+                /* First combination of set is (0, 1, ..., k-1), otherwise it has been unranked into KooN RBD data */
+                combination[jj] = (first == 0) ? (unsigned char)jj : data->combination[jj];
+                /* Multiply products for reliability of components preceding current element */
+                for (; component < combination[jj]; ++component) {
+                    s1dStep *= s1dR[component];
                 }
+                s1dG[jj] = s1dStep;
+                s1dStep *= s1dU[combination[jj]];
+                ++component;
             }
 
-            /* Perform partial difference for computation of KooN reliability */
-            s1dRes -= s1dStep;
-            /* Increment offset for combination access */
-            offset += data->combs->combinations[ii]->k;
+            /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+            s1dRes -= s1dStep * s1dS[combination[comb->k - 1] + 1];
+
+            /* For each following combination, in lexicographic order... */
+            for (idx = first + 1; idx < last; ++idx) {
+                /* Retrieve index of first element changed from previous combination */
+                pivot = comb->pivots[idx];
+                /* Pivot element is incremented by 1, i.e. its previous component is now working */
+                s1dG[pivot] *= s1dR[combination[pivot]];
+                ++combination[pivot];
+                /* Multiply products of preceding components for unreliability of pivot component */
+                s1dStep = s1dG[pivot] * s1dU[combination[pivot]];
+                /* Elements following the pivot one are consecutive components */
+                for (jj = pivot + 1; jj < comb->k; ++jj) {
+                    combination[jj] = combination[jj - 1] + 1;
+                    s1dG[jj] = s1dStep;
+                    s1dStep *= s1dU[combination[jj]];
+                }
+
+                /* Perform partial difference for computation of KooN reliability, accounting for components following last element */
+                s1dRes -= s1dStep * s1dS[combination[comb->k - 1] + 1];
+            }
         }
     }
 
@@ -344,9 +517,9 @@ HIDDEN void rbdKooNGenericFailStepS1d(struct rbdKooNGenericData *data, unsigned
 }
 
 /**
- * rbdKooNRecursionS1d
+ * rbdKooNDynamicStepS1d
  *
- * Compute KooN RBD though Recursive method
+ * Compute KooN RBD through Dynamic Programming
  *
  * Input:
  *      struct rbdKooNGenericData *data
@@ -356,7 +529,11 @@ HIDDEN void rbdKooNGenericFailStepS1d(struct rbdKooNGenericData *data, unsigned
  *      None
  *
  * Description:
- *  This function computes the reliability of KooN RBD system through recursion
+ *  This function computes the reliability of KooN RBD system through Dynamic Programming.
+ *  It keeps a rolling array of the probabilities of having at least k working components, with
+ *  k in [0, K], among the first n components. Each component updates such probabilities, from
+ *  the highest k down to the lowest one, skipping the ones that do not contribute anymore to the
+ *  final result, thus requiring O(N*K) operations per time instant
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -365,32 +542,55 @@ HIDDEN void rbdKooNGenericFailStepS1d(struct rbdKooNGenericData *data, unsigned
  * Return:
  *  None
  */
-HIDDEN void rbdKooNRecursionS1d(struct rbdKooNGenericData *data, unsigned int time)
+HIDDEN void rbdKooNDynamicStepS1d(struct rbdKooNGenericData *data, unsigned int time)
 {
-    double s1dRes;
+    double s1dA[data->minComponents + 1];
+    double s1dR;
+    unsigned char n;
+    unsigned char k;
+    unsigned char kMin;
+    unsigned char kMax;
+
+    /* Initialize probabilities of having at least k working components out of no components */
+    s1dA[0] = 1.0;
+    for (k = 1; k <= data->minComponents; ++k) {
+        s1dA[k] = 0.0;
+    }
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        s1dR = data->reliabilities[(n * data->numTimes) + time];
+        /* Compute range of probabilities affecting the one of at least K working components */
+        kMax = (n < data->minComponents) ? (n + 1) : data->minComponents;
+        kMin = ((data->minComponents + n) >= data->numComponents) ? ((data->minComponents + n + 1) - data->numComponents) : 1;
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = kMax; k >= kMin; --k) {
+            s1dA[k] += s1dR * (s1dA[k - 1] - s1dA[k]);
+        }
+    }
 
-    /* Recursively compute reliability of KooN RBD at current time instant */
-    s1dRes = rbdKooNRecursiveStepS1d(data, time, data->numComponents, data->minComponents);
     /* Cap the computed reliability and set it into output array */
-    data->output[time] = capReliabilityS1d(s1dRes);
+    data->output[time] = capReliabilityS1d(s1dA[data->minComponents]);
 }
 
 /**
- * rbdKooNIdenticalSuccessStepS1d
+ * rbdKooNAllStepS1d
  *
- * Identical KooN RBD Step function from working components
+ * Compute all KooN RBDs with K in [1, N] through Dynamic Programming
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      struct rbdKooNGenericData *data
  *      unsigned int time
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the identical KooN RBD function.
- *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the working components
+ *  This function computes the reliabilities of all KooN RBD systems with K in [1, N] sharing the
+ *  same components. It keeps a rolling array of the probabilities of having at least k
+ *  working components among the first n components, which requires O(N^2) operations per time
+ *  instant. The reliability of the KooN RBD system with K=k is stored into row k-1 of output matrix
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -399,50 +599,39 @@ HIDDEN void rbdKooNRecursionS1d(struct rbdKooNGenericData *data, unsigned int ti
  * Return:
  *  None
  */
-HIDDEN void rbdKooNIdenticalSuccessStepS1d(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN void rbdKooNAllStepS1d(struct rbdKooNGenericData *data, unsigned int time)
 {
+    double s1dA[data->numComponents + 1];
     double s1dR;
-    double s1dTmp1, s1dTmp2;
-    double s1dRes;
-    int numWork, numFail;
-    int ii, jj;
-
-    /* Retrieve reliability */
-    s1dR = data->reliabilities[time];
-    /* Initialize reliability to 0 */
-    s1dRes = 0.0;
-    /* Compute product between reliability and unreliability */
-    s1dTmp2 = s1dR * (1.0 - s1dR);
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step reliability to nCi */
-        s1dTmp1 = (double)data->nCi[ii];
-        /* Compute number of working and failed components */
-        numWork = data->minComponents + ii;
-        numFail = data->numComponents - data->minComponents - ii;
-        /* For each failed component... */
-        for (jj = (numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for product of reliability and unreliability of component */
-            s1dTmp1 *= s1dTmp2;
-        }
-        /* For each non-considered working component... */
-        for (jj = (numWork - numFail - 1); jj >= 0; --jj) {
-            /* Multiply step reliability for reliability of component */
-            s1dTmp1 *= s1dR;
+    unsigned char n;
+    unsigned char k;
+
+    /* Initialize probability of having at least 0 working components out of no components */
+    s1dA[0] = 1.0;
+
+    /* For each component... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Load reliability of current component */
+        s1dR = data->reliabilities[(n * data->numTimes) + time];
+        /* Compute probability of having all the first n+1 components working */
+        s1dA[n + 1] = s1dR * s1dA[n];
+        /* Update probabilities of having at least k working components, from highest k */
+        for (k = n; k > 0; --k) {
+            s1dA[k] += s1dR * (s1dA[k - 1] - s1dA[k]);
         }
-        /* Add reliability of current iteration */
-        s1dRes += s1dTmp1;
     }
 
-    /* Cap the computed reliability and set it into output array */
-    data->output[time] = capReliabilityS1d(s1dRes);
+    /* For each K in [1, N]... */
+    for (n = 0; n < data->numComponents; ++n) {
+        /* Cap the computed reliability and set it into output matrix */
+        data->output[(n * data->numTimes) + time] = capReliabilityS1d(s1dA[n + 1]);
+    }
 }
 
 /**
- * rbdKooNIdenticalFailStepS1d
+ * rbdKooNIdenticalSuccessStepS1d
  *
- * Identical KooN RBD Step function from failed components
+ * Identical KooN RBD Step function from working components
  *
  * Input:
  *      struct rbdKooNIdenticalData *data
@@ -454,7 +643,10 @@ HIDDEN void rbdKooNIdenticalSuccessStepS1d(struct rbdKooNIdenticalData *data, un
  * Description:
  *  This function implements the identical KooN RBD function.
  *  It is responsible to compute the reliability of a KooN RBD system
- *  taking into account the failed components
+ *  taking into account the working components. The reliability is a polynomial of the reliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of unreliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
@@ -463,88 +655,107 @@ HIDDEN void rbdKooNIdenticalSuccessStepS1d(struct rbdKooNIdenticalData *data, un
  * Return:
  *  None
  */
-HIDDEN void rbdKooNIdenticalFailStepS1d(struct rbdKooNIdenticalData *data, unsigned int time)
+HIDDEN void rbdKooNIdenticalSuccessStepS1d(struct rbdKooNIdenticalData *data, unsigned int time)
 {
+    double s1dR;
     double s1dU;
-    double s1dTmp1, s1dTmp2;
+    double s1dPow;
     double s1dRes;
-    int numWork, numFail;
-    int ii, jj;
+    unsigned int exponent;
+    int ii;
 
     /* Retrieve reliability */
-    s1dTmp2 = data->reliabilities[time];
+    s1dR = data->reliabilities[time];
     /* Compute unreliability */
-    s1dU = 1.0 - s1dTmp2;
-    /* Initialize reliability to 1 */
-    s1dRes = 1.0;
-    /* Compute product between reliability and unreliability */
-    s1dTmp2 = s1dTmp2 * s1dU;
-
-    /* For each iteration... */
-    for (ii = data->numComponents - data->minComponents; ii >= 0; --ii) {
-        /* Initialize step unreliability to nCi */
-        s1dTmp1 = (double)data->nCi[ii];
-        /* Compute number of working and failed components */
-        numWork = data->numComponents - data->minComponents - ii;
-        numFail = data->minComponents + ii;
-        /* For each working component... */
-        for (jj = (numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for product of reliability and unreliability of component */
-            s1dTmp1 *= s1dTmp2;
-        }
-        /* For each non-considered failed component... */
-        for (jj = (numFail - numWork - 1); jj >= 0; --jj) {
-            /* Multiply step unreliability for unreliability of component */
-            s1dTmp1 *= s1dU;
+    s1dU = 1.0 - s1dR;
+
+    /* Initialize Horner accumulator to nCN, i.e. all components working */
+    s1dRes = data->nCi[data->numComponents - data->minComponents];
+    /* Initialize power of unreliability to 1 */
+    s1dPow = 1.0;
+    /* For each number of working components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of unreliability of the other components */
+        s1dPow *= s1dU;
+        /* Horner step: multiply accumulator for reliability and add nCi weighted by power of unreliability */
+        s1dRes = (s1dRes * s1dR) + (data->nCi[ii] * s1dPow);
+    }
+    /* Multiply accumulator for reliability of K working components through exponentiation by squaring */
+    s1dPow = s1dR;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            s1dRes *= s1dPow;
         }
-        /* Subtract unreliability of current iteration */
-        s1dRes -= s1dTmp1;
+        s1dPow *= s1dPow;
     }
 
     /* Cap the computed reliability and set it into output array */
     data->output[time] = capReliabilityS1d(s1dRes);
 }
 
-
 /**
- * rbdKooNRecursiveStepS1d
+ * rbdKooNIdenticalFailStepS1d
  *
- * Recursive KooN RBD Step function
+ * Identical KooN RBD Step function from failed components
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      struct rbdKooNIdenticalData *data
  *      unsigned int time
- *      unsigned char n
- *      unsigned char k
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the recursive KooN RBD function.
- *  It is responsible to recursively compute the reliability of a KooN RBD system
+ *  This function implements the identical KooN RBD function.
+ *  It is responsible to compute the reliability of a KooN RBD system
+ *  taking into account the failed components. The unreliability is a polynomial of the unreliability
+ *  of components, whose coefficients are the binomial coefficients nCi: it is evaluated through
+ *  Horner scheme, keeping a running power of reliability, so that each time instant requires
+ *  O(N) operations instead of O(N^2) ones and all the terms are positive (no cancellation)
  *
  * Parameters:
  *      data: KooN RBD data structure
  *      time: current time instant over which KooN RBD shall be computed
- *      n: current number of components in KooN RBD
- *      k: minimum number of working components in KooN RBD
  *
- * Return (double):
- *  Computed reliability
+ * Return:
+ *  None
  */
-static double rbdKooNRecursiveStepS1d(struct rbdKooNGenericData *data, unsigned int time, unsigned char n, unsigned char k)
+HIDDEN void rbdKooNIdenticalFailStepS1d(struct rbdKooNIdenticalData *data, unsigned int time)
 {
+    double s1dR;
+    double s1dU;
+    double s1dPow;
     double s1dRes;
+    unsigned int exponent;
+    int ii;
 
-    /* Recursively compute the Reliability */
-    --n;
-    s1dRes = data->reliabilities[(n * data->numTimes) + time];
-    if ((k-1) > 0) {
-        s1dRes *= rbdKooNRecursiveStepS1d(data, time, n, k-1);
+    /* Retrieve reliability */
+    s1dR = data->reliabilities[time];
+    /* Compute unreliability */
+    s1dU = 1.0 - s1dR;
+
+    /* Initialize Horner accumulator to nCN, i.e. all components failed */
+    s1dRes = data->nCi[data->numComponents - data->minComponents];
+    /* Initialize power of reliability to 1 */
+    s1dPow = 1.0;
+    /* For each number of failed components, from N-1 down to K... */
+    for (ii = data->numComponents - data->minComponents - 1; ii >= 0; --ii) {
+        /* Update power of reliability of the other components */
+        s1dPow *= s1dR;
+        /* Horner step: multiply accumulator for unreliability and add nCi weighted by power of reliability */
+        s1dRes = (s1dRes * s1dU) + (data->nCi[ii] * s1dPow);
     }
-    if (k <= n) {
-        s1dRes += (1.0 - data->reliabilities[(n * data->numTimes) + time]) * rbdKooNRecursiveStepS1d(data, time, n, k);
+    /* Multiply accumulator for unreliability of K failed components through exponentiation by squaring */
+    s1dPow = s1dU;
+    for (exponent = data->minComponents; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            s1dRes *= s1dPow;
+        }
+        s1dPow *= s1dPow;
     }
-    return s1dRes;
+    /* Compute reliability from unreliability */
+    s1dRes = 1.0 - s1dRes;
+
+    /* Cap the computed reliability and set it into output array */
+    data->output[time] = capReliabilityS1d(s1dRes);
 }
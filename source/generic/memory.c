@@ -0,0 +1,124 @@
+/*
+ *  Component: memory.c
+ *  Allocation of aligned and padded reliability matrices
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "rbd_internal_generic.h"
+
+#include "../rbd.h"
+#include "../os/os.h"
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+
+#define MATRIX_ALIGNMENT            (CACHE_LINE_SIZE)   /* Alignment (in bytes) of each matrix row */
+#define MATRIX_ROW_PADDING          (V8D)               /* Number of time instants each matrix row is padded to */
+
+
+/**
+ * rbdAllocMatrix
+ *
+ * Allocate an aligned and padded reliability matrix
+ *
+ * Input:
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      unsigned int *ld
+ *
+ * Description:
+ *  This function allocates a NxLD matrix of doubles whose rows start on a cache line boundary.
+ *  The leading dimension LD is numTimes rounded up to the widest vector size, so that the same
+ *  time instant of all rows shares the same alignment. On Linux, matrices of at least one huge
+ *  page are advised to be backed by transparent huge pages. The whole matrix, padding included,
+ *  is zeroed. The matrix shall be released through rbdFree()
+ *
+ * Parameters:
+ *      numComponents: number of rows of matrix (N), 1 to allocate an array
+ *      numTimes: number of time instants of each row (T)
+ *      ld: leading dimension of matrix (LD), i.e. number of doubles between the beginning of
+ *                      two consecutive rows
+ *
+ * Return (double *):
+ *  != NULL in case of successful allocation, NULL otherwise
+ */
+EXTERN double *rbdAllocMatrix(unsigned char numComponents, unsigned int numTimes, unsigned int *ld)
+{
+    unsigned int numPadded;
+    size_t size;
+    double *matrix;
+
+    /* Check input parameters */
+    if ((numComponents == 0) || (numTimes == 0) || (ld == NULL)) {
+        return NULL;
+    }
+    if (numTimes > (UINT_MAX - (MATRIX_ROW_PADDING - 1))) {
+        return NULL;
+    }
+
+    /* Round number of time instants up to the row padding */
+    numPadded = ((numTimes + (MATRIX_ROW_PADDING - 1)) / MATRIX_ROW_PADDING) * MATRIX_ROW_PADDING;
+
+    /* Check that size of matrix fits size_t, e.g. on 32-bit targets */
+    if ((size_t)numPadded > ((SIZE_MAX / sizeof(double)) / numComponents)) {
+        return NULL;
+    }
+    size = (size_t)numComponents * numPadded * sizeof(double);
+
+    /* Allocate aligned matrix */
+    matrix = (double *)allocateAlignedMemory(size, MATRIX_ALIGNMENT);
+    if (matrix == NULL) {
+        return NULL;
+    }
+
+    /* Zero the matrix, so that padding time instants are valid reliabilities */
+    memset(matrix, 0, size);
+
+    *ld = numPadded;
+    return matrix;
+}
+
+/**
+ * rbdFree
+ *
+ * Free a reliability matrix
+ *
+ * Input:
+ *      double *matrix
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases a matrix allocated through rbdAllocMatrix()
+ *
+ * Parameters:
+ *      matrix: matrix to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdFree(double *matrix)
+{
+    freeAlignedMemory(matrix);
+}
@@ -27,9 +27,39 @@
 
 #if defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0
 /**
- * rbdParallelGenericWorker
+ * rbdParallelResolveWorkers
  *
- * Parallel RBD Worker function
+ * Resolve Parallel RBD Workers
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the Parallel RBD Workers. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdParallelResolveWorkers(void)
+{
+    /* Resolve generic Parallel RBD Worker */
+    parallelWorkers.genericWorker = &rbdParallelGenericWorkerS1d;
+    /* Resolve identical Parallel RBD Worker */
+    parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerS1d;
+}
+#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
+
+/**
+ * rbdParallelGenericWorkerS1d
+ *
+ * Generic Parallel RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -38,7 +68,7 @@
  *      None
  *
  * Description:
- *  This function implements the generic Parallel RBD Worker.
+ *  This function implements the generic Parallel RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of a Parallel RBD system
  *
  * Parameters:
@@ -49,7 +79,7 @@
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdParallelGenericWorker(void *arg)
+HIDDEN void *rbdParallelGenericWorkerS1d(void *arg)
 {
     struct rbdParallelData *data;
     unsigned int time;
@@ -57,23 +87,23 @@ HIDDEN void *rbdParallelGenericWorker(void *arg)
     /* Retrieve Parallel RBD data */
     data = (struct rbdParallelData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* For each time instant to be processed... */
-    while (time < data->numTimes) {
+    while (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepS1d(data, time);
         /* Increment current time instant */
-        time += data->numCores;
+        time += data->batch.numBatches;
     }
 
     return NULL;
 }
 
 /**
- * rbdParallelIdenticalWorker
+ * rbdParallelIdenticalWorkerS1d
  *
- * Identical Parallel RBD Worker function
+ * Identical Parallel RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -82,7 +112,7 @@ HIDDEN void *rbdParallelGenericWorker(void *arg)
  *      None
  *
  * Description:
- *  This function implements the identical Parallel RBD Worker.
+ *  This function implements the identical Parallel RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of an identical Parallel RBD system
  *
  * Parameters:
@@ -93,7 +123,7 @@ HIDDEN void *rbdParallelGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdParallelIdenticalWorker(void *arg)
+HIDDEN void *rbdParallelIdenticalWorkerS1d(void *arg)
 {
     struct rbdParallelData *data;
     unsigned int time;
@@ -101,19 +131,18 @@ HIDDEN void *rbdParallelIdenticalWorker(void *arg)
     /* Retrieve Parallel RBD data */
     data = (struct rbdParallelData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* For each time instant to be processed... */
-    while (time < data->numTimes) {
+    while (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepS1d(data, time);
         /* Increment current time instant */
-        time += data->numCores;
+        time += data->batch.numBatches;
     }
 
     return NULL;
 }
-#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
 
 /**
  * rbdParallelGenericStepS1d
@@ -167,7 +196,8 @@ HIDDEN void rbdParallelGenericStepS1d(struct rbdParallelData *data, unsigned int
  * Description:
  *  This function implements the identical Parallel RBD step.
  *  It is responsible to compute the reliability of a Parallel block with identical components
- *  given their reliability
+ *  given their reliability. The power of the unreliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Parallel RBD data structure
@@ -175,17 +205,25 @@ HIDDEN void rbdParallelGenericStepS1d(struct rbdParallelData *data, unsigned int
  */
 HIDDEN void rbdParallelIdenticalStepS1d(struct rbdParallelData *data, unsigned int time)
 {
-    unsigned char component;
+    unsigned char bit;
     double s1dU;
     double s1dRes;
 
     /* Load unreliability */
     s1dU = (1.0 - data->reliabilities[time]);
 
-    /* Compute reliability of Parallel RBD at current time instant */
+    /* Compute reliability of Parallel RBD at current time instant through exponentiation by squaring */
     s1dRes = s1dU;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        s1dRes *= s1dU;
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        s1dRes *= s1dRes;
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            s1dRes *= s1dU;
+        }
     }
     s1dRes = (1.0 - s1dRes);
 
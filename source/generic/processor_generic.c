@@ -22,20 +22,44 @@
 
 #include "rbd_internal_generic.h"
 
+#include "../rbd.h"
+
 #include "../aarch64/rbd_internal_aarch64.h"
 #include "../amd64/rbd_internal_amd64.h"
 #include "../x86/rbd_internal_x86.h"
 #include "../os/os.h"
+#include "../bridge.h"
+#include "../koon.h"
+#include "../parallel.h"
+#include "../series.h"
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define ENV_MAX_THREADS             "RBD_MAX_THREADS"   /* Environment variable capping the number of used cores */
+#define ENV_ISA                     "RBD_ISA"           /* Environment variable capping the instruction set family */
 
 
 struct cpu
 {
     unsigned int initialized;       /* Processor information acquired */
     unsigned int numCores;          /* Number of cores available */
+    unsigned int maxThreads;        /* Maximum number of used cores requested through rbdSetMaxThreads, 0 if not set */
+    unsigned int envMaxThreads;     /* Maximum number of used cores requested through environment, 0 if not set */
+    enum rbdIsa isa;                /* Instruction set family requested through rbdSetIsa or environment */
+};
+
+
+static const char *isaNames[] = {   /* Names of instruction set families, indexed by enum rbdIsa */
+    "auto", "scalar", "sse2", "avx", "fma3", "avx512f", "neon"
 };
 
 
 static void retrieveCpuInfo(void);
+static unsigned int isaAvailable(enum rbdIsa isa);
+static void resolveWorkers(void);
 
 
 static struct cpu cpu;
@@ -63,13 +87,264 @@ static struct cpu cpu;
  */
 HIDDEN unsigned int getNumberOfCores(void)
 {
+    unsigned int numCores;
+    unsigned int maxThreads;
+
+    /* Get number of cores usable by the process */
+    numCores = getMaxNumberOfCores();
+
+    /* Cap number of cores to the maximum requested through API */
+    maxThreads = __atomic_load_n(&cpu.maxThreads, __ATOMIC_RELAXED);
+    if ((maxThreads != 0) && (maxThreads < numCores)) {
+        numCores = maxThreads;
+    }
+
+    /* Return number of cores in SMP system */
+    return numCores;
+}
+
+/**
+ * getMaxNumberOfCores
+ *
+ * Number of cores usable by the process retrieval in an SMP system
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the number of cores in an SMP system, capped by the environment only.
+ *  Unlike getNumberOfCores(), it ignores the cap requested through rbdSetMaxThreads(), which can
+ *  change at any time: it is used to size resources, such as the thread pool, that are created once
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (unsigned int):
+ *  Number of cores usable by the process
+ */
+HIDDEN unsigned int getMaxNumberOfCores(void)
+{
+    unsigned int numCores;
+
     /* Get CPU-specific information */
     getCpuInfo();
 
-    /* Return number of cores in SMP system */
-    return cpu.numCores;
+    /* Cap number of cores to the maximum requested through environment */
+    numCores = cpu.numCores;
+    if ((cpu.envMaxThreads != 0) && (cpu.envMaxThreads < numCores)) {
+        numCores = cpu.envMaxThreads;
+    }
+
+    /* Return number of cores usable by the process */
+    return numCores;
+}
+
+/**
+ * rbdSetMaxThreads
+ *
+ * Cap the number of threads used to compute RBD blocks
+ *
+ * Input:
+ *      unsigned int maxThreads
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function caps the number of threads (calling thread included) used by each RBD computation.
+ *  The number of cores detected on the system and the RBD_MAX_THREADS environment variable, when set,
+ *  remain upper bounds of the requested value. The built-in thread pool is sized regardless of
+ *  the requested value, so that a cap can be later raised or removed.
+ *  It can be invoked while RBD computations are in progress, which use either the old or the new cap
+ *
+ * Parameters:
+ *      maxThreads: maximum number of threads, 0 to remove the cap
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdSetMaxThreads(unsigned int maxThreads)
+{
+    /* Atomically store the cap, since it is read by concurrent RBD computations */
+    __atomic_store_n(&cpu.maxThreads, maxThreads, __ATOMIC_RELAXED);
+}
+
+/**
+ * getVectorWidth
+ *
+ * Retrieve the vector width of the active instruction set
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the number of time instants processed by each step
+ *  of the RBD Workers with the instruction set used on current processor
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (unsigned int):
+ *  Number of doubles in a vector of the active instruction set
+ */
+HIDDEN unsigned int getVectorWidth(void)
+{
+    /* Get CPU-specific information */
+    getCpuInfo();
+
+#if CPU_ENABLE_SIMD != 0
+#if defined(ARCH_AMD64)
+    if (amd64Avx512fSupported()) {
+        return V8D;
+    }
+    if (amd64AvxSupported()) {
+        return V4D;
+    }
+    if (amd64Sse2Supported()) {
+        return V2D;
+    }
+#elif defined(ARCH_X86)
+    if (x86Sse2Supported()) {
+        return V2D;
+    }
+#elif defined(ARCH_AARCH64)
+    if (isaEnabled(RBD_ISA_NEON)) {
+        return V2D;
+    }
+#endif
+#endif /* CPU_ENABLE_SIMD != 0 */
+
+    return S1D;
+}
+
+
+/**
+ * isaEnabled
+ *
+ * Instruction set family enabled for RBD Workers
+ *
+ * Input:
+ *      enum rbdIsa isa
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function checks whether the provided instruction set family is not excluded
+ *  by the cap requested through rbdSetIsa() or RBD_ISA environment variable. It does
+ *  not check the processor capabilities
+ *
+ * Parameters:
+ *      isa: instruction set family to be checked
+ *
+ * Return (unsigned int):
+ *  1 if instruction set family is enabled, 0 otherwise
+ */
+HIDDEN unsigned int isaEnabled(enum rbdIsa isa)
+{
+    /* Get CPU-specific information */
+    getCpuInfo();
+
+    return ((cpu.isa == RBD_ISA_AUTO) || (isa <= cpu.isa)) ? 1 : 0;
 }
 
+/**
+ * rbdSetIsa
+ *
+ * Cap the instruction set family used by RBD Workers
+ *
+ * Input:
+ *      enum rbdIsa isa
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function caps the instruction set family used by RBD Workers and resolves again
+ *  the Workers of all RBD blocks. It shall not be invoked while RBD computations are in progress
+ *
+ * Parameters:
+ *      isa: requested instruction set family, RBD_ISA_AUTO to remove the cap
+ *
+ * Return (int):
+ *  0 in case of successful selection, < 0 otherwise (family not available on current platform)
+ */
+EXTERN int rbdSetIsa(enum rbdIsa isa)
+{
+    /* Get CPU-specific information */
+    getCpuInfo();
+
+    /* Is requested instruction set family not available on current platform? */
+    if (isaAvailable(isa) == 0) {
+        return -1;
+    }
+
+    /* Store requested instruction set family and resolve RBD Workers */
+    cpu.isa = isa;
+    resolveWorkers();
+
+    return 0;
+}
+
+/**
+ * rbdGetIsa
+ *
+ * Retrieve the instruction set family used by RBD Workers
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the instruction set family actually used by RBD Workers, given
+ *  the processor capabilities and the requested cap
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (enum rbdIsa):
+ *  Active instruction set family, never RBD_ISA_AUTO
+ */
+EXTERN enum rbdIsa rbdGetIsa(void)
+{
+    /* Get CPU-specific information */
+    getCpuInfo();
+
+#if CPU_ENABLE_SIMD != 0
+#if defined(ARCH_AMD64)
+    if (amd64Avx512fSupported()) {
+        return RBD_ISA_AVX512F;
+    }
+    if (amd64Fma3Supported()) {
+        return RBD_ISA_FMA3;
+    }
+    if (amd64AvxSupported()) {
+        return RBD_ISA_AVX;
+    }
+    if (amd64Sse2Supported()) {
+        return RBD_ISA_SSE2;
+    }
+#elif defined(ARCH_X86)
+    if (x86Sse2Supported()) {
+        return RBD_ISA_SSE2;
+    }
+#elif defined(ARCH_AARCH64)
+    if (isaEnabled(RBD_ISA_NEON)) {
+        return RBD_ISA_NEON;
+    }
+#endif
+#endif /* CPU_ENABLE_SIMD != 0 */
+
+    return RBD_ISA_SCALAR;
+}
 
 /**
  * getCpuInfo
@@ -130,8 +405,13 @@ HIDDEN void getCpuInfo(void)
  */
 static void retrieveCpuInfo(void)
 {
+    char *envIsa;
+    unsigned int isa;
 #if CPU_SMP != 0
     long numCores;
+    char *envMaxThreads;
+    char *end;
+    unsigned long maxThreads;
 #endif /* CPU_SMP */
 
     /* By default assume that only one core is used */
@@ -147,8 +427,28 @@ static void retrieveCpuInfo(void)
 
     /* Store number of cores */
     cpu.numCores = (unsigned int)numCores;
+
+    /* Retrieve maximum number of used cores from environment, if set */
+    envMaxThreads = getenv(ENV_MAX_THREADS);
+    if (envMaxThreads != NULL) {
+        maxThreads = strtoul(envMaxThreads, &end, 10);
+        if ((end != envMaxThreads) && (*end == '\0') && (maxThreads <= UINT_MAX)) {
+            cpu.envMaxThreads = (unsigned int)maxThreads;
+        }
+    }
 #endif /* CPU_SMP */
 
+    /* Retrieve instruction set family cap from environment, if set and available */
+    cpu.isa = RBD_ISA_AUTO;
+    envIsa = getenv(ENV_ISA);
+    if (envIsa != NULL) {
+        for (isa = RBD_ISA_AUTO; isa <= RBD_ISA_NEON; ++isa) {
+            if ((strcmp(envIsa, isaNames[isa]) == 0) && (isaAvailable((enum rbdIsa)isa) != 0)) {
+                cpu.isa = (enum rbdIsa)isa;
+            }
+        }
+    }
+
 #if CPU_ENABLE_SIMD != 0
 #if defined(ARCH_AMD64)
     retrieveAmd64CpuInfo();
@@ -157,3 +457,83 @@ static void retrieveCpuInfo(void)
 #endif
 #endif /* CPU_ENABLE_SIMD != 0 */
 }
+
+/**
+ * isaAvailable
+ *
+ * Instruction set family available on current platform
+ *
+ * Input:
+ *      enum rbdIsa isa
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function checks whether RBD Workers exploiting the provided instruction set family
+ *  are built for current platform. It does not check the processor capabilities, since
+ *  a family wider than the supported ones is a valid cap
+ *
+ * Parameters:
+ *      isa: instruction set family to be checked
+ *
+ * Return (unsigned int):
+ *  1 if instruction set family is available, 0 otherwise
+ */
+static unsigned int isaAvailable(enum rbdIsa isa)
+{
+    switch (isa) {
+    case RBD_ISA_AUTO:
+        return 1;
+#if (CPU_ENABLE_SIMD != 0) && defined(ARCH_AMD64)
+    case RBD_ISA_SCALAR:
+    case RBD_ISA_SSE2:
+    case RBD_ISA_AVX:
+    case RBD_ISA_FMA3:
+    case RBD_ISA_AVX512F:
+        return 1;
+#elif (CPU_ENABLE_SIMD != 0) && defined(ARCH_X86)
+    case RBD_ISA_SCALAR:
+    case RBD_ISA_SSE2:
+        return 1;
+#elif (CPU_ENABLE_SIMD != 0) && defined(ARCH_AARCH64)
+    case RBD_ISA_SCALAR:
+    case RBD_ISA_NEON:
+        return 1;
+#else
+    case RBD_ISA_SCALAR:
+        return 1;
+#endif
+    default:
+        return 0;
+    }
+}
+
+/**
+ * resolveWorkers
+ *
+ * Resolve the Workers of all RBD blocks
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function resolves again the Workers of all RBD blocks after a change of the
+ *  requested instruction set family
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void resolveWorkers(void)
+{
+    rbdSeriesResolveWorkers();
+    rbdParallelResolveWorkers();
+    rbdBridgeResolveWorkers();
+    rbdKooNResolveWorkers();
+}
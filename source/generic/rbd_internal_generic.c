@@ -22,6 +22,8 @@
 
 #include "rbd_internal_generic.h"
 
+#include <stdint.h>
+
 
 /**
  * capReliabilityS1d
@@ -119,37 +121,244 @@ HIDDEN void prefetchWrite(double *reliability, unsigned char numComponents, unsi
     }
 }
 
+/**
+ * computeBatch
+ *
+ * Compute the work batch processed by an RBD Worker
+ *
+ * Input:
+ *      double *output
+ *      unsigned int numTimes
+ *      unsigned int numCores
+ *      unsigned int batchIdx
+ *
+ * Output:
+ *      struct rbdBatch *batch
+ *
+ * Description:
+ *  This function computes the range of time instants processed by the requested RBD Worker.
+ *  When CPU_SMP_CONTIGUOUS is set, each Worker owns a contiguous range of time instants
+ *  whose boundaries are aligned to the cache lines of output array, otherwise all Workers
+ *  process interleaved blocks of the whole range of time instants
+ *
+ * Parameters:
+ *      batch: work batch of RBD Worker
+ *      output: array of computed reliabilities
+ *      numTimes: total number of time instants
+ *      numCores: number of used cores
+ *      batchIdx: index of RBD Worker
+ */
+HIDDEN void computeBatch(struct rbdBatch *batch, double *output, unsigned int numTimes, unsigned int numCores, unsigned int batchIdx)
+{
+#if CPU_SMP_CONTIGUOUS != 0
+    unsigned int lineSize;
+    unsigned int head;
+    unsigned int batchSize;
+
+    /* Number of time instants in a cache line */
+    lineSize = CACHE_LINE_SIZE / sizeof(double);
+    /* Number of time instants preceding the first cache line boundary of output array */
+    head = (unsigned int)((CACHE_LINE_SIZE - ((uintptr_t)output % CACHE_LINE_SIZE)) % CACHE_LINE_SIZE) / sizeof(double);
+    /* Compute batch size as a multiple of cache line */
+    batchSize = ceilDivision(ceilDivision(numTimes, numCores), lineSize) * lineSize;
+
+    /* Each Worker owns a single contiguous range of time instants */
+    batch->batchIdx = 0;
+    batch->numBatches = 1;
+    batch->tBegin = (batchIdx == 0) ? 0 : (head + (batchIdx * batchSize));
+    batch->tEnd = head + ((batchIdx + 1) * batchSize);
+    if ((batchIdx + 1) == numCores) {
+        batch->tEnd = numTimes;
+    }
+    if (batch->tBegin > numTimes) {
+        batch->tBegin = numTimes;
+    }
+    if (batch->tEnd > numTimes) {
+        batch->tEnd = numTimes;
+    }
+#else
+    /* All Workers process interleaved blocks of the whole range of time instants */
+    batch->batchIdx = batchIdx;
+    batch->numBatches = numCores;
+    batch->tBegin = 0;
+    batch->tEnd = numTimes;
+#endif /* CPU_SMP_CONTIGUOUS */
+}
+
 #if CPU_SMP != 0
+/**
+ * computeTimeCost
+ *
+ * Estimate the cost of each time instant of RBD block
+ *
+ * Input:
+ *      enum rbdWorkload workload
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *      unsigned long long numCombinations
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function estimates the number of scalar floating point operations performed
+ *  by the RBD Worker to compute the requested workload over a single time instant
+ *
+ * Parameters:
+ *      workload: workload of RBD Worker
+ *      numComponents: number of components in RBD block (N)
+ *      minComponents: minimum number of components required by KooN RBD block (K)
+ *      numCombinations: total number of combinations analyzed by KooN RBD block
+ *
+ * Return (double):
+ *  Estimated cost of each time instant
+ */
+HIDDEN double computeTimeCost(enum rbdWorkload workload, unsigned char numComponents, unsigned char minComponents, unsigned long long numCombinations)
+{
+    double timeCost;
+
+    switch (workload) {
+    case WORKLOAD_SERIES_GENERIC:
+        /* One product for each component */
+        timeCost = (double)numComponents + 1.0;
+        break;
+    case WORKLOAD_SERIES_IDENTICAL:
+    case WORKLOAD_PARALLEL_IDENTICAL:
+        /* At most two products for each bit of N (exponentiation by squaring) */
+        for (timeCost = 1.0; numComponents > 1; numComponents >>= 1) {
+            timeCost += 2.0;
+        }
+        break;
+    case WORKLOAD_PARALLEL_GENERIC:
+        /* One product and one subtraction for each component */
+        timeCost = (2.0 * numComponents) + 1.0;
+        break;
+    case WORKLOAD_BRIDGE_GENERIC:
+        timeCost = 30.0;
+        break;
+    case WORKLOAD_BRIDGE_IDENTICAL:
+        timeCost = 20.0;
+        break;
+    case WORKLOAD_KOON_COMBINATIONS:
+        /* Two products updating the pivot, (amortised) one product and one multiply-add for each combination, plus suffix products */
+        timeCost = (4.0 * (double)numCombinations) + (2.0 * numComponents) + 1.0;
+        break;
+    case WORKLOAD_KOON_DYNAMIC:
+        /* One subtraction and one multiply-add for each of the (at most) K probabilities updated by each component */
+        timeCost = (2.0 * minComponents * (numComponents - minComponents + 1)) + 1.0;
+        break;
+    case WORKLOAD_KOON_IDENTICAL:
+        /* Two products and one multiply-add for each of the N-K Horner steps, two products for each of the 8 bits of K */
+        timeCost = (3.0 * (numComponents - minComponents)) + (2.0 * 8.0) + 1.0;
+        break;
+    case WORKLOAD_KOON_ALL:
+        /* One subtraction and one multiply-add for each of the N(N-1)/2 updated probabilities, one cap for each K */
+        timeCost = (double)numComponents * (numComponents + 1);
+        break;
+    case WORKLOAD_FILL:
+    default:
+        timeCost = 1.0;
+        break;
+    }
+
+    return timeCost;
+}
+
 /**
  * computeNumCores
  *
  * Compute the number of cores in SMP system used to analyze RBD block
  *
  * Input:
- *      int numTimes
+ *      unsigned int numTimes
+ *      double timeCost
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  Computes the number of cores when SMP is used. The estimated work, taking into account
+ *  the vector width of the active instruction set, is split among the available cores
+ *  provided that each of them is assigned at least MIN_BATCH_COST and a cache line of output
+ *
+ * Parameters:
+ *      numTimes: total number of time instants
+ *      timeCost: estimated cost of each time instant, see computeTimeCost()
+ *
+ * Return (unsigned int):
+ *  Number of used cores
+ */
+HIDDEN unsigned int computeNumCores(unsigned int numTimes, double timeCost) {
+    unsigned int numCores;
+    unsigned int maxCores;
+    double totalCost;
+
+    /* Retrieve number of cores available in SMP system */
+    numCores = getNumberOfCores();
+
+    /* Estimate total work in vector operations of active instruction set */
+    totalCost = ((double)numTimes * timeCost) / getVectorWidth();
+    /* Each core shall be assigned at least the minimum work... */
+    if (totalCost < ((double)numCores * MIN_BATCH_COST)) {
+        numCores = (unsigned int)(totalCost / MIN_BATCH_COST);
+    }
+    /* ...and at least a cache line of time instants */
+    maxCores = ceilDivision(numTimes, CACHE_LINE_SIZE / sizeof(double));
+    numCores = minimum(numCores, maxCores);
+
+    /* Return number of threads required */
+    return maximum(numCores, 1);
+}
+
+/**
+ * computeNumSplits
+ *
+ * Compute the number of cores in SMP system sharing the combinations of KooN RBD block
+ *
+ * Input:
+ *      unsigned int numTimes
+ *      double timeCost
+ *      unsigned long long numCombinations
  *
  * Output:
  *      None
  *
  * Description:
- *  Computes the number of cores when SMP is used
+ *  Computes the number of cores when the combinations analyzed by a KooN RBD block, besides
+ *  its time instants, are split among them. The estimated work, taking into account the
+ *  partially filled vectors when time instants are fewer than the vector width, is split among
+ *  the available cores provided that each of them is assigned at least MIN_BATCH_COST and a
+ *  combination. Since cores sharing time instants compute them into private arrays, no cache
+ *  line of output is required. The returned cores shall be arranged into a grid whose time
+ *  dimension is given by computeNumCores()
  *
  * Parameters:
  *      numTimes: total number of time instants
+ *      timeCost: estimated cost of each time instant, see computeTimeCost()
+ *      numCombinations: total number of combinations analyzed by KooN RBD block
  *
- * Return (int):
- *  Batch size
+ * Return (unsigned int):
+ *  Number of used cores
  */
-HIDDEN int computeNumCores(int numTimes) {
-    int numCores, batchSize;
+HIDDEN unsigned int computeNumSplits(unsigned int numTimes, double timeCost, unsigned long long numCombinations) {
+    unsigned int numCores;
+    double totalCost;
 
     /* Retrieve number of cores available in SMP system */
     numCores = getNumberOfCores();
-    /* Compute batch size */
-    batchSize = maximum(ceilDivision(numTimes, numCores), MIN_BATCH_SIZE);
-    /* Compute number of threads required */
-    numCores = ceilDivision(numTimes, batchSize);
+
+    /* Estimate total work in vector operations of active instruction set, partially filled vectors included */
+    totalCost = (double)ceilDivision(numTimes, getVectorWidth()) * timeCost;
+    /* Each core shall be assigned at least the minimum work... */
+    if (totalCost < ((double)numCores * MIN_BATCH_COST)) {
+        numCores = (unsigned int)(totalCost / MIN_BATCH_COST);
+    }
+    /* ...and at least a combination */
+    if (numCombinations < (unsigned long long)numCores) {
+        numCores = (unsigned int)numCombinations;
+    }
+
     /* Return number of threads required */
-    return numCores;
+    return maximum(numCores, 1);
 }
 #endif /* CPU_SMP */
@@ -27,6 +27,7 @@
 #include <stdlib.h>
 
 #include "../compiler/compiler.h"
+#include "../rbd.h"
 #include "architecture.h"
 
 
@@ -35,6 +36,8 @@
 #define V4D                         (4)         /* Vector of 4 doubles (256bit)         */
 #define V8D                         (8)         /* Vector of 8 doubles (512bit)         */
 
+#define CACHE_LINE_SIZE             (64)        /* Size of cache line (in bytes)        */
+
 
 /*< If CPU_SMP flag has not been provided, disable SMP */
 #ifndef CPU_SMP
@@ -46,11 +49,50 @@
 #define CPU_ENABLE_SIMD                 0
 #endif /* CPU_ENABLE_SIMD */
 
+/*< If CPU_SMP_CONTIGUOUS flag has not been provided, assign a contiguous range of time instants to each batch */
+#ifndef CPU_SMP_CONTIGUOUS
+#define CPU_SMP_CONTIGUOUS              1
+#endif /* CPU_SMP_CONTIGUOUS */
+
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
-#define MIN_BATCH_SIZE              (10000)     /* Minimum batch size in SMP RBD resolution */
+#define MIN_BATCH_COST              (50000)     /* Minimum estimated work (vector operations) of each core in SMP RBD resolution */
+#define MIN_TILE_COST               (5000)      /* Minimum estimated work (vector operations) of each time tile in SMP RBD resolution */
 #endif /* CPU_SMP */
 
 
+/**
+ * Workload of RBD Worker, used to estimate the cost of each time instant
+ */
+enum rbdWorkload
+{
+    WORKLOAD_FILL = 0,                  /* Fill of output array with fixed value */
+    WORKLOAD_SERIES_GENERIC,            /* Generic Series RBD */
+    WORKLOAD_SERIES_IDENTICAL,          /* Identical Series RBD */
+    WORKLOAD_PARALLEL_GENERIC,          /* Generic Parallel RBD */
+    WORKLOAD_PARALLEL_IDENTICAL,        /* Identical Parallel RBD */
+    WORKLOAD_BRIDGE_GENERIC,            /* Generic Bridge RBD */
+    WORKLOAD_BRIDGE_IDENTICAL,          /* Identical Bridge RBD */
+    WORKLOAD_KOON_COMBINATIONS,         /* Generic KooN RBD through combinations */
+    WORKLOAD_KOON_DYNAMIC,              /* Generic KooN RBD through Dynamic Programming */
+    WORKLOAD_KOON_IDENTICAL,            /* Identical KooN RBD */
+    WORKLOAD_KOON_ALL                   /* All KooN RBDs with K in [1, N] */
+};
+
+/**
+ * Work batch processed by RBD Worker
+ *
+ * The Worker processes the time instants in [tBegin, tEnd) that belong to its batch,
+ * being the range split into numBatches interleaved batches (blocks of vector size)
+ */
+struct rbdBatch
+{
+    unsigned int batchIdx;              /* Index of work batch within time range */
+    unsigned int numBatches;            /* Number of work batches interleaved within time range */
+    unsigned int tBegin;                /* First time instant of time range */
+    unsigned int tEnd;                  /* Time instant following the last one of time range */
+};
+
+
 /**
  * maximum
  *
@@ -77,6 +119,32 @@ static inline ALWAYS_INLINE int maximum(int a, int b) {
     return (a >= b) ? a : b;
 }
 
+/**
+ * minimum
+ *
+ * Compute minimum between two numbers
+ *
+ * Input:
+ *      int a
+ *      int b
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  Computes the minimum between two numbers
+ *
+ * Parameters:
+ *      a: first value for minimum computation
+ *      b: second value for minimum computation
+ *
+ * Return (int):
+ *  minimum value
+ */
+static inline ALWAYS_INLINE int minimum(int a, int b) {
+    return (a <= b) ? a : b;
+}
+
 /**
  * floorDivision
  *
@@ -247,28 +315,193 @@ void getCpuInfo(void);
  */
 unsigned int getNumberOfCores(void);
 
+/**
+ * getMaxNumberOfCores
+ *
+ * Number of cores usable by the process retrieval in an SMP system
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the number of cores in an SMP system, capped by the environment only.
+ *  Unlike getNumberOfCores(), it ignores the cap requested through rbdSetMaxThreads(), which can
+ *  change at any time: it is used to size resources, such as the thread pool, that are created once
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (unsigned int):
+ *  Number of cores usable by the process
+ */
+unsigned int getMaxNumberOfCores(void);
+
+/**
+ * getVectorWidth
+ *
+ * Retrieve the vector width of the active instruction set
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the number of time instants processed by each step
+ *  of the RBD Workers with the instruction set used on current processor
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (unsigned int):
+ *  Number of doubles in a vector of the active instruction set
+ */
+unsigned int getVectorWidth(void);
+
+/**
+ * isaEnabled
+ *
+ * Instruction set family enabled for RBD Workers
+ *
+ * Input:
+ *      enum rbdIsa isa
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function checks whether the provided instruction set family is not excluded
+ *  by the cap requested through rbdSetIsa() or RBD_ISA environment variable. It does
+ *  not check the processor capabilities
+ *
+ * Parameters:
+ *      isa: instruction set family to be checked
+ *
+ * Return (unsigned int):
+ *  1 if instruction set family is enabled, 0 otherwise
+ */
+unsigned int isaEnabled(enum rbdIsa isa);
+
+/**
+ * computeBatch
+ *
+ * Compute the work batch processed by an RBD Worker
+ *
+ * Input:
+ *      double *output
+ *      unsigned int numTimes
+ *      unsigned int numCores
+ *      unsigned int batchIdx
+ *
+ * Output:
+ *      struct rbdBatch *batch
+ *
+ * Description:
+ *  This function computes the range of time instants processed by the requested RBD Worker.
+ *  When CPU_SMP_CONTIGUOUS is set, each Worker owns a contiguous range of time instants
+ *  whose boundaries are aligned to the cache lines of output array, otherwise all Workers
+ *  process interleaved blocks of the whole range of time instants
+ *
+ * Parameters:
+ *      batch: work batch of RBD Worker
+ *      output: array of computed reliabilities
+ *      numTimes: total number of time instants
+ *      numCores: number of used cores
+ *      batchIdx: index of RBD Worker
+ */
+void computeBatch(struct rbdBatch *batch, double *output, unsigned int numTimes, unsigned int numCores, unsigned int batchIdx);
+
 #if CPU_SMP != 0
+/**
+ * computeTimeCost
+ *
+ * Estimate the cost of each time instant of RBD block
+ *
+ * Input:
+ *      enum rbdWorkload workload
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *      unsigned long long numCombinations
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function estimates the number of scalar floating point operations performed
+ *  by the RBD Worker to compute the requested workload over a single time instant
+ *
+ * Parameters:
+ *      workload: workload of RBD Worker
+ *      numComponents: number of components in RBD block (N)
+ *      minComponents: minimum number of components required by KooN RBD block (K)
+ *      numCombinations: total number of combinations analyzed by KooN RBD block
+ *
+ * Return (double):
+ *  Estimated cost of each time instant
+ */
+double computeTimeCost(enum rbdWorkload workload, unsigned char numComponents, unsigned char minComponents, unsigned long long numCombinations);
+
 /**
  * computeNumCores
  *
  * Compute the number of cores in SMP system used to analyze RBD block
  *
  * Input:
- *      int numTimes
+ *      unsigned int numTimes
+ *      double timeCost
  *
  * Output:
  *      None
  *
  * Description:
- *  Computes the number of cores when SMP is used
+ *  Computes the number of cores when SMP is used. The estimated work, taking into account
+ *  the vector width of the active instruction set, is split among the available cores
+ *  provided that each of them is assigned at least MIN_BATCH_COST and a cache line of output
  *
  * Parameters:
  *      numTimes: total number of time instants
+ *      timeCost: estimated cost of each time instant, see computeTimeCost()
  *
- * Return (int):
- *  Batch size
+ * Return (unsigned int):
+ *  Number of used cores
+ */
+unsigned int computeNumCores(unsigned int numTimes, double timeCost);
+
+/**
+ * computeNumSplits
+ *
+ * Compute the number of cores in SMP system sharing the combinations of KooN RBD block
+ *
+ * Input:
+ *      unsigned int numTimes
+ *      double timeCost
+ *      unsigned long long numCombinations
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  Computes the number of cores when the combinations analyzed by a KooN RBD block, besides
+ *  its time instants, are split among them. The estimated work, taking into account the
+ *  partially filled vectors when time instants are fewer than the vector width, is split among
+ *  the available cores provided that each of them is assigned at least MIN_BATCH_COST and a
+ *  combination. Since cores sharing time instants compute them into private arrays, no cache
+ *  line of output is required. The returned cores shall be arranged into a grid whose time
+ *  dimension is given by computeNumCores()
+ *
+ * Parameters:
+ *      numTimes: total number of time instants
+ *      timeCost: estimated cost of each time instant, see computeTimeCost()
+ *      numCombinations: total number of combinations analyzed by KooN RBD block
+ *
+ * Return (unsigned int):
+ *  Number of used cores
  */
-int computeNumCores(int numTimes);
+unsigned int computeNumSplits(unsigned int numTimes, double timeCost, unsigned long long numCombinations);
 #endif /* CPU_SMP */
 
 
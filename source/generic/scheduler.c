@@ -0,0 +1,500 @@
+/*
+ *  Component: scheduler.c
+ *  Work-stealing scheduler of time tiles processed by RBD Workers
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "scheduler.h"
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+#include <pthread.h>
+#include <stdint.h>
+
+
+struct tileQueue
+{
+    pthread_mutex_t mutex;              /* Mutex protecting the tile queue */
+    unsigned int head;                  /* First queued tile */
+    unsigned int tail;                  /* Tile following the last queued one */
+};
+
+struct tileJob
+{
+    struct tileScheduler *scheduler;    /* Scheduler of time tiles */
+    unsigned int workerIdx;             /* Index of Worker */
+    fpWorker fpWorker;                  /* RBD Worker processing a tile */
+    void *args;                         /* Arguments provided to RBD Worker */
+    struct rbdBatch *batch;             /* Work batch of RBD Worker */
+};
+
+struct tileScheduler
+{
+    unsigned int numTimes;              /* Total number of time instants */
+    unsigned int numWorkers;            /* Number of Workers */
+    unsigned int tileSize;              /* Number of time instants of each tile */
+    unsigned int head;                  /* Number of time instants preceding first cache line of output */
+    unsigned int queueSize;             /* Size of each tile queue (multiple of cache line) */
+    unsigned char *queues;              /* Tile queues of Workers */
+    struct tileJob *jobs;               /* Tile jobs of Workers */
+};
+
+
+static int popTile(struct tileScheduler *scheduler, unsigned int workerIdx, unsigned int *tileIdx);
+static int stealTile(struct tileScheduler *scheduler, unsigned int workerIdx, unsigned int *tileIdx);
+static void computeTile(struct tileScheduler *scheduler, unsigned int tileIdx, struct rbdBatch *batch);
+
+static inline ALWAYS_INLINE struct tileQueue *getTileQueue(struct tileScheduler *scheduler, unsigned int workerIdx);
+
+
+/**
+ * computeTileSize
+ *
+ * Compute the size of time tiles given the estimated cost of each time instant
+ *
+ * Input:
+ *      unsigned int numTimes
+ *      double timeCost
+ *      unsigned int numWorkers
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the smallest tile whose estimated work is at least MIN_TILE_COST,
+ *  so that expensive time instants are split into many tiles that idle Workers can steal.
+ *  The tile size is capped so that at least TILES_PER_WORKER tiles are queued to each Worker
+ *
+ * Parameters:
+ *      numTimes: total number of time instants
+ *      timeCost: estimated cost of each time instant, see computeTimeCost()
+ *      numWorkers: number of Workers pulling tiles from scheduler
+ *
+ * Return (unsigned int):
+ *  Number of time instants of each tile
+ */
+HIDDEN unsigned int computeTileSize(unsigned int numTimes, double timeCost, unsigned int numWorkers)
+{
+    double tileSize;
+    unsigned int maxTileSize;
+
+    /* Smallest tile whose estimated work (in vector operations) is at least MIN_TILE_COST */
+    tileSize = ((double)MIN_TILE_COST * getVectorWidth()) / timeCost;
+    /* Largest tile still queuing TILES_PER_WORKER tiles to each Worker */
+    maxTileSize = ceilDivision(numTimes, numWorkers * TILES_PER_WORKER);
+
+    if (tileSize >= (double)maxTileSize) {
+        return maxTileSize;
+    }
+
+    return maximum((unsigned int)tileSize, 1);
+}
+
+/**
+ * allocateTileScheduler
+ *
+ * Allocate the work-stealing scheduler of time tiles
+ *
+ * Input:
+ *      double *output
+ *      unsigned int numTimes
+ *      unsigned int numWorkers
+ *      unsigned int tileSize
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function splits the time instants into tiles whose boundaries are aligned to the
+ *  cache lines of output array and evenly distributes contiguous ranges of tiles to the
+ *  queues of the Workers. The returned scheduler shall be released through freeTileScheduler()
+ *
+ * Parameters:
+ *      output: array of computed reliabilities
+ *      numTimes: total number of time instants
+ *      numWorkers: number of Workers pulling tiles from scheduler
+ *      tileSize: number of time instants of each tile, 0 to derive it from number of Workers
+ *
+ * Return (void *):
+ *  != NULL in case of successful scheduler allocation, NULL otherwise
+ */
+HIDDEN void *allocateTileScheduler(double *output, unsigned int numTimes, unsigned int numWorkers, unsigned int tileSize)
+{
+    struct tileScheduler *scheduler;
+    struct tileQueue *queue;
+    unsigned int lineSize;
+    unsigned int queueSize;
+    unsigned int numTiles;
+    unsigned int idx;
+
+    /* Number of time instants in a cache line */
+    lineSize = CACHE_LINE_SIZE / sizeof(double);
+    /* Size of each tile queue, padded to cache line to avoid false sharing among Workers */
+    queueSize = ceilDivision(sizeof(struct tileQueue), CACHE_LINE_SIZE) * CACHE_LINE_SIZE;
+
+    /* Allocate scheduler, tile jobs and tile queues, return NULL in case of allocation failure */
+    scheduler = (struct tileScheduler *)malloc(sizeof(struct tileScheduler) +
+                                               (sizeof(struct tileJob) * numWorkers) +
+                                               (queueSize * (numWorkers + 1)));
+    if (scheduler == NULL) {
+        return NULL;
+    }
+    scheduler->jobs = (struct tileJob *)(scheduler + 1);
+    scheduler->queues = (unsigned char *)&scheduler->jobs[numWorkers];
+    /* Align first tile queue to cache line */
+    scheduler->queues += (CACHE_LINE_SIZE - ((uintptr_t)scheduler->queues % CACHE_LINE_SIZE)) % CACHE_LINE_SIZE;
+
+    /* By default, queue TILES_PER_WORKER tiles to each Worker */
+    if (tileSize == 0) {
+        tileSize = ceilDivision(numTimes, numWorkers * TILES_PER_WORKER);
+    }
+    /* Tile size is a multiple of cache line */
+    tileSize = ceilDivision(tileSize, lineSize) * lineSize;
+
+    scheduler->numTimes = numTimes;
+    scheduler->numWorkers = numWorkers;
+    scheduler->tileSize = tileSize;
+    scheduler->head = (unsigned int)((CACHE_LINE_SIZE - ((uintptr_t)output % CACHE_LINE_SIZE)) % CACHE_LINE_SIZE) / sizeof(double);
+    scheduler->queueSize = queueSize;
+
+    /* Compute number of tiles, first tile also includes the time instants preceding first cache line */
+    numTiles = 1;
+    if (numTimes > scheduler->head) {
+        numTiles = ceilDivision(numTimes - scheduler->head, tileSize);
+    }
+
+    /* Queue a contiguous range of tiles to each Worker */
+    for (idx = 0; idx < numWorkers; ++idx) {
+        queue = getTileQueue(scheduler, idx);
+        if (pthread_mutex_init(&queue->mutex, NULL) != 0) {
+            while (idx > 0) {
+                (void)pthread_mutex_destroy(&getTileQueue(scheduler, --idx)->mutex);
+            }
+            free(scheduler);
+            return NULL;
+        }
+        queue->head = (unsigned int)(((unsigned long long)numTiles * idx) / numWorkers);
+        queue->tail = (unsigned int)(((unsigned long long)numTiles * (idx + 1)) / numWorkers);
+    }
+
+    return scheduler;
+}
+
+/**
+ * prepareTileJob
+ *
+ * Prepare the tile job of a Worker
+ *
+ * Input:
+ *      void *scheduler
+ *      unsigned int workerIdx
+ *      fpWorker fpWorker
+ *      void *args
+ *      struct rbdBatch *batch
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function prepares the job which repeatedly invokes the provided RBD Worker over the
+ *  time tiles pulled from the scheduler. The returned job shall be provided to rbdTileWorker()
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *      workerIdx: index of Worker
+ *      fpWorker: pointer to the RBD Worker function processing a tile
+ *      args: arguments provided to RBD Worker function
+ *      batch: work batch of RBD Worker, updated with the current tile before each invocation
+ *
+ * Return (void *):
+ *  Tile job of Worker
+ */
+HIDDEN void *prepareTileJob(void *scheduler, unsigned int workerIdx, fpWorker fpWorker, void *args, struct rbdBatch *batch)
+{
+    struct tileJob *job;
+
+    /* Prepare tile job */
+    job = &((struct tileScheduler *)scheduler)->jobs[workerIdx];
+    job->scheduler = (struct tileScheduler *)scheduler;
+    job->workerIdx = workerIdx;
+    job->fpWorker = fpWorker;
+    job->args = args;
+    job->batch = batch;
+
+    return job;
+}
+
+/**
+ * freeTileScheduler
+ *
+ * Free the work-stealing scheduler of time tiles
+ *
+ * Input:
+ *      void *scheduler
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the scheduler once all its tile jobs have been completed
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *
+ * Return:
+ *  None
+ */
+HIDDEN void freeTileScheduler(void *scheduler)
+{
+    unsigned int idx;
+
+    /* Destroy mutexes of tile queues */
+    for (idx = 0; idx < ((struct tileScheduler *)scheduler)->numWorkers; ++idx) {
+        (void)pthread_mutex_destroy(&getTileQueue((struct tileScheduler *)scheduler, idx)->mutex);
+    }
+
+    free(scheduler);
+}
+
+/**
+ * rbdTileWorker
+ *
+ * Tile Worker function
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function pulls time tiles from the queue of its Worker and invokes the RBD Worker
+ *  over each of them. Once its queue is empty, it steals half of the tiles still queued
+ *  to the most loaded Worker, until no tile is left
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a tile job. It is provided as a
+ *                      void * in order to be compliant with fpWorker type
+ *
+ * Return (void *):
+ *  NULL
+ */
+HIDDEN void *rbdTileWorker(void *arg)
+{
+    struct tileJob *job;
+    unsigned int tileIdx;
+
+    /* Retrieve tile job */
+    job = (struct tileJob *)arg;
+
+    /* For each tile either queued to Worker or stolen from other Workers... */
+    while ((popTile(job->scheduler, job->workerIdx, &tileIdx) != 0) ||
+           (stealTile(job->scheduler, job->workerIdx, &tileIdx) != 0)) {
+        /* Compute work batch of current tile */
+        computeTile(job->scheduler, tileIdx, job->batch);
+        /* Invoke the RBD Worker over current tile */
+        (void)(*job->fpWorker)(job->args);
+    }
+
+    return NULL;
+}
+
+
+/**
+ * popTile
+ *
+ * Pop a tile from the queue of Worker
+ *
+ * Input:
+ *      struct tileScheduler *scheduler
+ *      unsigned int workerIdx
+ *
+ * Output:
+ *      unsigned int *tileIdx
+ *
+ * Description:
+ *  This function pops the first tile queued to the requested Worker
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *      workerIdx: index of Worker
+ *      tileIdx: index of popped tile
+ *
+ * Return (int):
+ *  1 if a tile has been popped, 0 if queue of Worker is empty
+ */
+static int popTile(struct tileScheduler *scheduler, unsigned int workerIdx, unsigned int *tileIdx)
+{
+    struct tileQueue *queue;
+    int res;
+
+    res = 0;
+    queue = getTileQueue(scheduler, workerIdx);
+
+    (void)pthread_mutex_lock(&queue->mutex);
+    if (queue->head < queue->tail) {
+        *tileIdx = queue->head++;
+        res = 1;
+    }
+    (void)pthread_mutex_unlock(&queue->mutex);
+
+    return res;
+}
+
+/**
+ * stealTile
+ *
+ * Steal tiles from the queue of most loaded Worker
+ *
+ * Input:
+ *      struct tileScheduler *scheduler
+ *      unsigned int workerIdx
+ *
+ * Output:
+ *      unsigned int *tileIdx
+ *
+ * Description:
+ *  This function steals the second half of the tiles queued to the most loaded Worker.
+ *  The first stolen tile is returned, the remaining ones are queued to the requesting Worker
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *      workerIdx: index of requesting Worker
+ *      tileIdx: index of stolen tile
+ *
+ * Return (int):
+ *  1 if a tile has been stolen, 0 if queues of all Workers are empty
+ */
+static int stealTile(struct tileScheduler *scheduler, unsigned int workerIdx, unsigned int *tileIdx)
+{
+    struct tileQueue *queue;
+    unsigned int victimIdx;
+    unsigned int maxTiles;
+    unsigned int numTiles;
+    unsigned int tail;
+    unsigned int idx;
+
+    for (;;) {
+        /* Look for the most loaded Worker */
+        victimIdx = workerIdx;
+        maxTiles = 0;
+        for (idx = 1; idx < scheduler->numWorkers; ++idx) {
+            queue = getTileQueue(scheduler, (workerIdx + idx) % scheduler->numWorkers);
+            (void)pthread_mutex_lock(&queue->mutex);
+            numTiles = queue->tail - queue->head;
+            (void)pthread_mutex_unlock(&queue->mutex);
+            if (numTiles > maxTiles) {
+                maxTiles = numTiles;
+                victimIdx = (workerIdx + idx) % scheduler->numWorkers;
+            }
+        }
+
+        /* Are queues of all Workers empty? */
+        if (maxTiles == 0) {
+            return 0;
+        }
+
+        /* Steal the second half of the tiles queued to victim Worker */
+        queue = getTileQueue(scheduler, victimIdx);
+        (void)pthread_mutex_lock(&queue->mutex);
+        numTiles = queue->tail - queue->head;
+        tail = queue->tail;
+        queue->tail -= ceilDivision(numTiles, 2);
+        (void)pthread_mutex_unlock(&queue->mutex);
+
+        /* Has victim Worker emptied its queue meanwhile? Look for another one */
+        if (numTiles == 0) {
+            continue;
+        }
+
+        /* Return first stolen tile and queue the remaining ones to requesting Worker */
+        queue = getTileQueue(scheduler, workerIdx);
+        (void)pthread_mutex_lock(&queue->mutex);
+        *tileIdx = tail - ceilDivision(numTiles, 2);
+        queue->head = *tileIdx + 1;
+        queue->tail = tail;
+        (void)pthread_mutex_unlock(&queue->mutex);
+
+        return 1;
+    }
+}
+
+/**
+ * computeTile
+ *
+ * Compute the work batch of a tile
+ *
+ * Input:
+ *      struct tileScheduler *scheduler
+ *      unsigned int tileIdx
+ *
+ * Output:
+ *      struct rbdBatch *batch
+ *
+ * Description:
+ *  This function computes the contiguous range of time instants of the requested tile
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *      tileIdx: index of tile
+ *      batch: work batch of tile
+ *
+ * Return:
+ *  None
+ */
+static void computeTile(struct tileScheduler *scheduler, unsigned int tileIdx, struct rbdBatch *batch)
+{
+    batch->batchIdx = 0;
+    batch->numBatches = 1;
+    batch->tBegin = (tileIdx == 0) ? 0 : (scheduler->head + (tileIdx * scheduler->tileSize));
+    batch->tEnd = scheduler->head + ((tileIdx + 1) * scheduler->tileSize);
+    if (batch->tBegin > scheduler->numTimes) {
+        batch->tBegin = scheduler->numTimes;
+    }
+    if (batch->tEnd > scheduler->numTimes) {
+        batch->tEnd = scheduler->numTimes;
+    }
+}
+
+/**
+ * getTileQueue
+ *
+ * Retrieve the tile queue of Worker
+ *
+ * Input:
+ *      struct tileScheduler *scheduler
+ *      unsigned int workerIdx
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the tile queue of the requested Worker
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *      workerIdx: index of Worker
+ *
+ * Return (struct tileQueue *):
+ *  Tile queue of Worker
+ */
+static inline ALWAYS_INLINE struct tileQueue *getTileQueue(struct tileScheduler *scheduler, unsigned int workerIdx)
+{
+    return (struct tileQueue *)&scheduler->queues[scheduler->queueSize * workerIdx];
+}
+#endif /* CPU_SMP */
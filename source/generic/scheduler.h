@@ -0,0 +1,171 @@
+/*
+ *  Component: scheduler.h
+ *  Work-stealing scheduler of time tiles processed by RBD Workers
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SCHEDULER_H_
+#define SCHEDULER_H_
+
+
+#include "rbd_internal_generic.h"
+
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+#define TILES_PER_WORKER                (8)     /* Default number of time tiles initially queued to each Worker */
+
+
+/**
+ * computeTileSize
+ *
+ * Compute the size of time tiles given the estimated cost of each time instant
+ *
+ * Input:
+ *      unsigned int numTimes
+ *      double timeCost
+ *      unsigned int numWorkers
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the smallest tile whose estimated work is at least MIN_TILE_COST,
+ *  so that expensive time instants are split into many tiles that idle Workers can steal.
+ *  The tile size is capped so that at least TILES_PER_WORKER tiles are queued to each Worker
+ *
+ * Parameters:
+ *      numTimes: total number of time instants
+ *      timeCost: estimated cost of each time instant, see computeTimeCost()
+ *      numWorkers: number of Workers pulling tiles from scheduler
+ *
+ * Return (unsigned int):
+ *  Number of time instants of each tile
+ */
+unsigned int computeTileSize(unsigned int numTimes, double timeCost, unsigned int numWorkers);
+
+/**
+ * allocateTileScheduler
+ *
+ * Allocate the work-stealing scheduler of time tiles
+ *
+ * Input:
+ *      double *output
+ *      unsigned int numTimes
+ *      unsigned int numWorkers
+ *      unsigned int tileSize
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function splits the time instants into tiles whose boundaries are aligned to the
+ *  cache lines of output array and evenly distributes contiguous ranges of tiles to the
+ *  queues of the Workers. The returned scheduler shall be released through freeTileScheduler()
+ *
+ * Parameters:
+ *      output: array of computed reliabilities
+ *      numTimes: total number of time instants
+ *      numWorkers: number of Workers pulling tiles from scheduler
+ *      tileSize: number of time instants of each tile, 0 to derive it from number of Workers
+ *
+ * Return (void *):
+ *  != NULL in case of successful scheduler allocation, NULL otherwise
+ */
+void *allocateTileScheduler(double *output, unsigned int numTimes, unsigned int numWorkers, unsigned int tileSize);
+
+/**
+ * prepareTileJob
+ *
+ * Prepare the tile job of a Worker
+ *
+ * Input:
+ *      void *scheduler
+ *      unsigned int workerIdx
+ *      fpWorker fpWorker
+ *      void *args
+ *      struct rbdBatch *batch
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function prepares the job which repeatedly invokes the provided RBD Worker over the
+ *  time tiles pulled from the scheduler. The returned job shall be provided to rbdTileWorker()
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *      workerIdx: index of Worker
+ *      fpWorker: pointer to the RBD Worker function processing a tile
+ *      args: arguments provided to RBD Worker function
+ *      batch: work batch of RBD Worker, updated with the current tile before each invocation
+ *
+ * Return (void *):
+ *  Tile job of Worker
+ */
+void *prepareTileJob(void *scheduler, unsigned int workerIdx, fpWorker fpWorker, void *args, struct rbdBatch *batch);
+
+/**
+ * freeTileScheduler
+ *
+ * Free the work-stealing scheduler of time tiles
+ *
+ * Input:
+ *      void *scheduler
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the scheduler once all its tile jobs have been completed
+ *
+ * Parameters:
+ *      scheduler: work-stealing scheduler of time tiles
+ *
+ * Return:
+ *  None
+ */
+void freeTileScheduler(void *scheduler);
+
+/**
+ * rbdTileWorker
+ *
+ * Tile Worker function
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function pulls time tiles from the queue of its Worker and invokes the RBD Worker
+ *  over each of them. Once its queue is empty, it steals half of the tiles still queued
+ *  to the most loaded Worker, until no tile is left
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a tile job. It is provided as a
+ *                      void * in order to be compliant with fpWorker type
+ *
+ * Return (void *):
+ *  NULL
+ */
+void *rbdTileWorker(void *arg);
+#endif /* CPU_SMP */
+
+
+#endif /* SCHEDULER_H_ */
@@ -27,9 +27,39 @@
 
 #if defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0
 /**
- * rbdSeriesGenericWorker
+ * rbdSeriesResolveWorkers
  *
- * Generic Series RBD Worker function
+ * Resolve Series RBD Workers
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function selects the Series RBD Workers. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdSeriesResolveWorkers(void)
+{
+    /* Resolve generic Series RBD Worker */
+    seriesWorkers.genericWorker = &rbdSeriesGenericWorkerS1d;
+    /* Resolve identical Series RBD Worker */
+    seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerS1d;
+}
+#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
+
+/**
+ * rbdSeriesGenericWorkerS1d
+ *
+ * Generic Series RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -38,7 +68,7 @@
  *      None
  *
  * Description:
- *  This function implements the generic Series RBD Worker.
+ *  This function implements the generic Series RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of a generic Series RBD system
  *
  * Parameters:
@@ -48,7 +78,7 @@
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdSeriesGenericWorker(void *arg)
+HIDDEN void *rbdSeriesGenericWorkerS1d(void *arg)
 {
     struct rbdSeriesData *data;
     unsigned int time;
@@ -56,23 +86,23 @@ HIDDEN void *rbdSeriesGenericWorker(void *arg)
     /* Retrieve Series RBD data */
     data = (struct rbdSeriesData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* For each time instant to be processed... */
-    while (time < data->numTimes) {
+    while (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepS1d(data, time);
         /* Increment current time instant */
-        time += data->numCores;
+        time += data->batch.numBatches;
     }
 
     return NULL;
 }
 
 /**
- * rbdSeriesIdenticalWorker
+ * rbdSeriesIdenticalWorkerS1d
  *
- * Identical Series RBD Worker function
+ * Identical Series RBD Worker function without SIMD instruction sets
  *
  * Input:
  *      void *arg
@@ -81,7 +111,7 @@ HIDDEN void *rbdSeriesGenericWorker(void *arg)
  *      None
  *
  * Description:
- *  This function implements the identical Series RBD Worker.
+ *  This function implements the identical Series RBD Worker without SIMD instruction sets.
  *  It is responsible to compute the reliabilities over a given batch of an identical Series RBD system
  *
  * Parameters:
@@ -91,7 +121,7 @@ HIDDEN void *rbdSeriesGenericWorker(void *arg)
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
+HIDDEN void *rbdSeriesIdenticalWorkerS1d(void *arg)
 {
     struct rbdSeriesData *data;
     unsigned int time;
@@ -99,19 +129,18 @@ HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
     /* Retrieve Series RBD data */
     data = (struct rbdSeriesData *)arg;
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
+    time = data->batch.tBegin + data->batch.batchIdx;
 
     /* For each time instant to be processed... */
-    while (time < data->numTimes) {
+    while (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepS1d(data, time);
         /* Increment current time instant */
-        time += data->numCores;
+        time += data->batch.numBatches;
     }
 
     return NULL;
 }
-#endif /* defined(ARCH_UNKNOWN) || CPU_ENABLE_SIMD == 0 */
 
 /**
  * rbdSeriesGenericStepS1d
@@ -164,7 +193,8 @@ HIDDEN void rbdSeriesGenericStepS1d(struct rbdSeriesData *data, unsigned int tim
  * Description:
  *  This function implements the identical Series RBD step.
  *  It is responsible to compute the reliability of a Series block with identical components
- *  given their reliability
+ *  given their reliability. The power of the reliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Series RBD data structure
@@ -172,17 +202,25 @@ HIDDEN void rbdSeriesGenericStepS1d(struct rbdSeriesData *data, unsigned int tim
  */
 HIDDEN void rbdSeriesIdenticalStepS1d(struct rbdSeriesData *data, unsigned int time)
 {
-    unsigned char component;
+    unsigned char bit;
     double s1dTmp;
     double s1dRes;
 
     /* Load reliabilities */
     s1dTmp = data->reliabilities[time];
 
-    /* Compute reliability of Series RBD at current time instant */
+    /* Compute reliability of Series RBD at current time instant through exponentiation by squaring */
     s1dRes = s1dTmp;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        s1dRes *= s1dTmp;
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        s1dRes *= s1dRes;
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            s1dRes *= s1dTmp;
+        }
     }
 
     /* Cap the computed reliability and set it into output array */
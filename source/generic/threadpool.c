@@ -0,0 +1,639 @@
+/*
+ *  Component: threadpool.c
+ *  Persistent pool of RBD Worker threads
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "threadpool.h"
+
+#include "../rbd.h"
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+#include <pthread.h>
+
+
+struct poolJob
+{
+    fpWorker fpWorker;                  /* RBD Worker executed by job */
+    void *args;                         /* Arguments provided to RBD Worker */
+    struct poolJob *next;               /* Next job in pool queue */
+    rbdExecutorWait waitFn;             /* Wait callback of application executor, NULL for pool threads */
+    void *ctx;                          /* Context of application executor */
+    void *handle;                       /* Job handle returned by application executor */
+    unsigned int done;                  /* Job completion flag */
+};
+
+struct threadPool
+{
+    pthread_mutex_t mutex;              /* Mutex protecting the thread pool */
+    pthread_cond_t jobCond;             /* Condition signaled when a job is queued */
+    pthread_cond_t doneCond;            /* Condition signaled when a job is completed */
+    struct poolJob *head;               /* First queued job */
+    struct poolJob *tail;               /* Last queued job */
+    rbdExecutorSubmit submitFn;         /* Submit callback of application executor */
+    rbdExecutorWait waitFn;             /* Wait callback of application executor */
+    void *ctx;                          /* Context of application executor */
+    void *threadHandles;                /* Handles of pool threads */
+    unsigned int numThreads;            /* Number of pool threads */
+    unsigned char initialized;          /* Thread pool created */
+    unsigned char shutdown;             /* Thread pool shutdown in progress */
+    unsigned char forkHandlers;         /* Fork handlers registered */
+};
+
+
+static int threadPoolStart(unsigned int numThreads);
+static void *threadPoolWorker(void *arg);
+static void threadPoolForkPrepare(void);
+static void threadPoolForkParent(void);
+static void threadPoolForkChild(void);
+
+
+static struct threadPool pool = {
+    PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    PTHREAD_COND_INITIALIZER,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    0,
+    0,
+    0,
+    0
+};
+#endif /* CPU_SMP */
+
+
+/**
+ * rbdThreadPoolInit
+ *
+ * Create the pool of RBD Worker threads
+ *
+ * Input:
+ *      unsigned int numThreads
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function creates the process-wide pool of parked RBD Worker threads.
+ *  The pool is otherwise lazily created by the first RBD computation requiring SMP.
+ *  If the pool is already running this function has no effect
+ *
+ * Parameters:
+ *      numThreads: number of pool threads. When 0, the number of available cores
+ *                      minus one (the calling thread always computes one batch) is used
+ *
+ * Return (int):
+ *  0 in case of successful creation, < 0 otherwise
+ */
+EXTERN int rbdThreadPoolInit(unsigned int numThreads)
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    int res;
+
+    res = 0;
+
+    (void)pthread_mutex_lock(&pool.mutex);
+    /* Is thread pool neither running nor under shutdown? */
+    if ((pool.initialized == 0) && (pool.shutdown == 0)) {
+        /* Create the thread pool */
+        res = threadPoolStart(numThreads);
+    }
+    (void)pthread_mutex_unlock(&pool.mutex);
+
+    return res;
+#else                                           /* Under single processor-single thread conditional compiling */
+    (void)numThreads;
+
+    return 0;
+#endif /* CPU_SMP */
+}
+
+/**
+ * rbdThreadPoolShutdown
+ *
+ * Destroy the pool of RBD Worker threads
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function terminates all threads of the process-wide pool after the completion
+ *  of the queued jobs. A subsequent RBD computation lazily creates the pool again
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdThreadPoolShutdown(void)
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    void *threadHandles;
+    unsigned int numThreads;
+    unsigned int idx;
+
+    (void)pthread_mutex_lock(&pool.mutex);
+    /* Is thread pool not running or already under shutdown? */
+    if ((pool.initialized == 0) || (pool.shutdown != 0)) {
+        (void)pthread_mutex_unlock(&pool.mutex);
+        return;
+    }
+
+    /* Request termination of pool threads */
+    pool.shutdown = 1;
+    threadHandles = pool.threadHandles;
+    numThreads = pool.numThreads;
+    (void)pthread_cond_broadcast(&pool.jobCond);
+    (void)pthread_mutex_unlock(&pool.mutex);
+
+    /* Wait for pool threads completion */
+    for (idx = 0; idx < numThreads; ++idx) {
+        waitThread(threadHandles, idx);
+    }
+    free(threadHandles);
+
+    /* Reset thread pool */
+    (void)pthread_mutex_lock(&pool.mutex);
+    pool.threadHandles = NULL;
+    pool.numThreads = 0;
+    pool.initialized = 0;
+    pool.shutdown = 0;
+    (void)pthread_mutex_unlock(&pool.mutex);
+#endif /* CPU_SMP */
+}
+
+
+/**
+ * rbdSetExecutor
+ *
+ * Route RBD Worker jobs to an application-provided executor
+ *
+ * Input:
+ *      rbdExecutorSubmit submitFn
+ *      rbdExecutorWait waitFn
+ *      void *ctx
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function replaces the built-in thread pool with an executor owned by the application.
+ *  Each RBD Worker job is handed to submitFn, which shall arrange for fn(arg) to be executed
+ *  (e.g. on a thread of the application pool) and return through handle a token identifying
+ *  the job. The calling thread later provides that token to waitFn, which shall return only
+ *  once fn(arg) has completed. In case submitFn fails, the job is executed by the calling thread.
+ *  The executor is sampled at job submission, computations already in progress are not affected.
+ *  Providing NULL callbacks restores the built-in thread pool
+ *
+ * Parameters:
+ *      submitFn: callback submitting a job to executor, it shall return 0 in case of success, < 0 otherwise
+ *      waitFn: callback waiting for the completion of a submitted job
+ *      ctx: opaque pointer provided to both callbacks
+ *
+ * Return (int):
+ *  0 in case of successful executor setting, < 0 otherwise (only one callback provided)
+ */
+EXTERN int rbdSetExecutor(rbdExecutorSubmit submitFn, rbdExecutorWait waitFn, void *ctx)
+{
+    /* Are callbacks either both provided or both NULL? */
+    if ((submitFn == NULL) != (waitFn == NULL)) {
+        return -1;
+    }
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    (void)pthread_mutex_lock(&pool.mutex);
+    pool.submitFn = submitFn;
+    pool.waitFn = waitFn;
+    pool.ctx = ctx;
+    (void)pthread_mutex_unlock(&pool.mutex);
+#else                                           /* Under single processor-single thread conditional compiling */
+    (void)ctx;
+#endif /* CPU_SMP */
+
+    return 0;
+}
+
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+/**
+ * allocatePoolJobs
+ *
+ * Allocate memory for the requested thread pool jobs
+ *
+ * Input:
+ *      unsigned int numJobs
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function allocates memory for the requested jobs to be dispatched onto the thread pool.
+ *  The returned array shall be released through free() once all jobs have been waited for
+ *
+ * Parameters:
+ *      numJobs: number of jobs to allocate
+ *
+ * Return (void *):
+ *  != NULL in case of successful jobs allocation, NULL otherwise
+ */
+HIDDEN void *allocatePoolJobs(unsigned int numJobs)
+{
+    struct poolJob *poolJobs;
+
+    /* Allocate thread pool jobs */
+    poolJobs = (struct poolJob *)malloc(sizeof(struct poolJob) * numJobs);
+
+    return poolJobs;
+}
+
+/**
+ * submitPoolJob
+ *
+ * Submit RBD Worker job to thread pool
+ *
+ * Input:
+ *      void *poolJobs
+ *      unsigned int jobIdx
+ *      fpWorker fpWorker
+ *      void *args
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function dispatches the requested RBD Worker onto the application executor, if set
+ *  through rbdSetExecutor(), or onto a parked thread of the pool otherwise. The thread pool
+ *  is lazily created on first submission. In case neither the executor accepts the job nor
+ *  a pool thread is available, the RBD Worker is directly executed by the calling thread
+ *
+ * Parameters:
+ *      poolJobs: array of thread pool jobs
+ *      jobIdx: index of requested job
+ *      fpWorker: pointer to the RBD Worker function executed by job
+ *      args: arguments provided to RBD Worker function
+ *
+ * Return (int):
+ *  0 in case of successful job submission, -1 otherwise
+ */
+HIDDEN int submitPoolJob(void *poolJobs, unsigned int jobIdx, fpWorker fpWorker, void *args)
+{
+    struct poolJob *job;
+    rbdExecutorSubmit submitFn;
+
+    /* Prepare job */
+    job = &((struct poolJob *)poolJobs)[jobIdx];
+    job->fpWorker = fpWorker;
+    job->args = args;
+    job->next = NULL;
+    job->waitFn = NULL;
+    job->ctx = NULL;
+    job->handle = NULL;
+    job->done = 0;
+
+    (void)pthread_mutex_lock(&pool.mutex);
+    /* Is an application executor set? */
+    if (pool.submitFn != NULL) {
+        submitFn = pool.submitFn;
+        job->waitFn = pool.waitFn;
+        job->ctx = pool.ctx;
+        (void)pthread_mutex_unlock(&pool.mutex);
+
+        /* Submit job to application executor */
+        if ((*submitFn)(job->ctx, fpWorker, args, &job->handle) < 0) {
+            /* Directly invoke the RBD Worker */
+            (void)(*fpWorker)(args);
+            job->waitFn = NULL;
+            job->done = 1;
+        }
+        return 0;
+    }
+
+    /* Lazily create the thread pool */
+    if ((pool.initialized == 0) && (pool.shutdown == 0)) {
+        (void)threadPoolStart(0);
+    }
+
+    /* Is no pool thread available? */
+    if ((pool.numThreads == 0) || (pool.shutdown != 0)) {
+        (void)pthread_mutex_unlock(&pool.mutex);
+        /* Directly invoke the RBD Worker */
+        (void)(*fpWorker)(args);
+        job->done = 1;
+        return 0;
+    }
+
+    /* Append job to pool queue and wake up a parked thread */
+    if (pool.tail == NULL) {
+        pool.head = job;
+    }
+    else {
+        pool.tail->next = job;
+    }
+    pool.tail = job;
+    (void)pthread_cond_signal(&pool.jobCond);
+    (void)pthread_mutex_unlock(&pool.mutex);
+
+    return 0;
+}
+
+/**
+ * waitPoolJob
+ *
+ * Wait for the RBD Worker job completion
+ *
+ * Input:
+ *      void *poolJobs
+ *      unsigned int jobIdx
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function waits for the completion of the requested RBD Worker job
+ *
+ * Parameters:
+ *      poolJobs: array of thread pool jobs
+ *      jobIdx: index of requested job
+ *
+ * Return:
+ *  None
+ */
+HIDDEN void waitPoolJob(void *poolJobs, unsigned int jobIdx)
+{
+    struct poolJob *job;
+
+    job = &((struct poolJob *)poolJobs)[jobIdx];
+
+    /* Has job been submitted to application executor? */
+    if (job->waitFn != NULL) {
+        /* Wait for job completion through application executor */
+        (*job->waitFn)(job->ctx, job->handle);
+        return;
+    }
+
+    (void)pthread_mutex_lock(&pool.mutex);
+    /* Wait for job completion */
+    while (job->done == 0) {
+        (void)pthread_cond_wait(&pool.doneCond, &pool.mutex);
+    }
+    (void)pthread_mutex_unlock(&pool.mutex);
+}
+
+
+/**
+ * threadPoolStart
+ *
+ * Create the pool threads
+ *
+ * Input:
+ *      unsigned int numThreads
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function creates the requested number of pool threads.
+ *  It shall be invoked with the thread pool mutex held. The thread pool is marked as
+ *  created only in case of success: otherwise the threads already created are joined,
+ *  temporarily releasing the mutex, and the thread pool is reset so that a later
+ *  invocation can retry its creation
+ *
+ * Parameters:
+ *      numThreads: number of pool threads, 0 to use the number of available cores minus one
+ *
+ * Return (int):
+ *  0 in case of successful creation, -1 otherwise
+ */
+static int threadPoolStart(unsigned int numThreads)
+{
+    unsigned int idx;
+    unsigned int jdx;
+
+    /* Register fork handlers, so that a forked child lazily creates its own thread pool */
+    if (pool.forkHandlers == 0) {
+        if (pthread_atfork(&threadPoolForkPrepare, &threadPoolForkParent, &threadPoolForkChild) == 0) {
+            pool.forkHandlers = 1;
+        }
+    }
+
+    /* By default, use one thread for each core not used by the calling thread, regardless of the runtime cap */
+    if (numThreads == 0) {
+        numThreads = getMaxNumberOfCores() - 1;
+    }
+
+    pool.head = NULL;
+    pool.tail = NULL;
+    pool.numThreads = 0;
+
+    /* Is a single core available (is SMP really needed)? */
+    if (numThreads == 0) {
+        pool.initialized = 1;
+        return 0;
+    }
+
+    /* Allocate Thread ID array, return -1 in case of allocation failure */
+    pool.threadHandles = allocateThreadHandles(numThreads);
+    if (pool.threadHandles == NULL) {
+        return -1;
+    }
+
+    /* Create the pool threads */
+    for (idx = 0; idx < numThreads; ++idx) {
+        if (createThread(pool.threadHandles, idx, &threadPoolWorker, NULL) < 0) {
+            break;
+        }
+    }
+
+    /* Have all pool threads been created? */
+    if (idx == numThreads) {
+        pool.numThreads = numThreads;
+        pool.initialized = 1;
+        return 0;
+    }
+
+    /* Terminate the pool threads already created, no job can be queued meanwhile */
+    pool.shutdown = 1;
+    (void)pthread_cond_broadcast(&pool.jobCond);
+    (void)pthread_mutex_unlock(&pool.mutex);
+    for (jdx = 0; jdx < idx; ++jdx) {
+        waitThread(pool.threadHandles, jdx);
+    }
+    (void)pthread_mutex_lock(&pool.mutex);
+
+    /* Reset thread pool */
+    free(pool.threadHandles);
+    pool.threadHandles = NULL;
+    pool.shutdown = 0;
+
+    return -1;
+}
+
+/**
+ * threadPoolWorker
+ *
+ * Thread pool Worker function
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the loop of a pool thread: it parks until a job is queued,
+ *  executes the RBD Worker of the job and signals its completion
+ *
+ * Parameters:
+ *      arg: unused
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *threadPoolWorker(void *arg)
+{
+    struct poolJob *job;
+
+    (void)arg;
+
+    (void)pthread_mutex_lock(&pool.mutex);
+    for (;;) {
+        /* Park until a job is queued or shutdown is requested */
+        while ((pool.head == NULL) && (pool.shutdown == 0)) {
+            (void)pthread_cond_wait(&pool.jobCond, &pool.mutex);
+        }
+        /* Terminate once all queued jobs have been executed */
+        if (pool.head == NULL) {
+            break;
+        }
+
+        /* Dequeue first job */
+        job = pool.head;
+        pool.head = job->next;
+        if (pool.head == NULL) {
+            pool.tail = NULL;
+        }
+        (void)pthread_mutex_unlock(&pool.mutex);
+
+        /* Invoke the RBD Worker */
+        (void)(*job->fpWorker)(job->args);
+
+        /* Signal job completion */
+        (void)pthread_mutex_lock(&pool.mutex);
+        job->done = 1;
+        (void)pthread_cond_broadcast(&pool.doneCond);
+    }
+    (void)pthread_mutex_unlock(&pool.mutex);
+
+    return NULL;
+}
+
+/**
+ * threadPoolForkPrepare
+ *
+ * Fork handler executed before fork()
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function acquires the thread pool mutex, so that the thread pool is in a
+ *  consistent state while the process is forked
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void threadPoolForkPrepare(void)
+{
+    (void)pthread_mutex_lock(&pool.mutex);
+}
+
+/**
+ * threadPoolForkParent
+ *
+ * Fork handler executed by parent after fork()
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the thread pool mutex in the parent process
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void threadPoolForkParent(void)
+{
+    (void)pthread_mutex_unlock(&pool.mutex);
+}
+
+/**
+ * threadPoolForkChild
+ *
+ * Fork handler executed by child after fork()
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function resets the thread pool in the child process. Pool threads are not
+ *  duplicated by fork(), hence the child lazily creates its own thread pool
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static void threadPoolForkChild(void)
+{
+    (void)pthread_mutex_init(&pool.mutex, NULL);
+    (void)pthread_cond_init(&pool.jobCond, NULL);
+    (void)pthread_cond_init(&pool.doneCond, NULL);
+    free(pool.threadHandles);
+    pool.head = NULL;
+    pool.tail = NULL;
+    pool.threadHandles = NULL;
+    pool.numThreads = 0;
+    pool.initialized = 0;
+    pool.shutdown = 0;
+}
+#endif /* CPU_SMP */
@@ -0,0 +1,110 @@
+/*
+ *  Component: threadpool.h
+ *  Persistent pool of RBD Worker threads
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+
+#include "rbd_internal_generic.h"
+
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+/**
+ * allocatePoolJobs
+ *
+ * Allocate memory for the requested thread pool jobs
+ *
+ * Input:
+ *      unsigned int numJobs
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function allocates memory for the requested jobs to be dispatched onto the thread pool.
+ *  The returned array shall be released through free() once all jobs have been waited for
+ *
+ * Parameters:
+ *      numJobs: number of jobs to allocate
+ *
+ * Return (void *):
+ *  != NULL in case of successful jobs allocation, NULL otherwise
+ */
+void *allocatePoolJobs(unsigned int numJobs);
+
+/**
+ * submitPoolJob
+ *
+ * Submit RBD Worker job to thread pool
+ *
+ * Input:
+ *      void *poolJobs
+ *      unsigned int jobIdx
+ *      fpWorker fpWorker
+ *      void *args
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function dispatches the requested RBD Worker onto the application executor, if set
+ *  through rbdSetExecutor(), or onto a parked thread of the pool otherwise. The thread pool
+ *  is lazily created on first submission. In case neither the executor accepts the job nor
+ *  a pool thread is available, the RBD Worker is directly executed by the calling thread
+ *
+ * Parameters:
+ *      poolJobs: array of thread pool jobs
+ *      jobIdx: index of requested job
+ *      fpWorker: pointer to the RBD Worker function executed by job
+ *      args: arguments provided to RBD Worker function
+ *
+ * Return (int):
+ *  0 in case of successful job submission, -1 otherwise
+ */
+int submitPoolJob(void *poolJobs, unsigned int jobIdx, fpWorker fpWorker, void *args);
+
+/**
+ * waitPoolJob
+ *
+ * Wait for the RBD Worker job completion
+ *
+ * Input:
+ *      void *poolJobs
+ *      unsigned int jobIdx
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function waits for the completion of the requested RBD Worker job
+ *
+ * Parameters:
+ *      poolJobs: array of thread pool jobs
+ *      jobIdx: index of requested job
+ *
+ * Return:
+ *  None
+ */
+void waitPoolJob(void *poolJobs, unsigned int jobIdx);
+#endif /* CPU_SMP */
+
+
+#endif /* THREADPOOL_H_ */
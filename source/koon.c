@@ -23,9 +23,24 @@
 #include "generic/rbd_internal_generic.h"
 
 #include "generic/binomial.h"
+#include "generic/combcache.h"
+#include "generic/scheduler.h"
+#include "generic/threadpool.h"
 #include "koon.h"
 
 
+static CONSTRUCTOR void rbdKooNInitialize(void);
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+static int rbdKooNGenericSplit(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents,
+                               unsigned char bComputeUnreliability, unsigned int numTimes, struct combinationsKooN *combs,
+                               unsigned long long numCombinations, unsigned int numTimeSplits, unsigned int numCombSplits);
+#endif /* CPU_SMP */
+
+
+/* Platform-generic and platform-specific Workers, resolved at library load time */
+HIDDEN struct rbdKooNWorkers koonWorkers;
+
+
 /**
  * rbdKooNGeneric
  *
@@ -60,20 +75,22 @@
  */
 EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes)
 {
-    unsigned char ii;
     struct combinationsKooN combs;
     int res;
-    unsigned char bRecursive;
-    unsigned char minFaultyComponents;
+    unsigned char bDynamic;
     unsigned char bComputeUnreliability;
-    unsigned int nSquare;
     unsigned long long numCombinations;
+    struct rbdKooNGenericData koonTemplate;
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
     struct rbdKooNGenericData *koonData;
     struct rbdKooNFillData *fillData;
-    void *threadHandles;
+    void *poolJobs;
+    void *scheduler;
+    void *tileJob;
+    double timeCost;
     unsigned int idx;
     unsigned int numCores;
+    unsigned int numSplits;
 #else                                           /* Under single processor-single thread conditional compiling */
     struct rbdKooNGenericData koonData[1];
     struct rbdKooNFillData fillData[1];
@@ -90,8 +107,8 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
     }
 
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
-    /* Compute the number of used cores given the number of times */
-    numCores = computeNumCores(numTimes);
+    /* Compute the number of used cores given the number of times, in case output array is filled */
+    numCores = computeNumCores(numTimes, computeTimeCost(WORKLOAD_FILL, numComponents, minComponents, 0));
 #endif /* CPU_SMP */
 
     res = 0;
@@ -106,9 +123,9 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
         }
 
         if (numCores > 1) {
-            /* Allocate Thread ID array, return -1 in case of allocation failure */
-            threadHandles = allocateThreadHandles(numCores - 1);
-            if (threadHandles == NULL) {
+            /* Allocate thread pool jobs array, return -1 in case of allocation failure */
+            poolJobs = allocatePoolJobs(numCores - 1);
+            if (poolJobs == NULL) {
                 free(fillData);
                 return -1;
             }
@@ -116,43 +133,40 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
             /* For each available core... */
             for (idx = 0; idx < (numCores - 1); ++idx) {
                 /* Prepare fill Output data structure */
-                fillData[idx].batchIdx = idx;
-                fillData[idx].numCores = numCores;
+                computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
                 fillData[idx].output = output;
                 fillData[idx].numTimes = numTimes;
                 fillData[idx].value = 0.0;
 
-                /* Create the fill output data Worker thread */
-                if (createThread(threadHandles, idx, &rbdKooNFillWorker, &fillData[idx]) < 0) {
+                /* Dispatch the fill output data Worker onto thread pool */
+                if (submitPoolJob(poolJobs, idx, koonWorkers.fillWorker, &fillData[idx]) < 0) {
                     res = -1;
                 }
             }
 
             /* Prepare fill Output data structure */
-            fillData[idx].batchIdx = idx;
-            fillData[idx].numCores = numCores;
+            computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
             fillData[idx].output = output;
             fillData[idx].numTimes = numTimes;
             fillData[idx].value = 0.0;
 
-            (void)rbdKooNFillWorker(&fillData[idx]);
+            (void)(*koonWorkers.fillWorker)(&fillData[idx]);
 
-            /* Wait for created threads completion */
+            /* Wait for dispatched jobs completion */
             for (idx = 0; idx < (numCores - 1); ++idx) {
-                waitThread(threadHandles, idx);
+                waitPoolJob(poolJobs, idx);
             }
-            free(threadHandles);
+            free(poolJobs);
         }
         else {
 #endif /* CPU_SMP */
             /* Prepare fill Output data structure */
-            fillData[0].batchIdx = 0;
-            fillData[0].numCores = 1;
+            computeBatch(&fillData[0].batch, output, numTimes, 1, 0);
             fillData[0].output = output;
             fillData[0].numTimes = numTimes;
             fillData[0].value = 0.0;
 
-            (void)rbdKooNFillWorker(&fillData[0]);
+            (void)(*koonWorkers.fillWorker)(&fillData[0]);
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
         }
 
@@ -172,9 +186,9 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
         }
 
         if (numCores > 1) {
-            /* Allocate Thread ID array, return -1 in case of allocation failure */
-            threadHandles = allocateThreadHandles(numCores - 1);
-            if (threadHandles == NULL) {
+            /* Allocate thread pool jobs array, return -1 in case of allocation failure */
+            poolJobs = allocatePoolJobs(numCores - 1);
+            if (poolJobs == NULL) {
                 free(fillData);
                 return -1;
             }
@@ -182,43 +196,40 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
             /* For each available core... */
             for (idx = 0; idx < (numCores - 1); ++idx) {
                 /* Prepare fill Output data structure */
-                fillData[idx].batchIdx = idx;
-                fillData[idx].numCores = numCores;
+                computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
                 fillData[idx].output = output;
                 fillData[idx].numTimes = numTimes;
                 fillData[idx].value = 1.0;
 
-                /* Create the fill output data Worker thread */
-                if (createThread(threadHandles, idx, &rbdKooNFillWorker, &fillData[idx]) < 0) {
+                /* Dispatch the fill output data Worker onto thread pool */
+                if (submitPoolJob(poolJobs, idx, koonWorkers.fillWorker, &fillData[idx]) < 0) {
                     res = -1;
                 }
             }
 
             /* Prepare fill Output data structure */
-            fillData[idx].batchIdx = idx;
-            fillData[idx].numCores = numCores;
+            computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
             fillData[idx].output = output;
             fillData[idx].numTimes = numTimes;
             fillData[idx].value = 1.0;
 
-            (void)rbdKooNFillWorker(&fillData[idx]);
+            (void)(*koonWorkers.fillWorker)(&fillData[idx]);
 
-            /* Wait for created threads completion */
+            /* Wait for dispatched jobs completion */
             for (idx = 0; idx < (numCores - 1); ++idx) {
-                waitThread(threadHandles, idx);
+                waitPoolJob(poolJobs, idx);
             }
-            free(threadHandles);
+            free(poolJobs);
         }
         else {
 #endif /* CPU_SMP */
             /* Prepare fill Output data structure */
-            fillData[0].batchIdx = 0;
-            fillData[0].numCores = 1;
+            computeBatch(&fillData[0].batch, output, numTimes, 1, 0);
             fillData[0].output = output;
             fillData[0].numTimes = numTimes;
             fillData[0].value = 1.0;
 
-            (void)rbdKooNFillWorker(&fillData[0]);
+            (void)(*koonWorkers.fillWorker)(&fillData[0]);
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
         }
 
@@ -228,119 +239,120 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
         return res;
     }
 
+    /* Prepare combinations of KooN RBD system, resorting to Dynamic Programming if they are not available */
+    numCombinations = rbdKooNGenericPrepare(&koonTemplate, &combs, numComponents, minComponents);
+    minComponents = koonTemplate.minComponents;
+    bComputeUnreliability = koonTemplate.bComputeUnreliability;
+    bDynamic = koonTemplate.bDynamic;
+
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Estimate the cost of each time instant given the selected approach */
+    timeCost = computeTimeCost((bDynamic != 0) ? WORKLOAD_KOON_DYNAMIC : WORKLOAD_KOON_COMBINATIONS,
+                               numComponents, minComponents, numCombinations);
+    /* Compute the number of used cores given the number of times and the estimated cost of each of them */
+    numCores = computeNumCores(numTimes, timeCost);
+
+    /**
+     * Are time instants too few to keep all cores busy? Split combinations too, arranging cores
+     * into a grid of batches of time instants and ranges of combinations. The Dynamic Programming
+     * is only split over time instants, its components being processed sequentially
+     */
+    if (bDynamic == 0) {
+        numSplits = computeNumSplits(numTimes, timeCost, numCombinations) / numCores;
+        if (numSplits > 1) {
+            res = rbdKooNGenericSplit(reliabilities, output, numComponents, minComponents, bComputeUnreliability,
+                                      numTimes, &combs, numCombinations, numCores, numSplits);
+            rbdKooNGenericRelease(&koonTemplate);
+            return res;
+        }
+    }
+
     /* Allocate generic KooN RBD data array, return -1 in case of allocation failure */
     koonData = (struct rbdKooNGenericData *)malloc(sizeof(struct rbdKooNGenericData) * numCores);
     if (koonData == NULL) {
+        rbdKooNGenericRelease(&koonTemplate);
         return -1;
     }
 #endif /* CPU_SMP */
 
-    bComputeUnreliability = 0;
-    bRecursive = 0;
-
-    /* Compute N^2 for further optimizations (recursive formula) */
-    nSquare = numComponents * numComponents;
-
-    /* Initialize total number of combinations to 0 */
-    numCombinations = 0;
-
-    /* Compute minimum number of faulty components for having an unreliable block */
-    minFaultyComponents = numComponents - minComponents + 1;
-    /* Is minimum number of faulty components greater than minimum number of components? */
-    if (minFaultyComponents > minComponents) {
-        /* Assign minimum number of faulty components to minimum number of components */
-        minComponents = minFaultyComponents;
-        /* Set KooN computation through Unreliability flag */
-        bComputeUnreliability = 1;
-    }
-
-    /* Initialize combinations of combinations for KooN computation */
-    combs.numKooNcombinations = (numComponents - minComponents) + 1;
-    ii = 0;
-    do {
-        combs.combinations[ii] = computeCombinations(numComponents, (ii + minComponents));
-        numCombinations += combs.combinations[ii]->numCombinations;
-        bRecursive  = !!(combs.combinations[ii] == NULL);
-        bRecursive |= !!(numCombinations > nSquare);
-        ++ii;
-    }
-    while ((ii < combs.numKooNcombinations) && (bRecursive == 0));
-
-    if (bRecursive != 0) {
-        while (ii > 0) {
-            free(combs.combinations[--ii]);
-        }
-    }
-
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
     /* Is number of used cores greater than 1? */
     if (numCores > 1) {
-        /* Allocate Thread ID array, return -1 in case of allocation failure */
-        threadHandles = allocateThreadHandles(numCores - 1);
-        if (threadHandles == NULL) {
+        /* Allocate thread pool jobs array and work-stealing scheduler of time tiles, return -1 in case of allocation failure */
+        poolJobs = allocatePoolJobs(numCores - 1);
+        scheduler = allocateTileScheduler(output, numTimes, numCores, computeTileSize(numTimes, timeCost, numCores));
+        if ((poolJobs == NULL) || (scheduler == NULL)) {
+            free(poolJobs);
+            if (scheduler != NULL) {
+                freeTileScheduler(scheduler);
+            }
             free(koonData);
+            rbdKooNGenericRelease(&koonTemplate);
             return -1;
         }
 
         /* For each available core... */
         for (idx = 0; idx < (numCores - 1); ++idx) {
             /* Prepare generic KooN RBD koonData structure */
-            koonData[idx].batchIdx = idx;
-            koonData[idx].numCores = numCores;
             koonData[idx].reliabilities = reliabilities;
             koonData[idx].output = output;
             koonData[idx].numComponents = numComponents;
             koonData[idx].minComponents = minComponents;
             koonData[idx].bComputeUnreliability = bComputeUnreliability;
-            koonData[idx].bRecursive = bRecursive;
+            koonData[idx].bDynamic = bDynamic;
             koonData[idx].numTimes = numTimes;
             koonData[idx].combs = &combs;
+            koonData[idx].combBegin = 0;
+            koonData[idx].combEnd = numCombinations;
 
-            /* Create the generic KooN RBD Worker thread */
-            if (createThread(threadHandles, idx, &rbdKooNGenericWorker, &koonData[idx]) < 0) {
+            /* Dispatch the generic KooN RBD Worker onto thread pool, pulling time tiles from scheduler */
+            tileJob = prepareTileJob(scheduler, idx, koonWorkers.genericWorker, &koonData[idx], &koonData[idx].batch);
+            if (submitPoolJob(poolJobs, idx, &rbdTileWorker, tileJob) < 0) {
                 res = -1;
             }
         }
 
         /* Prepare generic KooN RBD koonData structure */
-        koonData[idx].batchIdx = idx;
-        koonData[idx].numCores = numCores;
         koonData[idx].reliabilities = reliabilities;
         koonData[idx].output = output;
         koonData[idx].numComponents = numComponents;
         koonData[idx].minComponents = minComponents;
         koonData[idx].bComputeUnreliability = bComputeUnreliability;
-        koonData[idx].bRecursive = bRecursive;
+        koonData[idx].bDynamic = bDynamic;
         koonData[idx].numTimes = numTimes;
         koonData[idx].combs = &combs;
+        koonData[idx].combBegin = 0;
+        koonData[idx].combEnd = numCombinations;
 
-        /* Directly invoke the KooN RBD Worker */
-        (void)rbdKooNGenericWorker(&koonData[idx]);
+        /* Directly invoke the KooN RBD Worker, pulling time tiles from scheduler */
+        tileJob = prepareTileJob(scheduler, idx, koonWorkers.genericWorker, &koonData[idx], &koonData[idx].batch);
+        (void)rbdTileWorker(tileJob);
 
-        /* Wait for created threads completion */
+        /* Wait for dispatched jobs completion */
         for(idx = 0; idx < (numCores - 1); ++idx) {
-            waitThread(threadHandles, idx);
+            waitPoolJob(poolJobs, idx);
         }
-        /* Free Thread ID array */
-        free(threadHandles);
+        /* Free thread pool jobs array and work-stealing scheduler */
+        free(poolJobs);
+        freeTileScheduler(scheduler);
     }
     else {
 #endif /* CPU_SMP */
         /* Prepare generic KooN RBD koonData structure */
-        koonData[0].batchIdx = 0;
-        koonData[0].numCores = 1;
+        computeBatch(&koonData[0].batch, output, numTimes, 1, 0);
         koonData[0].reliabilities = reliabilities;
         koonData[0].output = output;
         koonData[0].numComponents = numComponents;
         koonData[0].minComponents = minComponents;
         koonData[0].bComputeUnreliability = bComputeUnreliability;
-        koonData[0].bRecursive = bRecursive;
+        koonData[0].bDynamic = bDynamic;
         koonData[0].numTimes = numTimes;
         koonData[0].combs = &combs;
+        koonData[0].combBegin = 0;
+        koonData[0].combEnd = numCombinations;
 
         /* Directly invoke the KooN RBD Worker */
-        (void)rbdKooNGenericWorker(&koonData[0]);
+        (void)(*koonWorkers.genericWorker)(&koonData[0]);
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
     }
 
@@ -348,14 +360,8 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
     free(koonData);
 #endif /* CPU_SMP */
 
-    /* Free combinations if recursive approach has not been used */
-    if (bRecursive == 0) {
-        ii = combs.numKooNcombinations;
-        while (ii > 0) {
-            --ii;
-            free(combs.combinations[ii]);
-        }
-    }
+    /* Release combinations if Dynamic Programming has not been used */
+    rbdKooNGenericRelease(&koonTemplate);
 
     return res;
 }
@@ -392,16 +398,15 @@ EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
  */
 EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes)
 {
-    unsigned short ii;
-    unsigned int idx;
     int res;
-    unsigned long long nCi[UCHAR_MAX];
-    unsigned char minFaultyComponents;
+    double nCi[UCHAR_MAX];
     unsigned char bComputeUnreliability;
+    struct rbdKooNIdenticalData koonTemplate;
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
     struct rbdKooNIdenticalData *koonData;
     struct rbdKooNFillData *fillData;
-    void *threadHandles;
+    void *poolJobs;
+    unsigned int idx;
     unsigned int numCores;
 #else                                           /* Under single processor-single thread conditional compiling */
     struct rbdKooNIdenticalData koonData[1];
@@ -419,8 +424,8 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
     }
 
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
-    /* Compute the number of used cores given the number of times */
-    numCores = computeNumCores(numTimes);
+    /* Compute the number of used cores given the number of times, in case output array is filled */
+    numCores = computeNumCores(numTimes, computeTimeCost(WORKLOAD_FILL, numComponents, minComponents, 0));
 #endif /* CPU_SMP */
 
     res = 0;
@@ -435,9 +440,9 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
         }
 
         if (numCores > 1) {
-            /* Allocate Thread ID array, return -1 in case of allocation failure */
-            threadHandles = allocateThreadHandles(numCores - 1);
-            if (threadHandles == NULL) {
+            /* Allocate thread pool jobs array, return -1 in case of allocation failure */
+            poolJobs = allocatePoolJobs(numCores - 1);
+            if (poolJobs == NULL) {
                 free(fillData);
                 return -1;
             }
@@ -445,43 +450,40 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
             /* For each available core... */
             for (idx = 0; idx < (numCores - 1); ++idx) {
                 /* Prepare fill Output data structure */
-                fillData[idx].batchIdx = idx;
-                fillData[idx].numCores = numCores;
+                computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
                 fillData[idx].output = output;
                 fillData[idx].numTimes = numTimes;
                 fillData[idx].value = 0.0;
 
-                /* Create the fill output data Worker thread */
-                if (createThread(threadHandles, idx, &rbdKooNFillWorker, &fillData[idx]) < 0) {
+                /* Dispatch the fill output data Worker onto thread pool */
+                if (submitPoolJob(poolJobs, idx, koonWorkers.fillWorker, &fillData[idx]) < 0) {
                     res = -1;
                 }
             }
 
             /* Prepare fill Output data structure */
-            fillData[idx].batchIdx = idx;
-            fillData[idx].numCores = numCores;
+            computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
             fillData[idx].output = output;
             fillData[idx].numTimes = numTimes;
             fillData[idx].value = 0.0;
 
-            (void)rbdKooNFillWorker(&fillData[idx]);
+            (void)(*koonWorkers.fillWorker)(&fillData[idx]);
 
-            /* Wait for created threads completion */
+            /* Wait for dispatched jobs completion */
             for (idx = 0; idx < (numCores - 1); ++idx) {
-                waitThread(threadHandles, idx);
+                waitPoolJob(poolJobs, idx);
             }
-            free(threadHandles);
+            free(poolJobs);
         }
         else {
 #endif /* CPU_SMP */
             /* Prepare fill Output data structure */
-            fillData[0].batchIdx = 0;
-            fillData[0].numCores = 1;
+            computeBatch(&fillData[0].batch, output, numTimes, 1, 0);
             fillData[0].output = output;
             fillData[0].numTimes = numTimes;
             fillData[0].value = 0.0;
 
-            (void)rbdKooNFillWorker(&fillData[0]);
+            (void)(*koonWorkers.fillWorker)(&fillData[0]);
 #if CPU_SMP != 0
         }
 
@@ -501,9 +503,9 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
         }
 
         if (numCores > 1) {
-            /* Allocate Thread ID array, return -1 in case of allocation failure */
-            threadHandles = allocateThreadHandles(numCores - 1);
-            if (threadHandles == NULL) {
+            /* Allocate thread pool jobs array, return -1 in case of allocation failure */
+            poolJobs = allocatePoolJobs(numCores - 1);
+            if (poolJobs == NULL) {
                 free(fillData);
                 return -1;
             }
@@ -511,43 +513,40 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
             /* For each available core... */
             for (idx = 0; idx < (numCores - 1); ++idx) {
                 /* Prepare fill Output data structure */
-                fillData[idx].batchIdx = idx;
-                fillData[idx].numCores = numCores;
+                computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
                 fillData[idx].output = output;
                 fillData[idx].numTimes = numTimes;
                 fillData[idx].value = 1.0;
 
-                /* Create the fill output data Worker thread */
-                if (createThread(threadHandles, idx, &rbdKooNFillWorker, &fillData[idx]) < 0) {
+                /* Dispatch the fill output data Worker onto thread pool */
+                if (submitPoolJob(poolJobs, idx, koonWorkers.fillWorker, &fillData[idx]) < 0) {
                     res = -1;
                 }
             }
 
             /* Prepare fill Output data structure */
-            fillData[idx].batchIdx = idx;
-            fillData[idx].numCores = numCores;
+            computeBatch(&fillData[idx].batch, output, numTimes, numCores, idx);
             fillData[idx].output = output;
             fillData[idx].numTimes = numTimes;
             fillData[idx].value = 1.0;
 
-            (void)rbdKooNFillWorker(&fillData[idx]);
+            (void)(*koonWorkers.fillWorker)(&fillData[idx]);
 
-            /* Wait for created threads completion */
+            /* Wait for dispatched jobs completion */
             for (idx = 0; idx < (numCores - 1); ++idx) {
-                waitThread(threadHandles, idx);
+                waitPoolJob(poolJobs, idx);
             }
-            free(threadHandles);
+            free(poolJobs);
         }
         else {
 #endif /* CPU_SMP */
             /* Prepare fill Output data structure */
-            fillData[0].batchIdx = 0;
-            fillData[0].numCores = 1;
+            computeBatch(&fillData[0].batch, output, numTimes, 1, 0);
             fillData[0].output = output;
             fillData[0].numTimes = numTimes;
             fillData[0].value = 1.0;
 
-            (void)rbdKooNFillWorker(&fillData[0]);
+            (void)(*koonWorkers.fillWorker)(&fillData[0]);
 #if CPU_SMP != 0
         }
 
@@ -557,42 +556,27 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
         return res;
     }
 
+    /* Prepare binomial coefficients of identical KooN RBD system */
+    rbdKooNIdenticalPrepare(&koonTemplate, &nCi[0], numComponents, minComponents);
+    minComponents = koonTemplate.minComponents;
+    bComputeUnreliability = koonTemplate.bComputeUnreliability;
+
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
-    /* Allocate generic KooN RBD data array, return -1 in case of allocation failure */
+    /* Compute the number of used cores given the number of times and the estimated cost of each of them */
+    numCores = computeNumCores(numTimes, computeTimeCost(WORKLOAD_KOON_IDENTICAL, numComponents, minComponents, 0));
+
+    /* Allocate identical KooN RBD data array, return -1 in case of allocation failure */
     koonData = (struct rbdKooNIdenticalData *)malloc(sizeof(struct rbdKooNIdenticalData) * numCores);
     if (koonData == NULL) {
         return -1;
     }
 #endif /* CPU_SMP */
 
-    bComputeUnreliability = 0;
-
-    /* Compute minimum number of faulty components for having an unreliable block */
-    minFaultyComponents = numComponents - minComponents + 1;
-    /* Is minimum number of faulty components greater than minimum number of components? */
-    if (minFaultyComponents > minComponents) {
-        /* Assign minimum number of faulty components to minimum number of components */
-        minComponents = minFaultyComponents;
-        /* Set KooN computation through Unreliability flag */
-        bComputeUnreliability = 1;
-    }
-
-    /* Compute all binomial coefficients nCi for i in [k, n] */
-    ii = minComponents;
-    idx = 0;
-    do {
-        nCi[idx] = binomialCoefficient(numComponents, ii++);
-        if (nCi[idx++] == 0) {
-            return -1;
-        }
-    }
-    while (ii <= numComponents);
-
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
     if (numCores > 1) {
-        /* Allocate Thread ID array, return -1 in case of allocation failure */
-        threadHandles = allocateThreadHandles(numCores - 1);
-        if (threadHandles == NULL) {
+        /* Allocate thread pool jobs array, return -1 in case of allocation failure */
+        poolJobs = allocatePoolJobs(numCores - 1);
+        if (poolJobs == NULL) {
             free(koonData);
             return -1;
         }
@@ -600,8 +584,7 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
         /* For each available core... */
         for (idx = 0; idx < (numCores - 1); ++idx) {
             /* Prepare identical KooN RBD data structure */
-            koonData[idx].batchIdx = idx;
-            koonData[idx].numCores = numCores;
+            computeBatch(&koonData[idx].batch, output, numTimes, numCores, idx);
             koonData[idx].reliabilities = reliabilities;
             koonData[idx].output = output;
             koonData[idx].numComponents = numComponents;
@@ -610,15 +593,14 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
             koonData[idx].numTimes = numTimes;
             koonData[idx].nCi = &nCi[0];
 
-            /* Create the identical KooN RBD Worker thread */
-            if (createThread(threadHandles, idx, &rbdKooNIdenticalWorker, &koonData[idx]) < 0) {
+            /* Dispatch the identical KooN RBD Worker onto thread pool */
+            if (submitPoolJob(poolJobs, idx, koonWorkers.identicalWorker, &koonData[idx]) < 0) {
                 res = -1;
             }
         }
 
         /* Prepare identical KooN RBD data structure */
-        koonData[idx].batchIdx = idx;
-        koonData[idx].numCores = numCores;
+        computeBatch(&koonData[idx].batch, output, numTimes, numCores, idx);
         koonData[idx].reliabilities = reliabilities;
         koonData[idx].output = output;
         koonData[idx].numComponents = numComponents;
@@ -628,20 +610,19 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
         koonData[idx].nCi = &nCi[0];
 
         /* Directly invoke the identical KooN RBD Worker */
-        (void)rbdKooNIdenticalWorker(&koonData[idx]);
+        (void)(*koonWorkers.identicalWorker)(&koonData[idx]);
 
-        /* Wait for created threads completion */
+        /* Wait for dispatched jobs completion */
         for (idx = 0; idx < (numCores - 1); ++idx) {
-            waitThread(threadHandles, idx);
+            waitPoolJob(poolJobs, idx);
         }
-        /* Free Thread ID array */
-        free(threadHandles);
+        /* Free thread pool jobs array */
+        free(poolJobs);
     }
     else {
 #endif /* CPU_SMP */
         /* Prepare identical KooN RBD data structure */
-        koonData[0].batchIdx = 0;
-        koonData[0].numCores = 1;
+        computeBatch(&koonData[0].batch, output, numTimes, 1, 0);
         koonData[0].reliabilities = reliabilities;
         koonData[0].output = output;
         koonData[0].numComponents = numComponents;
@@ -651,7 +632,7 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
         koonData[0].nCi = &nCi[0];
 
         /* Directly invoke the identical KooN RBD Worker */
-        (void)rbdKooNIdenticalWorker(&koonData[0]);
+        (void)(*koonWorkers.identicalWorker)(&koonData[0]);
 #if CPU_SMP != 0                                /* Under SMP conditional compiling */
     }
 
@@ -661,3 +642,525 @@ EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
 
     return res;
 }
+
+/**
+ * rbdKooNAllGeneric
+ *
+ * Compute reliability of all generic KooN (K-out-of-N) RBD systems with K in [1, N]
+ *
+ * Input:
+ *      double *reliabilities
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes, in a single pass over the input reliabilities, the reliabilities
+ *  over time of all the generic KooN (K-out-of-N) RBD systems with K in [1, N] sharing the
+ *  same components, i.e. the tail sums of the distribution of the number of working components
+ *
+ * Parameters:
+ *      reliabilities: this matrix contains the input reliabilities of all components
+ *                      at the provided time instants. The matrix shall be provided as
+ *                      a NxT one, where N is the number of components of KooN RBD
+ *                      systems and T is the number of time instants
+ *      output: this matrix contains the reliabilities of KooN RBD systems computed at
+ *                      the provided time instants. The matrix shall be provided as a NxT
+ *                      one, whose row k-1 contains the reliabilities of the KooN RBD system
+ *                      with K=k
+ *      numComponents: number of components in KooN RBD systems (N)
+ *      numTimes: number of time instants over which KooN RBD systems shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdKooNAllGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes)
+{
+    int res;
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    struct rbdKooNGenericData *koonData;
+    void *poolJobs;
+    void *scheduler;
+    void *tileJob;
+    double timeCost;
+    unsigned int idx;
+    unsigned int numCores;
+#else                                           /* Under single processor-single thread conditional compiling */
+    struct rbdKooNGenericData koonData[1];
+#endif /* CPU_SMP */
+
+    res = 0;
+
+    /* If N is 0 there is no KooN RBD system to be computed, return 0 */
+    if (numComponents == 0) {
+        return res;
+    }
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Estimate the cost of each time instant */
+    timeCost = computeTimeCost(WORKLOAD_KOON_ALL, numComponents, 1, 0);
+    /* Compute the number of used cores given the number of times and the estimated cost of each of them */
+    numCores = computeNumCores(numTimes, timeCost);
+
+    /* Allocate generic KooN RBD data array, return -1 in case of allocation failure */
+    koonData = (struct rbdKooNGenericData *)malloc(sizeof(struct rbdKooNGenericData) * numCores);
+    if (koonData == NULL) {
+        return -1;
+    }
+
+    /* Is number of used cores greater than 1? */
+    if (numCores > 1) {
+        /* Allocate thread pool jobs array and work-stealing scheduler of time tiles, return -1 in case of allocation failure */
+        poolJobs = allocatePoolJobs(numCores - 1);
+        scheduler = allocateTileScheduler(output, numTimes, numCores, computeTileSize(numTimes, timeCost, numCores));
+        if ((poolJobs == NULL) || (scheduler == NULL)) {
+            free(poolJobs);
+            if (scheduler != NULL) {
+                freeTileScheduler(scheduler);
+            }
+            free(koonData);
+            return -1;
+        }
+
+        /* For each available core... */
+        for (idx = 0; idx < (numCores - 1); ++idx) {
+            /* Prepare generic KooN RBD koonData structure */
+            koonData[idx].reliabilities = reliabilities;
+            koonData[idx].output = output;
+            koonData[idx].numComponents = numComponents;
+            koonData[idx].minComponents = 1;
+            koonData[idx].bComputeUnreliability = 0;
+            koonData[idx].bDynamic = 1;
+            koonData[idx].numTimes = numTimes;
+            koonData[idx].combs = NULL;
+
+            /* Dispatch the all KooN RBDs Worker onto thread pool, pulling time tiles from scheduler */
+            tileJob = prepareTileJob(scheduler, idx, koonWorkers.allWorker, &koonData[idx], &koonData[idx].batch);
+            if (submitPoolJob(poolJobs, idx, &rbdTileWorker, tileJob) < 0) {
+                res = -1;
+            }
+        }
+
+        /* Prepare generic KooN RBD koonData structure */
+        koonData[idx].reliabilities = reliabilities;
+        koonData[idx].output = output;
+        koonData[idx].numComponents = numComponents;
+        koonData[idx].minComponents = 1;
+        koonData[idx].bComputeUnreliability = 0;
+        koonData[idx].bDynamic = 1;
+        koonData[idx].numTimes = numTimes;
+        koonData[idx].combs = NULL;
+
+        /* Directly invoke the all KooN RBDs Worker, pulling time tiles from scheduler */
+        tileJob = prepareTileJob(scheduler, idx, koonWorkers.allWorker, &koonData[idx], &koonData[idx].batch);
+        (void)rbdTileWorker(tileJob);
+
+        /* Wait for dispatched jobs completion */
+        for(idx = 0; idx < (numCores - 1); ++idx) {
+            waitPoolJob(poolJobs, idx);
+        }
+        /* Free thread pool jobs array and work-stealing scheduler */
+        free(poolJobs);
+        freeTileScheduler(scheduler);
+    }
+    else {
+#endif /* CPU_SMP */
+        /* Prepare generic KooN RBD koonData structure */
+        computeBatch(&koonData[0].batch, output, numTimes, 1, 0);
+        koonData[0].reliabilities = reliabilities;
+        koonData[0].output = output;
+        koonData[0].numComponents = numComponents;
+        koonData[0].minComponents = 1;
+        koonData[0].bComputeUnreliability = 0;
+        koonData[0].bDynamic = 1;
+        koonData[0].numTimes = numTimes;
+        koonData[0].combs = NULL;
+
+        /* Directly invoke the all KooN RBDs Worker */
+        (void)(*koonWorkers.allWorker)(&koonData[0]);
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    }
+
+    /* Free generic KooN RBD koonData array */
+    free(koonData);
+#endif /* CPU_SMP */
+
+    return res;
+}
+
+/**
+ * rbdKooNGenericPrepare
+ *
+ * Prepare the computation of a generic KooN (K-out-of-N) RBD system
+ *
+ * Input:
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *
+ * Output:
+ *      struct rbdKooNGenericData *data
+ *      struct combinationsKooN *combs
+ *
+ * Description:
+ *  This function selects how the generic KooN RBD system shall be computed, i.e. through
+ *  its working components, through its failed ones or through Dynamic Programming, and
+ *  acquires the needed combinations from the process-wide cache. The KooN RBD data structure
+ *  is filled with all the parameters not depending on the time instants processed by Worker,
+ *  its combinations shall be released through rbdKooNGenericRelease().
+ *  This function requires K to be in [2, N-1]
+ *
+ * Parameters:
+ *      data: KooN RBD data structure to be prepared
+ *      combs: combinations of combinations of KooN components, referenced by data
+ *      numComponents: number of components in KooN RBD system (N)
+ *      minComponents: minimum number of components required by KooN RBD system (K)
+ *
+ * Return (unsigned long long):
+ *  Total number of combinations analyzed by KooN RBD system
+ */
+HIDDEN unsigned long long rbdKooNGenericPrepare(struct rbdKooNGenericData *data, struct combinationsKooN *combs, unsigned char numComponents, unsigned char minComponents)
+{
+    unsigned char ii;
+    unsigned char bDynamic;
+    unsigned char minFaultyComponents;
+    unsigned char bComputeUnreliability;
+    unsigned int nSquare;
+    unsigned long long numCombinations;
+    unsigned long long nCi;
+
+    bComputeUnreliability = 0;
+    bDynamic = 0;
+
+    /* Compute N^2 for further optimizations (Dynamic Programming) */
+    nSquare = numComponents * numComponents;
+
+    /* Initialize total number of combinations to 0 */
+    numCombinations = 0;
+
+    /* Compute minimum number of faulty components for having an unreliable block */
+    minFaultyComponents = numComponents - minComponents + 1;
+    /* Is minimum number of faulty components greater than minimum number of components? */
+    if (minFaultyComponents > minComponents) {
+        /* Assign minimum number of faulty components to minimum number of components */
+        minComponents = minFaultyComponents;
+        /* Set KooN computation through Unreliability flag */
+        bComputeUnreliability = 1;
+    }
+
+    /* Initialize combinations of combinations for KooN computation */
+    combs->numKooNcombinations = (numComponents - minComponents) + 1;
+    ii = 0;
+    do {
+        /* Compute number of combinations of current iteration */
+        nCi = binomialCoefficient(numComponents, (ii + minComponents));
+        numCombinations += nCi;
+        /* Resort to Dynamic Programming when combinations cannot be computed or are too many */
+        if ((nCi == 0) || (numCombinations > nSquare)) {
+            bDynamic = 1;
+        }
+        else {
+            combs->combinations[ii] = acquireCombinations(numComponents, (ii + minComponents));
+            if (combs->combinations[ii] == NULL) {
+                bDynamic = 1;
+            }
+            else {
+                ++ii;
+            }
+        }
+    }
+    while ((ii < combs->numKooNcombinations) && (bDynamic == 0));
+
+    if (bDynamic != 0) {
+        while (ii > 0) {
+            releaseCombinations(combs->combinations[--ii]);
+        }
+        /* Dynamic Programming directly computes the Reliability from the original K */
+        minComponents = numComponents - minFaultyComponents + 1;
+        bComputeUnreliability = 0;
+    }
+
+    /* Fill KooN RBD data structure */
+    data->numComponents = numComponents;
+    data->minComponents = minComponents;
+    data->bDynamic = bDynamic;
+    data->bComputeUnreliability = bComputeUnreliability;
+    data->combs = combs;
+    data->combBegin = 0;
+    data->combEnd = numCombinations;
+
+    return numCombinations;
+}
+
+/**
+ * rbdKooNGenericRelease
+ *
+ * Release the combinations of a generic KooN (K-out-of-N) RBD system
+ *
+ * Input:
+ *      struct rbdKooNGenericData *data
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the combinations acquired through rbdKooNGenericPrepare(),
+ *  if Dynamic Programming has not been selected
+ *
+ * Parameters:
+ *      data: KooN RBD data structure prepared through rbdKooNGenericPrepare()
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdKooNGenericRelease(struct rbdKooNGenericData *data)
+{
+    unsigned char ii;
+
+    /* Release combinations if Dynamic Programming has not been used */
+    if (data->bDynamic == 0) {
+        for (ii = 0; ii < data->combs->numKooNcombinations; ++ii) {
+            releaseCombinations(data->combs->combinations[ii]);
+        }
+    }
+}
+
+/**
+ * rbdKooNIdenticalPrepare
+ *
+ * Prepare the computation of an identical KooN (K-out-of-N) RBD system
+ *
+ * Input:
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *
+ * Output:
+ *      struct rbdKooNIdenticalData *data
+ *      double *nCi
+ *
+ * Description:
+ *  This function selects whether the identical KooN RBD system shall be computed through its
+ *  working components or through its failed ones and retrieves the needed binomial coefficients.
+ *  The KooN RBD data structure is filled with all the parameters not depending on the time
+ *  instants processed by Worker.
+ *  This function requires K to be in [2, N-1]
+ *
+ * Parameters:
+ *      data: KooN RBD data structure to be prepared
+ *      nCi: array of UCHAR_MAX binomial coefficients, referenced by data
+ *      numComponents: number of components in KooN RBD system (N)
+ *      minComponents: minimum number of components required by KooN RBD system (K)
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void rbdKooNIdenticalPrepare(struct rbdKooNIdenticalData *data, double *nCi, unsigned char numComponents, unsigned char minComponents)
+{
+    unsigned short ii;
+    unsigned int idx;
+    unsigned char minFaultyComponents;
+    unsigned char bComputeUnreliability;
+
+    bComputeUnreliability = 0;
+
+    /* Compute minimum number of faulty components for having an unreliable block */
+    minFaultyComponents = numComponents - minComponents + 1;
+    /* Is minimum number of faulty components greater than minimum number of components? */
+    if (minFaultyComponents > minComponents) {
+        /* Assign minimum number of faulty components to minimum number of components */
+        minComponents = minFaultyComponents;
+        /* Set KooN computation through Unreliability flag */
+        bComputeUnreliability = 1;
+    }
+
+    /* Retrieve all binomial coefficients nCi for i in [k, n] from precomputed table */
+    ii = minComponents;
+    idx = 0;
+    do {
+        nCi[idx++] = binomialCoefficientS1d(numComponents, ii++);
+    }
+    while (ii <= numComponents);
+
+    /* Fill KooN RBD data structure */
+    data->numComponents = numComponents;
+    data->minComponents = minComponents;
+    data->bComputeUnreliability = bComputeUnreliability;
+    data->nCi = nCi;
+}
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+/**
+ * rbdKooNGenericSplit
+ *
+ * Compute reliability of a generic KooN (K-out-of-N) RBD system splitting its time instants and combinations among cores
+ *
+ * Input:
+ *      double *reliabilities
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *      unsigned char bComputeUnreliability
+ *      unsigned int numTimes
+ *      struct combinationsKooN *combs
+ *      unsigned long long numCombinations
+ *      unsigned int numTimeSplits
+ *      unsigned int numCombSplits
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic KooN RBD system when its
+ *  time instants are too few to keep all cores busy. Cores are arranged into a two-dimensional
+ *  grid: time instants are split into numTimeSplits batches and combinations into numCombSplits
+ *  contiguous ranges of ranks, each Worker unranking its first combination and computing its
+ *  batch of time instants into the private array of its range of combinations.
+ *  Since combinations are disjoint events, each partial result is within [0, 1]: the partial
+ *  results of all ranges are then reduced into output array, removing the additional
+ *  contributions of 1 in case of computation through Unreliability
+ *
+ * Parameters:
+ *      reliabilities: matrix of reliabilities of KooN RBD system
+ *      output: array of computed reliabilities
+ *      numComponents: number of components of KooN RBD system (N)
+ *      minComponents: minimum number of components of combinations (K or N-K+1)
+ *      bComputeUnreliability: flag for KooN resolution through usage of Unreliability
+ *      numTimes: number of time instants (T)
+ *      combs: combinations of combinations of KooN components
+ *      numCombinations: total number of combinations
+ *      numTimeSplits: number of batches of time instants, see computeNumCores()
+ *      numCombSplits: number of ranges of combinations
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+static int rbdKooNGenericSplit(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents,
+                               unsigned char bComputeUnreliability, unsigned int numTimes, struct combinationsKooN *combs,
+                               unsigned long long numCombinations, unsigned int numTimeSplits, unsigned int numCombSplits)
+{
+    struct rbdKooNGenericData *koonData;
+    double *partials;
+    void *poolJobs;
+    unsigned long long offset;
+    unsigned int numWorkers;
+    unsigned int combIdx;
+    unsigned int timeIdx;
+    unsigned int idx;
+    unsigned int time;
+    unsigned char ii;
+    double s1dRes;
+    int res;
+
+    numWorkers = numTimeSplits * numCombSplits;
+
+    /* Allocate generic KooN RBD data array, partial results and thread pool jobs array, return -1 in case of allocation failure */
+    koonData = (struct rbdKooNGenericData *)malloc(sizeof(struct rbdKooNGenericData) * numWorkers);
+    partials = (double *)malloc(sizeof(double) * numCombSplits * numTimes);
+    poolJobs = allocatePoolJobs(numWorkers - 1);
+    if ((koonData == NULL) || (partials == NULL) || (poolJobs == NULL)) {
+        free(koonData);
+        free(partials);
+        free(poolJobs);
+        return -1;
+    }
+
+    res = 0;
+    ii = 0;
+    offset = 0;
+    idx = 0;
+
+    /* For each range of combinations... */
+    for (combIdx = 0; combIdx < numCombSplits; ++combIdx) {
+        /* For each batch of time instants... */
+        for (timeIdx = 0; timeIdx < numTimeSplits; ++timeIdx) {
+            /* Prepare generic KooN RBD koonData structure, computing batch into private array of range */
+            koonData[idx].reliabilities = reliabilities;
+            koonData[idx].output = &partials[combIdx * numTimes];
+            koonData[idx].numComponents = numComponents;
+            koonData[idx].minComponents = minComponents;
+            koonData[idx].bComputeUnreliability = bComputeUnreliability;
+            koonData[idx].bDynamic = 0;
+            koonData[idx].numTimes = numTimes;
+            koonData[idx].combs = combs;
+            computeBatch(&koonData[idx].batch, koonData[idx].output, numTimes, numTimeSplits, timeIdx);
+            /* Assign a contiguous range of combinations to Worker */
+            koonData[idx].combBegin = (numCombinations * combIdx) / numCombSplits;
+            koonData[idx].combEnd = (numCombinations * (combIdx + 1)) / numCombSplits;
+
+            /* Retrieve set of combinations containing first combination of Worker and unrank it */
+            while (koonData[idx].combBegin >= (offset + combs->combinations[ii]->numCombinations)) {
+                offset += combs->combinations[ii++]->numCombinations;
+            }
+            (void)combinationFromRank(numComponents, combs->combinations[ii]->k, koonData[idx].combBegin - offset, koonData[idx].combination);
+
+            /* Dispatch the generic KooN RBD Worker onto thread pool, last one is computed by calling thread */
+            if ((idx + 1) < numWorkers) {
+                if (submitPoolJob(poolJobs, idx, koonWorkers.genericWorker, &koonData[idx]) < 0) {
+                    res = -1;
+                }
+            }
+            ++idx;
+        }
+    }
+
+    /* Directly invoke the KooN RBD Worker */
+    (void)(*koonWorkers.genericWorker)(&koonData[numWorkers - 1]);
+
+    /* Wait for dispatched jobs completion */
+    for (idx = 0; idx < (numWorkers - 1); ++idx) {
+        waitPoolJob(poolJobs, idx);
+    }
+
+    /* For each time instant... */
+    for (time = 0; time < numTimes; ++time) {
+        /* Reduce partial results of all ranges of combinations */
+        s1dRes = 0.0;
+        for (combIdx = 0; combIdx < numCombSplits; ++combIdx) {
+            s1dRes += partials[(combIdx * numTimes) + time];
+        }
+        /* Each partial result through Unreliability is computed starting from 1 */
+        if (bComputeUnreliability != 0) {
+            s1dRes -= (double)(numCombSplits - 1);
+        }
+        /* Cap the computed reliability and set it into output array */
+        output[time] = capReliabilityS1d(s1dRes);
+    }
+
+    /* Free thread pool jobs array, partial results and generic KooN RBD koonData array */
+    free(poolJobs);
+    free(partials);
+    free(koonData);
+
+    return res;
+}
+#endif /* CPU_SMP */
+
+/**
+ * rbdKooNInitialize
+ *
+ * Initialize KooN RBD module
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function is executed once at library load time. It retrieves CPU-specific information
+ *  and resolves the KooN RBD Workers exploiting the widest instruction set supported by the processor.
+ *  Since it runs before any user thread, no synchronization is required
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+static CONSTRUCTOR void rbdKooNInitialize(void)
+{
+    /* Get CPU-specific information */
+    getCpuInfo();
+    /* Resolve KooN RBD Workers */
+    rbdKooNResolveWorkers();
+}
@@ -24,6 +24,7 @@
 
 
 #include "rbd.h"
+#include "generic/rbd_internal_generic.h"
 #include "generic/combinations.h"
 
 #include <limits.h>
@@ -37,8 +38,7 @@ struct combinationsKooN
 
 struct rbdKooNFillData
 {
-    unsigned char batchIdx;                         /* Index of work batch */
-    unsigned int numCores;                          /* Number of threads in SMP system */
+    struct rbdBatch batch;                          /* Work batch (range of time instants) processed by Worker */
     double *output;                                 /* Array of output Reliability filled with fixed value */
     unsigned int numTimes;                          /* Number of time instants to compute T */
     double value;                                   /* Fixed value used to fill output Reliability array */
@@ -46,40 +46,82 @@ struct rbdKooNFillData
 
 struct rbdKooNGenericData
 {
-    unsigned char batchIdx;                         /* Index of work batch */
-    unsigned int numCores;                          /* Number of threads in SMP system */
+    struct rbdBatch batch;                          /* Work batch (range of time instants) processed by Worker */
     double *reliabilities;                          /* Matrix of reliabilities of KooN RBD system */
     double *output;                                 /* Array of computed reliabilities */
     unsigned char numComponents;                    /* Number of components of KooN RBD system N */
     unsigned char minComponents;                    /* Minimum number of components in the KooN system (K) */
-    unsigned char bRecursive;                       /* Flag for KooN resolution through usage of recursion */
+    unsigned char bDynamic;                         /* Flag for KooN resolution through usage of Dynamic Programming */
     unsigned char bComputeUnreliability;            /* Flag for KooN resolution through usage of Unreliability */
     unsigned int numTimes;                          /* Number of time instants to compute T */
     struct combinationsKooN *combs;                 /* Possible combinations of combinations of KooN components */
+    unsigned long long combBegin;                   /* Rank of first combination processed by Worker, over all sets of combinations */
+    unsigned long long combEnd;                     /* Rank following last combination processed by Worker, over all sets of combinations */
+    unsigned char combination[UCHAR_MAX];           /* First combination processed by Worker, unranked within its set */
 };
 
 struct rbdKooNIdenticalData
 {
-    unsigned char batchIdx;                         /* Index of work batch */
-    unsigned int numCores;                          /* Number of threads in SMP system */
+    struct rbdBatch batch;                          /* Work batch (range of time instants) processed by Worker */
     double *reliabilities;                          /* Array of reliabilities of KooN RBD system */
     double *output;                                 /* Array of computed reliabilities */
     unsigned char numComponents;                    /* Number of components of KooN RBD system N */
     unsigned char minComponents;                    /* Minimum number of components in the KooN system (K) */
     unsigned char bComputeUnreliability;            /* Flag for KooN resolution through usage of Unreliability */
     unsigned int numTimes;                          /* Number of time instants to compute T */
-    unsigned long long *nCi;                        /* Array of nCi values computed for n=N and i in [K, N] */
+    double *nCi;                                    /* Array of nCi values computed for n=N and i in [K, N] */
 };
 
+/**
+ * Generic KooN RBD data prepared once and computed over many tiles of time instants
+ */
+struct rbdKooNGenericPrepared
+{
+    struct rbdKooNGenericData data;                 /* KooN RBD data, template of each tile computation */
+    struct combinationsKooN combs;                  /* Combinations of combinations of KooN components referenced by data */
+};
+
+/**
+ * Identical KooN RBD data prepared once and computed over many tiles of time instants
+ */
+struct rbdKooNIdenticalPrepared
+{
+    struct rbdKooNIdenticalData data;               /* KooN RBD data, template of each tile computation */
+    double nCi[UCHAR_MAX];                          /* Array of nCi values referenced by data */
+};
+
+/**
+ * KooN RBD Workers, resolved once at library load time
+ */
+struct rbdKooNWorkers
+{
+    fpWorker fillWorker;                            /* Fill output Reliability with fixed value Worker */
+    fpWorker genericWorker;                         /* Generic KooN RBD Worker */
+    fpWorker identicalWorker;                       /* Identical KooN RBD Worker */
+    fpWorker allWorker;                             /* All KooN RBDs (K in [1, N]) Worker */
+};
+
+
+/* Platform-generic and platform-specific Workers */
+extern struct rbdKooNWorkers koonWorkers;
+
 /* Platform-generic and platform-specific functions */
-void *rbdKooNFillWorker(void *arg);
-void *rbdKooNGenericWorker(void *arg);
-void *rbdKooNIdenticalWorker(void *arg);
+void rbdKooNResolveWorkers(void);
+
+/* Platform-generic functions shared with other RBD blocks */
+unsigned long long rbdKooNGenericPrepare(struct rbdKooNGenericData *data, struct combinationsKooN *combs, unsigned char numComponents, unsigned char minComponents);
+void rbdKooNGenericRelease(struct rbdKooNGenericData *data);
+void rbdKooNIdenticalPrepare(struct rbdKooNIdenticalData *data, double *nCi, unsigned char numComponents, unsigned char minComponents);
 
 /* Platform-generic functions */
+void *rbdKooNFillWorkerS1d(void *arg);
+void *rbdKooNGenericWorkerS1d(void *arg);
+void *rbdKooNIdenticalWorkerS1d(void *arg);
+void *rbdKooNAllWorkerS1d(void *arg);
 void rbdKooNGenericSuccessStepS1d(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNGenericFailStepS1d(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNRecursionS1d(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNDynamicStepS1d(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNAllStepS1d(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNIdenticalSuccessStepS1d(struct rbdKooNIdenticalData *data, unsigned int time);
 void rbdKooNIdenticalFailStepS1d(struct rbdKooNIdenticalData *data, unsigned int time);
 
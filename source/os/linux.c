@@ -23,11 +23,29 @@
 
 #if defined(OS_LINUX)
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif /* _GNU_SOURCE */
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
 #include <unistd.h>
 
 #include "../compiler/compiler.h"
 
 
+#define CGROUP_ROOT             "/sys/fs/cgroup"    /* Mount point of cgroup filesystem */
+#define CGROUP_PATH_SIZE        (4096)              /* Maximum size of a cgroup path */
+
+
+static long retrieveAffinityCores(void);
+static long retrieveCgroupCores(void);
+static long readCgroupV2Quota(const char *path);
+static long readCgroupV1Quota(const char *path);
+
+
 /**
  * retrieveNumberOfCores
  *
@@ -40,7 +58,9 @@
  *      None
  *
  * Description:
- *  This function retrieves the number of cores on Linux
+ *  This function retrieves the number of cores on Linux. The number of online cores
+ *  is limited to the cores in the CPU affinity mask of the process and to the CPU
+ *  bandwidth quota (rounded up) of its cgroup, both cgroup v1 and v2 are supported
  *
  * Parameters:
  *      None
@@ -51,11 +71,299 @@
 HIDDEN long retrieveNumberOfCores()
 {
     long int count;
+    long int limit;
 
     /* Retrieve number of cores using the proper Linux API */
     count = sysconf(_SC_NPROCESSORS_ONLN);
 
+    /* Limit number of cores to the ones the process is allowed to run on */
+    limit = retrieveAffinityCores();
+    if ((limit > 0) && ((count < 1) || (limit < count))) {
+        count = limit;
+    }
+
+    /* Limit number of cores to CPU bandwidth quota of cgroup */
+    limit = retrieveCgroupCores();
+    if ((limit > 0) && ((count < 1) || (limit < count))) {
+        count = limit;
+    }
+
     return (long)count;
 }
 
+
+/**
+ * retrieveAffinityCores
+ *
+ * Retrieve number of cores in CPU affinity mask
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the number of cores in the CPU affinity mask of the process
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (long):
+ *  Number of cores in CPU affinity mask, < 1 in case of error
+ */
+static long retrieveAffinityCores(void)
+{
+    cpu_set_t cpuSet;
+
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) != 0) {
+        return -1;
+    }
+
+    return (long)CPU_COUNT(&cpuSet);
+}
+
+/**
+ * retrieveCgroupCores
+ *
+ * Retrieve number of cores granted by cgroup CPU bandwidth quota
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the CPU bandwidth quota of the cgroup of the process, looking
+ *  first at the cgroup v2 unified hierarchy and then at the cgroup v1 cpu controller.
+ *  The cgroup path is taken from /proc/self/cgroup; the root of the hierarchy is used as
+ *  fallback, being it the cgroup of the process inside a container with cgroup namespace
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (long):
+ *  Number of cores granted by quota (rounded up), < 1 if no quota is set
+ */
+static long retrieveCgroupCores(void)
+{
+    FILE *file;
+    char line[CGROUP_PATH_SIZE];
+    char path[CGROUP_PATH_SIZE];
+    char *group;
+    long count;
+
+    count = -1;
+
+    file = fopen("/proc/self/cgroup", "r");
+    if (file != NULL) {
+        /* Each line has format hierarchy-ID:controller-list:cgroup-path */
+        while ((count < 1) && (fgets(line, sizeof(line), file) != NULL)) {
+            line[strcspn(line, "\n")] = '\0';
+            group = strchr(line, ':');
+            if (group == NULL) {
+                continue;
+            }
+            /* cgroup v2 unified hierarchy (empty controller list)? */
+            if (strncmp(group, "::", 2) == 0) {
+                (void)snprintf(path, sizeof(path), "%s%s", CGROUP_ROOT, group + 2);
+                count = readCgroupV2Quota(path);
+            }
+            /* cgroup v1 hierarchy with cpu controller? */
+            else if ((strstr(group, ":cpu,") != NULL) || (strstr(group, ",cpu:") != NULL) ||
+                     (strstr(group, ",cpu,") != NULL) || (strstr(group, ":cpu:") != NULL)) {
+                group = strchr(group + 1, ':');
+                (void)snprintf(path, sizeof(path), "%s/cpu%s", CGROUP_ROOT, group + 1);
+                count = readCgroupV1Quota(path);
+            }
+        }
+        (void)fclose(file);
+    }
+
+    /* Fall back to root of cgroup hierarchies */
+    if (count < 1) {
+        count = readCgroupV2Quota(CGROUP_ROOT);
+    }
+    if (count < 1) {
+        count = readCgroupV1Quota(CGROUP_ROOT "/cpu");
+    }
+
+    return count;
+}
+
+/**
+ * readCgroupV2Quota
+ *
+ * Read CPU bandwidth quota of a cgroup v2
+ *
+ * Input:
+ *      const char *path
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function reads the cpu.max file of the requested cgroup v2
+ *
+ * Parameters:
+ *      path: path of cgroup
+ *
+ * Return (long):
+ *  Number of cores granted by quota (rounded up), < 1 if no quota is set
+ */
+static long readCgroupV2Quota(const char *path)
+{
+    FILE *file;
+    char name[CGROUP_PATH_SIZE + 16];
+    long quota;
+    long period;
+    long count;
+
+    count = -1;
+
+    (void)snprintf(name, sizeof(name), "%s/cpu.max", path);
+    file = fopen(name, "r");
+    if (file != NULL) {
+        /* File has format "$MAX $PERIOD", $MAX being "max" when no quota is set */
+        if ((fscanf(file, "%ld %ld", &quota, &period) == 2) && (quota > 0) && (period > 0)) {
+            count = (quota + period - 1) / period;
+        }
+        (void)fclose(file);
+    }
+
+    return count;
+}
+
+/**
+ * readCgroupV1Quota
+ *
+ * Read CPU bandwidth quota of a cgroup v1
+ *
+ * Input:
+ *      const char *path
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function reads the cpu.cfs_quota_us and cpu.cfs_period_us files of the requested cgroup v1
+ *
+ * Parameters:
+ *      path: path of cgroup within cpu controller hierarchy
+ *
+ * Return (long):
+ *  Number of cores granted by quota (rounded up), < 1 if no quota is set
+ */
+static long readCgroupV1Quota(const char *path)
+{
+    FILE *file;
+    char name[CGROUP_PATH_SIZE + 32];
+    long quota;
+    long period;
+
+    quota = -1;
+    period = -1;
+
+    (void)snprintf(name, sizeof(name), "%s/cpu.cfs_quota_us", path);
+    file = fopen(name, "r");
+    if (file != NULL) {
+        if (fscanf(file, "%ld", &quota) != 1) {
+            quota = -1;
+        }
+        (void)fclose(file);
+    }
+
+    (void)snprintf(name, sizeof(name), "%s/cpu.cfs_period_us", path);
+    file = fopen(name, "r");
+    if (file != NULL) {
+        if (fscanf(file, "%ld", &period) != 1) {
+            period = -1;
+        }
+        (void)fclose(file);
+    }
+
+    /* Is no quota set (quota is -1)? */
+    if ((quota <= 0) || (period <= 0)) {
+        return -1;
+    }
+
+    return (quota + period - 1) / period;
+}
+
+/**
+ * allocateAlignedMemory
+ *
+ * Allocate aligned memory
+ *
+ * Input:
+ *      size_t size
+ *      size_t alignment
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function allocates memory aligned to the requested boundary on Linux.
+ *  Allocations of at least one huge page are aligned to huge pages and advised to be backed
+ *  by transparent huge pages, in order to reduce TLB misses when scanning large matrices.
+ *  The returned memory shall be released through freeAlignedMemory()
+ *
+ * Parameters:
+ *      size: size (in bytes) of memory to allocate
+ *      alignment: requested alignment (in bytes), it shall be a power of 2 multiple of sizeof(void *)
+ *
+ * Return (void *):
+ *  != NULL in case of successful allocation, NULL otherwise
+ */
+HIDDEN void *allocateAlignedMemory(size_t size, size_t alignment)
+{
+    void *ptr;
+
+    /* Align large allocations to huge pages */
+    if ((size >= HUGE_PAGE_SIZE) && (alignment < HUGE_PAGE_SIZE)) {
+        alignment = HUGE_PAGE_SIZE;
+    }
+
+    /* Allocate aligned memory */
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+        return NULL;
+    }
+
+#if defined(MADV_HUGEPAGE)
+    /* Advise kernel to back large allocations with transparent huge pages, failures are harmless */
+    if (size >= HUGE_PAGE_SIZE) {
+        (void)madvise(ptr, size - (size % HUGE_PAGE_SIZE), MADV_HUGEPAGE);
+    }
+#endif /* defined(MADV_HUGEPAGE) */
+
+    return ptr;
+}
+
+/**
+ * freeAlignedMemory
+ *
+ * Free aligned memory
+ *
+ * Input:
+ *      void *ptr
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases memory allocated through allocateAlignedMemory() on Linux
+ *
+ * Parameters:
+ *      ptr: pointer to memory to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void freeAlignedMemory(void *ptr)
+{
+    free(ptr);
+}
+
 #endif /* defined(OS_LINUX) */
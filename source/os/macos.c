@@ -23,6 +23,7 @@
 
 #if defined(OS_MACOS)
 
+#include <stdlib.h>
 #include <sys/param.h>
 #include <sys/sysctl.h>
 
@@ -68,4 +69,64 @@ HIDDEN long retrieveNumberOfCores()
     return (long)count;
 }
 
+/**
+ * allocateAlignedMemory
+ *
+ * Allocate aligned memory
+ *
+ * Input:
+ *      size_t size
+ *      size_t alignment
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function allocates memory aligned to the requested boundary on MacOS.
+ *  The returned memory shall be released through freeAlignedMemory()
+ *
+ * Parameters:
+ *      size: size (in bytes) of memory to allocate
+ *      alignment: requested alignment (in bytes), it shall be a power of 2 multiple of sizeof(void *)
+ *
+ * Return (void *):
+ *  != NULL in case of successful allocation, NULL otherwise
+ */
+HIDDEN void *allocateAlignedMemory(size_t size, size_t alignment)
+{
+    void *ptr;
+
+    /* Allocate aligned memory */
+    if (posix_memalign(&ptr, alignment, size) != 0) {
+        return NULL;
+    }
+
+    return ptr;
+}
+
+/**
+ * freeAlignedMemory
+ *
+ * Free aligned memory
+ *
+ * Input:
+ *      void *ptr
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases memory allocated through allocateAlignedMemory() on MacOS
+ *
+ * Parameters:
+ *      ptr: pointer to memory to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void freeAlignedMemory(void *ptr)
+{
+    free(ptr);
+}
+
 #endif /* defined(OS_MACOS) */
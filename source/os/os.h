@@ -37,7 +37,15 @@
 #endif
 
 
+#include <stddef.h>
+
+
+#define HUGE_PAGE_SIZE              (2 * 1024 * 1024)   /* Size of a (transparent) huge page */
+
+
 long retrieveNumberOfCores();
+void *allocateAlignedMemory(size_t size, size_t alignment);
+void freeAlignedMemory(void *ptr);
 
 
 #endif /* OS_H_ */
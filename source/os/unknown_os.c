@@ -23,6 +23,9 @@
 
 #if defined(OS_UNKNOWN)
 
+#include <stdint.h>
+#include <stdlib.h>
+
 #include "../compiler/compiler.h"
 
 
@@ -51,4 +54,74 @@ HIDDEN long retrieveNumberOfCores()
     return 1;
 }
 
+/**
+ * allocateAlignedMemory
+ *
+ * Allocate aligned memory
+ *
+ * Input:
+ *      size_t size
+ *      size_t alignment
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function allocates memory aligned to the requested boundary on an unknown OS.
+ *  The pointer returned by malloc() is stored right before the aligned memory.
+ *  The returned memory shall be released through freeAlignedMemory()
+ *
+ * Parameters:
+ *      size: size (in bytes) of memory to allocate
+ *      alignment: requested alignment (in bytes), it shall be a power of 2 multiple of sizeof(void *)
+ *
+ * Return (void *):
+ *  != NULL in case of successful allocation, NULL otherwise
+ */
+HIDDEN void *allocateAlignedMemory(size_t size, size_t alignment)
+{
+    unsigned char *raw;
+    unsigned char *ptr;
+
+    /* Allocate memory large enough to be aligned and to store the original pointer */
+    raw = (unsigned char *)malloc(size + alignment + sizeof(void *));
+    if (raw == NULL) {
+        return NULL;
+    }
+
+    /* Align memory and store the original pointer right before it */
+    ptr = raw + sizeof(void *);
+    ptr += (alignment - ((uintptr_t)ptr % alignment)) % alignment;
+    ((void **)ptr)[-1] = raw;
+
+    return ptr;
+}
+
+/**
+ * freeAlignedMemory
+ *
+ * Free aligned memory
+ *
+ * Input:
+ *      void *ptr
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases memory allocated through allocateAlignedMemory() on an unknown OS
+ *
+ * Parameters:
+ *      ptr: pointer to memory to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void freeAlignedMemory(void *ptr)
+{
+    if (ptr != NULL) {
+        free(((void **)ptr)[-1]);
+    }
+}
+
 #endif /* defined(OS_UNKNOWN) */
@@ -23,6 +23,7 @@
 
 #if defined(OS_WINDOWS)
 
+#include <malloc.h>
 #include <windows.h>
 
 #include "../compiler/compiler.h"
@@ -60,4 +61,58 @@ HIDDEN long retrieveNumberOfCores()
     return (long)count;
 }
 
+/**
+ * allocateAlignedMemory
+ *
+ * Allocate aligned memory
+ *
+ * Input:
+ *      size_t size
+ *      size_t alignment
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function allocates memory aligned to the requested boundary on Windows.
+ *  The returned memory shall be released through freeAlignedMemory()
+ *
+ * Parameters:
+ *      size: size (in bytes) of memory to allocate
+ *      alignment: requested alignment (in bytes), it shall be a power of 2 multiple of sizeof(void *)
+ *
+ * Return (void *):
+ *  != NULL in case of successful allocation, NULL otherwise
+ */
+HIDDEN void *allocateAlignedMemory(size_t size, size_t alignment)
+{
+    /* Allocate aligned memory using the proper Windows API */
+    return _aligned_malloc(size, alignment);
+}
+
+/**
+ * freeAlignedMemory
+ *
+ * Free aligned memory
+ *
+ * Input:
+ *      void *ptr
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases memory allocated through allocateAlignedMemory() on Windows
+ *
+ * Parameters:
+ *      ptr: pointer to memory to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+HIDDEN void freeAlignedMemory(void *ptr)
+{
+    _aligned_free(ptr);
+}
+
 #endif /* defined(OS_WINDOWS) */
@@ -24,6 +24,7 @@
 
 
 #include "rbd.h"
+#include "generic/rbd_internal_generic.h"
 
 
 /**
@@ -31,8 +32,7 @@
  */
 struct rbdParallelData
 {
-    unsigned char batchIdx;             /* Index of work batch */
-    unsigned int numCores;              /* Number of threads in SMP system */
+    struct rbdBatch batch;              /* Work batch (range of time instants) processed by Worker */
     double *reliabilities;              /* Reliabilities of Parallel RBD system (matrix for generic Parallel, array for identical Parallel) */
     double *output;                     /* Array of computed reliabilities */
     unsigned char numComponents;        /* Number of components of Parallel RBD system N */
@@ -40,11 +40,25 @@ struct rbdParallelData
 };
 
 
+/**
+ * Parallel RBD Workers, resolved once at library load time
+ */
+struct rbdParallelWorkers
+{
+    fpWorker genericWorker;             /* Generic Parallel RBD Worker */
+    fpWorker identicalWorker;           /* Identical Parallel RBD Worker */
+};
+
+
+/* Platform-generic and platform-specific Workers */
+extern struct rbdParallelWorkers parallelWorkers;
+
 /* Platform-generic and platform-specific functions */
-void *rbdParallelGenericWorker(void *arg);
-void *rbdParallelIdenticalWorker(void *arg);
+void rbdParallelResolveWorkers(void);
 
 /* Platform-generic functions */
+void *rbdParallelGenericWorkerS1d(void *arg);
+void *rbdParallelIdenticalWorkerS1d(void *arg);
 void rbdParallelGenericStepS1d(struct rbdParallelData *data, unsigned int time);
 void rbdParallelIdenticalStepS1d(struct rbdParallelData *data, unsigned int time);
 
@@ -0,0 +1,696 @@
+/*
+ *  Component: parametric.c
+ *  RBD management with parametric components
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "generic/rbd_internal_generic.h"
+
+#include "generic/scheduler.h"
+#include "generic/threadpool.h"
+#include "os/os.h"
+#include "bridge.h"
+#include "koon.h"
+#include "parallel.h"
+#include "parametric.h"
+#include "series.h"
+
+
+#define SQRT2                       (1.41421356237309504880)    /* Square root of 2 */
+
+
+static int rbdParametricInternal(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes, enum rbdBlockType type);
+static int rbdParametricCheckModel(struct rbdComponentModel *model);
+static void rbdParametricGenerate(struct rbdComponentModel *model, double *times, double *reliabilities, unsigned int numTimes);
+static void rbdParametricComputeTile(struct rbdParametricBlock *block, double *scratch, unsigned int time, unsigned int numTimes);
+static void *rbdParametricWorker(void *arg);
+
+
+/**
+ * rbdSeriesParametric
+ *
+ * Compute reliability of a Series RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic Series RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of Series RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in Series RBD system (N)
+ *      numTimes: number of time instants over which Series RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdSeriesParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned int numTimes)
+{
+    return rbdParametricInternal(models, times, output, numComponents, 0, numTimes, RBD_BLOCK_SERIES_GENERIC);
+}
+
+/**
+ * rbdParallelParametric
+ *
+ * Compute reliability of a Parallel RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic Parallel RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of Parallel RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in Parallel RBD system (N)
+ *      numTimes: number of time instants over which Parallel RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdParallelParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned int numTimes)
+{
+    return rbdParametricInternal(models, times, output, numComponents, 0, numTimes, RBD_BLOCK_PARALLEL_GENERIC);
+}
+
+/**
+ * rbdKooNParametric
+ *
+ * Compute reliability of a KooN (K-out-of-N) RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic KooN RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of KooN RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in KooN RBD system (N)
+ *      minComponents: minimum number of components required by KooN RBD system (K)
+ *      numTimes: number of time instants over which KooN RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdKooNParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes)
+{
+    return rbdParametricInternal(models, times, output, numComponents, minComponents, numTimes, RBD_BLOCK_KOON_GENERIC);
+}
+
+/**
+ * rbdBridgeParametric
+ *
+ * Compute reliability of a Bridge RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic Bridge RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of Bridge RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in Bridge RBD system (N)
+ *      numTimes: number of time instants over which Bridge RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdBridgeParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned int numTimes)
+{
+    return rbdParametricInternal(models, times, output, numComponents, 0, numTimes, RBD_BLOCK_BRIDGE_GENERIC);
+}
+
+
+/**
+ * rbdParametricInternal
+ *
+ * Compute reliability of an RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *      unsigned int numTimes
+ *      enum rbdBlockType type
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic RBD system with parametric
+ *  components. KooN RBD systems are mapped onto Series, Parallel or fixed reliability systems
+ *  as rbdKooNGeneric() does. Each Worker computes the reliabilities of all components over a
+ *  tile of time instants into its scratch tile, which fits into L1 cache, and then invokes
+ *  the resolved generic Worker of the RBD system over it
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in RBD system (N)
+ *      minComponents: minimum number of components required by KooN RBD system (K)
+ *      numTimes: number of time instants over which RBD shall be computed (T)
+ *      type: type of generic RBD system
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+static int rbdParametricInternal(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes, enum rbdBlockType type)
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    struct rbdParametricData *data;
+    void *poolJobs;
+    void *scheduler;
+    void *tileJob;
+    double timeCost;
+    unsigned int numCores;
+    enum rbdWorkload workload;
+#else                                           /* Under single processor-single thread conditional compiling */
+    struct rbdParametricData data[1];
+    const unsigned int numCores = 1;
+#endif /* CPU_SMP */
+    struct rbdParametricBlock block;
+    double *scratch;
+    unsigned int tileSize;
+    unsigned int idx;
+    int res;
+
+    /* Is array of time instants invalid? */
+    if (times == NULL) {
+        return -1;
+    }
+
+    /* Map KooN RBD system onto Parallel, Series or fixed reliability system */
+    block.bFill = 0;
+    block.value = 0.0;
+    block.koon = NULL;
+    if (type == RBD_BLOCK_KOON_GENERIC) {
+        if (minComponents == 1) {
+            /* If K is 1 then it is a Parallel block */
+            type = RBD_BLOCK_PARALLEL_GENERIC;
+        }
+        else if (minComponents == numComponents) {
+            /* If K is N then it is a Series block */
+            type = RBD_BLOCK_SERIES_GENERIC;
+        }
+        else if ((minComponents > numComponents) || (minComponents == 0)) {
+            /* If K is greater than N or equal to 0 fill output array with all zeroes or ones */
+            block.bFill = 1;
+            block.value = (minComponents == 0) ? 1.0 : 0.0;
+        }
+    }
+
+    /* If N of Series or Parallel system is equal to 0 return -1 */
+    if (((type == RBD_BLOCK_SERIES_GENERIC) || (type == RBD_BLOCK_PARALLEL_GENERIC)) && (numComponents == 0)) {
+        return -1;
+    }
+
+    /* If N of Bridge system is different from RBD_BRIDGE_COMPONENTS return -1 */
+    if ((type == RBD_BLOCK_BRIDGE_GENERIC) && (numComponents != RBD_BRIDGE_COMPONENTS)) {
+        return -1;
+    }
+
+    /* Are parametric models of components invalid? */
+    if (block.bFill == 0) {
+        if (models == NULL) {
+            return -1;
+        }
+        for (idx = 0; idx < numComponents; ++idx) {
+            if (rbdParametricCheckModel(&models[idx]) < 0) {
+                return -1;
+            }
+        }
+    }
+
+    /* Prepare combinations of generic KooN RBD system, return -1 in case of allocation failure */
+    if ((type == RBD_BLOCK_KOON_GENERIC) && (block.bFill == 0)) {
+        block.koon = (struct rbdKooNGenericPrepared *)malloc(sizeof(struct rbdKooNGenericPrepared));
+        if (block.koon == NULL) {
+            return -1;
+        }
+        (void)rbdKooNGenericPrepare(&block.koon->data, &block.koon->combs, numComponents, minComponents);
+    }
+
+    /* Compute the size of scratch tiles, fitting the reliabilities of all components and rounding down to a multiple of vector size */
+    tileSize = PARAMETRIC_SCRATCH_SIZE / (sizeof(double) * ((numComponents > 0) ? numComponents : 1));
+    tileSize = (tileSize / V8D) * V8D;
+    if (tileSize < V8D) {
+        tileSize = V8D;
+    }
+    if (tileSize > (((numTimes / V8D) + ((numTimes % V8D) != 0)) * V8D)) {
+        tileSize = ((numTimes / V8D) + ((numTimes % V8D) != 0)) * V8D;
+    }
+
+    /* Prepare RBD block */
+    block.type = type;
+    block.models = models;
+    block.times = times;
+    block.output = output;
+    block.numComponents = numComponents;
+    block.tileSize = tileSize;
+
+    res = 0;
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Estimate the cost of each time instant, including the computation of the reliabilities of components */
+    switch (type) {
+    case RBD_BLOCK_SERIES_GENERIC:
+        workload = WORKLOAD_SERIES_GENERIC;
+        break;
+    case RBD_BLOCK_PARALLEL_GENERIC:
+        workload = WORKLOAD_PARALLEL_GENERIC;
+        break;
+    case RBD_BLOCK_BRIDGE_GENERIC:
+        workload = WORKLOAD_BRIDGE_GENERIC;
+        break;
+    default:
+        workload = WORKLOAD_FILL;
+        if (block.koon != NULL) {
+            workload = (block.koon->data.bDynamic != 0) ? WORKLOAD_KOON_DYNAMIC : WORKLOAD_KOON_COMBINATIONS;
+        }
+        break;
+    }
+    if (block.koon != NULL) {
+        timeCost = computeTimeCost(workload, numComponents, block.koon->data.minComponents, block.koon->data.combEnd);
+    }
+    else {
+        timeCost = computeTimeCost(workload, numComponents, 0, 0);
+    }
+    if (block.bFill == 0) {
+        timeCost += PARAMETRIC_TIME_COST * numComponents;
+    }
+    /* Compute the number of used cores given the number of times and the estimated cost of each of them */
+    numCores = computeNumCores(numTimes, timeCost);
+
+    /* Allocate parametric RBD data array, return -1 in case of allocation failure */
+    data = (struct rbdParametricData *)malloc(sizeof(struct rbdParametricData) * numCores);
+    if (data == NULL) {
+        if (block.koon != NULL) {
+            rbdKooNGenericRelease(&block.koon->data);
+            free(block.koon);
+        }
+        return -1;
+    }
+#endif /* CPU_SMP */
+
+    /* Allocate scratch tiles of all Workers, return -1 in case of allocation failure */
+    scratch = NULL;
+    if (block.bFill == 0) {
+        scratch = (double *)allocateAlignedMemory(sizeof(double) * numComponents * tileSize * numCores, CACHE_LINE_SIZE);
+        if (scratch == NULL) {
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+            free(data);
+#endif /* CPU_SMP */
+            if (block.koon != NULL) {
+                rbdKooNGenericRelease(&block.koon->data);
+                free(block.koon);
+            }
+            return -1;
+        }
+    }
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Is number of used cores greater than 1? */
+    if (numCores > 1) {
+        /* Allocate thread pool jobs array and work-stealing scheduler of time tiles, return -1 in case of allocation failure */
+        poolJobs = allocatePoolJobs(numCores - 1);
+        scheduler = allocateTileScheduler(output, numTimes, numCores, computeTileSize(numTimes, timeCost, numCores));
+        if ((poolJobs == NULL) || (scheduler == NULL)) {
+            free(poolJobs);
+            if (scheduler != NULL) {
+                freeTileScheduler(scheduler);
+            }
+            if (scratch != NULL) {
+                freeAlignedMemory(scratch);
+            }
+            free(data);
+            if (block.koon != NULL) {
+                rbdKooNGenericRelease(&block.koon->data);
+                free(block.koon);
+            }
+            return -1;
+        }
+
+        /* For each available core... */
+        for (idx = 0; idx < (numCores - 1); ++idx) {
+            /* Prepare parametric RBD data structure */
+            data[idx].block = &block;
+            data[idx].scratch = (scratch != NULL) ? &scratch[numComponents * tileSize * idx] : NULL;
+
+            /* Dispatch the parametric RBD Worker onto thread pool, pulling time tiles from scheduler */
+            tileJob = prepareTileJob(scheduler, idx, &rbdParametricWorker, &data[idx], &data[idx].batch);
+            if (submitPoolJob(poolJobs, idx, &rbdTileWorker, tileJob) < 0) {
+                res = -1;
+            }
+        }
+
+        /* Prepare parametric RBD data structure */
+        data[idx].block = &block;
+        data[idx].scratch = (scratch != NULL) ? &scratch[numComponents * tileSize * idx] : NULL;
+
+        /* Directly invoke the parametric RBD Worker, pulling time tiles from scheduler */
+        tileJob = prepareTileJob(scheduler, idx, &rbdParametricWorker, &data[idx], &data[idx].batch);
+        (void)rbdTileWorker(tileJob);
+
+        /* Wait for dispatched jobs completion */
+        for (idx = 0; idx < (numCores - 1); ++idx) {
+            waitPoolJob(poolJobs, idx);
+        }
+        /* Free thread pool jobs array and work-stealing scheduler */
+        free(poolJobs);
+        freeTileScheduler(scheduler);
+    }
+    else {
+#endif /* CPU_SMP */
+        /* Prepare parametric RBD data structure */
+        computeBatch(&data[0].batch, output, numTimes, 1, 0);
+        data[0].block = &block;
+        data[0].scratch = scratch;
+
+        /* Directly invoke the parametric RBD Worker */
+        (void)rbdParametricWorker(&data[0]);
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    }
+
+    /* Free parametric RBD data array */
+    free(data);
+#endif /* CPU_SMP */
+
+    /* Free scratch tiles and release combinations of generic KooN RBD system */
+    if (scratch != NULL) {
+        freeAlignedMemory(scratch);
+    }
+    if (block.koon != NULL) {
+        rbdKooNGenericRelease(&block.koon->data);
+        free(block.koon);
+    }
+
+    return res;
+}
+
+/**
+ * rbdParametricCheckModel
+ *
+ * Check the parametric model of a component
+ *
+ * Input:
+ *      struct rbdComponentModel *model
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function checks the distribution and the parameters of a parametric model
+ *
+ * Parameters:
+ *      model: parametric model of component
+ *
+ * Return (int):
+ *  0 in case of valid model, < 0 otherwise
+ */
+static int rbdParametricCheckModel(struct rbdComponentModel *model)
+{
+    switch (model->distribution) {
+    case RBD_DISTRIBUTION_EXPONENTIAL:
+        /* Failure rate shall not be negative */
+        return (model->param1 >= 0.0) ? 0 : -1;
+    case RBD_DISTRIBUTION_WEIBULL:
+    case RBD_DISTRIBUTION_LOGNORMAL:
+        /* Shape and scale of Weibull and sigma of Lognormal shall be positive, mu is checked against NaN */
+        if (model->distribution == RBD_DISTRIBUTION_WEIBULL) {
+            return ((model->param1 > 0.0) && (model->param2 > 0.0)) ? 0 : -1;
+        }
+        return ((model->param1 == model->param1) && (model->param2 > 0.0)) ? 0 : -1;
+    default:
+        return -1;
+    }
+}
+
+/**
+ * rbdParametricGenerate
+ *
+ * Compute the reliabilities of a component from its parametric model
+ *
+ * Input:
+ *      struct rbdComponentModel *model
+ *      double *times
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *reliabilities
+ *
+ * Description:
+ *  This function computes the reliabilities of a component at the provided time instants,
+ *  shifted by the age of component. A component is reliable at non-positive times
+ *
+ * Parameters:
+ *      model: parametric model of component
+ *      times: this array contains the time instants
+ *      reliabilities: this array contains the computed reliabilities of component
+ *      numTimes: number of time instants
+ *
+ * Return:
+ *      None
+ */
+static void rbdParametricGenerate(struct rbdComponentModel *model, double *times, double *reliabilities, unsigned int numTimes)
+{
+    unsigned int idx;
+    double time;
+
+    switch (model->distribution) {
+    case RBD_DISTRIBUTION_EXPONENTIAL:
+        /* R(t) = exp(-lambda * t) */
+        for (idx = 0; idx < numTimes; ++idx) {
+            time = times[idx] + model->age;
+            reliabilities[idx] = (time > 0.0) ? exp(-model->param1 * time) : 1.0;
+        }
+        break;
+    case RBD_DISTRIBUTION_WEIBULL:
+        /* R(t) = exp(-(t / eta)^beta) */
+        for (idx = 0; idx < numTimes; ++idx) {
+            time = times[idx] + model->age;
+            reliabilities[idx] = (time > 0.0) ? exp(-pow(time / model->param2, model->param1)) : 1.0;
+        }
+        break;
+    case RBD_DISTRIBUTION_LOGNORMAL:
+    default:
+        /* R(t) = erfc((ln(t) - mu) / (sigma * sqrt(2))) / 2 */
+        for (idx = 0; idx < numTimes; ++idx) {
+            time = times[idx] + model->age;
+            reliabilities[idx] = (time > 0.0) ? (0.5 * erfc((log(time) - model->param1) / (model->param2 * SQRT2))) : 1.0;
+        }
+        break;
+    }
+}
+
+/**
+ * rbdParametricComputeTile
+ *
+ * Compute reliability of an RBD system with parametric components over a tile of time instants
+ *
+ * Input:
+ *      struct rbdParametricBlock *block
+ *      double *scratch
+ *      unsigned int time
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the reliabilities of all components over a tile of time instants
+ *  into the scratch tile, whose rows are block->tileSize long, and directly invokes the
+ *  resolved generic Worker of the RBD system over it
+ *
+ * Parameters:
+ *      block: prepared RBD block
+ *      scratch: scratch tile of Worker
+ *      time: first time instant of tile
+ *      numTimes: number of time instants of tile
+ *
+ * Return:
+ *      None
+ */
+static void rbdParametricComputeTile(struct rbdParametricBlock *block, double *scratch, unsigned int time, unsigned int numTimes)
+{
+    struct rbdSeriesData seriesData;
+    struct rbdParallelData parallelData;
+    struct rbdBridgeData bridgeData;
+    struct rbdKooNGenericData koonData;
+    struct rbdKooNFillData fillData;
+    struct rbdBatch batch;
+    unsigned int idx;
+
+    /* Each RBD block is computed by a single Worker over all time instants of tile */
+    batch.batchIdx = 0;
+    batch.numBatches = 1;
+    batch.tBegin = 0;
+    batch.tEnd = numTimes;
+
+    /* Is the reliability of RBD block fixed? Directly invoke the fill output data Worker */
+    if (block->bFill != 0) {
+        fillData.batch = batch;
+        fillData.output = &block->output[time];
+        fillData.numTimes = numTimes;
+        fillData.value = block->value;
+        (void)(*koonWorkers.fillWorker)(&fillData);
+        return;
+    }
+
+    /* Compute the reliabilities of all components over tile */
+    for (idx = 0; idx < block->numComponents; ++idx) {
+        rbdParametricGenerate(&block->models[idx], &block->times[time], &scratch[idx * block->tileSize], numTimes);
+    }
+
+    switch (block->type) {
+    case RBD_BLOCK_SERIES_GENERIC:
+        /* Directly invoke the generic Series RBD Worker */
+        seriesData.batch = batch;
+        seriesData.reliabilities = scratch;
+        seriesData.output = &block->output[time];
+        seriesData.numComponents = block->numComponents;
+        seriesData.numTimes = block->tileSize;
+        (void)(*seriesWorkers.genericWorker)(&seriesData);
+        break;
+    case RBD_BLOCK_PARALLEL_GENERIC:
+        /* Directly invoke the generic Parallel RBD Worker */
+        parallelData.batch = batch;
+        parallelData.reliabilities = scratch;
+        parallelData.output = &block->output[time];
+        parallelData.numComponents = block->numComponents;
+        parallelData.numTimes = block->tileSize;
+        (void)(*parallelWorkers.genericWorker)(&parallelData);
+        break;
+    case RBD_BLOCK_BRIDGE_GENERIC:
+        /* Directly invoke the generic Bridge RBD Worker */
+        bridgeData.batch = batch;
+        bridgeData.reliabilities = scratch;
+        bridgeData.output = &block->output[time];
+        bridgeData.numComponents = block->numComponents;
+        bridgeData.numTimes = block->tileSize;
+        (void)(*bridgeWorkers.genericWorker)(&bridgeData);
+        break;
+    case RBD_BLOCK_KOON_GENERIC:
+    default:
+        /* Directly invoke the generic KooN RBD Worker, starting from prepared KooN RBD data */
+        koonData = block->koon->data;
+        koonData.batch = batch;
+        koonData.reliabilities = scratch;
+        koonData.output = &block->output[time];
+        koonData.numTimes = block->tileSize;
+        (void)(*koonWorkers.genericWorker)(&koonData);
+        break;
+    }
+}
+
+/**
+ * rbdParametricWorker
+ *
+ * Parametric RBD Worker function
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the parametric RBD Worker.
+ *  It is responsible to compute the reliabilities over a given batch of an RBD system with
+ *  parametric components, split into tiles fitting into its scratch tile
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a parametric RBD data. It is provided as a
+ *                      void pointer to allow SMP computation of RBD system
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *rbdParametricWorker(void *arg)
+{
+    struct rbdParametricData *data;
+    unsigned int time;
+    unsigned int numTimes;
+
+    data = (struct rbdParametricData *)arg;
+
+    /* For each tile of batch... */
+    for (time = data->batch.tBegin; time < data->batch.tEnd; time += numTimes) {
+        numTimes = minimum(data->block->tileSize, data->batch.tEnd - time);
+        /* Compute reliabilities of components and RBD system over current tile */
+        rbdParametricComputeTile(data->block, data->scratch, time, numTimes);
+    }
+
+    return NULL;
+}
@@ -0,0 +1,62 @@
+/*
+ *  Component: parametric.h
+ *  RBD management with parametric components
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef PARAMETRIC_H_
+#define PARAMETRIC_H_
+
+
+#include "rbd.h"
+#include "generic/rbd_internal_generic.h"
+#include "koon.h"
+
+
+#define PARAMETRIC_SCRATCH_SIZE     (16 * 1024)     /* Target size (in bytes) of scratch tile of each Worker, fitting into L1 cache */
+#define PARAMETRIC_TIME_COST        (20.0)          /* Estimated cost of computing the reliability of a component at a time instant */
+
+
+/**
+ * RBD block with parametric components, prepared once and computed over all tiles of time instants
+ */
+struct rbdParametricBlock
+{
+    enum rbdBlockType type;                         /* Type of RBD block computed over the reliabilities of components */
+    struct rbdComponentModel *models;               /* Array of parametric models of components */
+    double *times;                                  /* Array of time instants */
+    double *output;                                 /* Array of computed reliabilities */
+    unsigned char numComponents;                    /* Number of components of RBD block N */
+    unsigned char bFill;                            /* Flag for RBD block with fixed reliability, i.e. KooN with K = 0 or K > N */
+    double value;                                   /* Fixed reliability of RBD block (fill only) */
+    struct rbdKooNGenericPrepared *koon;            /* Prepared generic KooN RBD block (generic KooN only) */
+    unsigned int tileSize;                          /* Number of time instants of each row of scratch tile */
+};
+
+/**
+ * Data used during computation of RBD block with parametric components
+ */
+struct rbdParametricData
+{
+    struct rbdBatch batch;              /* Work batch (range of time instants) processed by Worker */
+    struct rbdParametricBlock *block;   /* Prepared RBD block */
+    double *scratch;                    /* Scratch tile of Worker, holding a row of reliabilities for each component */
+};
+
+
+#endif /* PARAMETRIC_H_ */
@@ -0,0 +1,598 @@
+/*
+ *  Component: sequence.c
+ *  Sequence of dependent RBD blocks management
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "generic/rbd_internal_generic.h"
+
+#include "generic/scheduler.h"
+#include "generic/threadpool.h"
+#include "bridge.h"
+#include "koon.h"
+#include "parallel.h"
+#include "series.h"
+#include "sequence.h"
+
+
+static int rbdSequencePrepareStep(struct rbdSequenceStep *step, struct rbdBlock *block, unsigned int numTimes);
+static void rbdSequenceReleaseSteps(struct rbdSequenceStep *steps, unsigned int numSteps);
+static unsigned int rbdSequenceTileSize(struct rbdSequenceStep *steps, unsigned int numSteps, unsigned int numTimes);
+static void rbdSequenceComputeTile(struct rbdSequenceData *data, struct rbdBatch *batch);
+static void *rbdSequenceWorker(void *arg);
+
+
+/**
+ * rbdSequenceEvaluate
+ *
+ * Compute reliability of a sequence of dependent RBD blocks
+ *
+ * Input:
+ *      struct rbdBlock *blocks
+ *      unsigned int numBlocks
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the provided RBD blocks, with the same result as invoking the
+ *  corresponding RBD functions in the provided order. Since the reliability of each time
+ *  instant only depends on the reliabilities of the same time instant, the time instants
+ *  are processed in tiles: all the blocks are computed over a tile, in the provided order,
+ *  before moving to the next one. The tile size is chosen so that all the data accessed by
+ *  the blocks over a tile fits into L2 cache, hence the outputs of preceding blocks are
+ *  read from cache. Under SMP, the tiles are distributed among cores through the
+ *  work-stealing scheduler of time tiles
+ *
+ * Parameters:
+ *      blocks: this array contains the RBD blocks to be computed, in dependency order
+ *      numBlocks: number of RBD blocks
+ *      numTimes: number of time instants over which RBD blocks shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdSequenceEvaluate(struct rbdBlock *blocks, unsigned int numBlocks, unsigned int numTimes)
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    struct rbdSequenceData *data;
+    void *poolJobs;
+    void *scheduler;
+    void *tileJob;
+    double timeCost;
+    unsigned int numCores;
+    unsigned char minComponents;
+    unsigned long long numCombinations;
+#else                                           /* Under single processor-single thread conditional compiling */
+    struct rbdSequenceData data[1];
+#endif /* CPU_SMP */
+    struct rbdSequenceStep *steps;
+    double *output;
+    unsigned int tileSize;
+    unsigned int idx;
+    int res;
+
+    /* Is array of blocks invalid or empty? */
+    if ((blocks == NULL) || (numBlocks == 0)) {
+        return -1;
+    }
+
+    /* Allocate steps array, return -1 in case of allocation failure */
+    steps = (struct rbdSequenceStep *)malloc(sizeof(struct rbdSequenceStep) * numBlocks);
+    if (steps == NULL) {
+        return -1;
+    }
+
+    /* Prepare all steps, return -1 in case of invalid block or allocation failure */
+    for (idx = 0; idx < numBlocks; ++idx) {
+        if (rbdSequencePrepareStep(&steps[idx], &blocks[idx], numTimes) < 0) {
+            rbdSequenceReleaseSteps(steps, idx);
+            return -1;
+        }
+    }
+
+    /* If T is equal to 0 there is nothing to compute */
+    if (numTimes == 0) {
+        rbdSequenceReleaseSteps(steps, numBlocks);
+        return 0;
+    }
+
+    res = 0;
+
+    /* Compute the size of tiles given the data accessed by all steps, tiles are aligned to output of last block */
+    tileSize = rbdSequenceTileSize(steps, numBlocks, numTimes);
+    output = steps[numBlocks - 1].output;
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Estimate the cost of each time instant as the sum of the costs of all blocks */
+    timeCost = 0.0;
+    for (idx = 0; idx < numBlocks; ++idx) {
+        minComponents = 0;
+        numCombinations = 0;
+        if (steps[idx].koonGeneric != NULL) {
+            minComponents = steps[idx].koonGeneric->data.minComponents;
+            numCombinations = steps[idx].koonGeneric->data.combEnd;
+        }
+        if (steps[idx].koonIdentical != NULL) {
+            minComponents = steps[idx].koonIdentical->data.minComponents;
+        }
+        timeCost += computeTimeCost(steps[idx].workload, steps[idx].numComponents, minComponents, numCombinations);
+    }
+    /* Compute the number of used cores given the number of times and the estimated cost of each of them */
+    numCores = computeNumCores(numTimes, timeCost);
+
+    /* Allocate sequence data array, return -1 in case of allocation failure */
+    data = (struct rbdSequenceData *)malloc(sizeof(struct rbdSequenceData) * numCores);
+    if (data == NULL) {
+        rbdSequenceReleaseSteps(steps, numBlocks);
+        return -1;
+    }
+
+    /* Is number of used cores greater than 1? */
+    if (numCores > 1) {
+        /* Allocate thread pool jobs array and work-stealing scheduler of time tiles, return -1 in case of allocation failure */
+        poolJobs = allocatePoolJobs(numCores - 1);
+        scheduler = allocateTileScheduler(output, numTimes, numCores, computeTileSize(numTimes, timeCost, numCores));
+        if ((poolJobs == NULL) || (scheduler == NULL)) {
+            free(poolJobs);
+            if (scheduler != NULL) {
+                freeTileScheduler(scheduler);
+            }
+            free(data);
+            rbdSequenceReleaseSteps(steps, numBlocks);
+            return -1;
+        }
+
+        /* For each available core... */
+        for (idx = 0; idx < (numCores - 1); ++idx) {
+            /* Prepare sequence data structure */
+            data[idx].steps = steps;
+            data[idx].numSteps = numBlocks;
+            data[idx].numTimes = numTimes;
+            data[idx].tileSize = tileSize;
+
+            /* Dispatch the sequence Worker onto thread pool, pulling time tiles from scheduler */
+            tileJob = prepareTileJob(scheduler, idx, &rbdSequenceWorker, &data[idx], &data[idx].batch);
+            if (submitPoolJob(poolJobs, idx, &rbdTileWorker, tileJob) < 0) {
+                res = -1;
+            }
+        }
+
+        /* Prepare sequence data structure */
+        data[idx].steps = steps;
+        data[idx].numSteps = numBlocks;
+        data[idx].numTimes = numTimes;
+        data[idx].tileSize = tileSize;
+
+        /* Directly invoke the sequence Worker, pulling time tiles from scheduler */
+        tileJob = prepareTileJob(scheduler, idx, &rbdSequenceWorker, &data[idx], &data[idx].batch);
+        (void)rbdTileWorker(tileJob);
+
+        /* Wait for dispatched jobs completion */
+        for (idx = 0; idx < (numCores - 1); ++idx) {
+            waitPoolJob(poolJobs, idx);
+        }
+        /* Free thread pool jobs array and work-stealing scheduler */
+        free(poolJobs);
+        freeTileScheduler(scheduler);
+    }
+    else {
+#endif /* CPU_SMP */
+        /* Prepare sequence data structure */
+        computeBatch(&data[0].batch, output, numTimes, 1, 0);
+        data[0].steps = steps;
+        data[0].numSteps = numBlocks;
+        data[0].numTimes = numTimes;
+        data[0].tileSize = tileSize;
+
+        /* Directly invoke the sequence Worker */
+        (void)rbdSequenceWorker(&data[0]);
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    }
+
+    /* Free sequence data array */
+    free(data);
+#endif /* CPU_SMP */
+
+    /* Release all steps */
+    rbdSequenceReleaseSteps(steps, numBlocks);
+
+    return res;
+}
+
+
+/**
+ * rbdSequencePrepareStep
+ *
+ * Prepare the step computing an RBD block
+ *
+ * Input:
+ *      struct rbdBlock *block
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      struct rbdSequenceStep *step
+ *
+ * Description:
+ *  This function validates the RBD block and selects its Worker, mapping KooN RBD blocks onto
+ *  Series, Parallel or fixed reliability blocks as the corresponding RBD functions do.
+ *  The binomial coefficients and combinations of KooN RBD blocks are prepared once, they
+ *  shall be released through rbdSequenceReleaseSteps(). In case of failure, nothing is
+ *  left to be released
+ *
+ * Parameters:
+ *      step: step to be prepared
+ *      block: RBD block computed by step
+ *      numTimes: number of time instants over which RBD blocks shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful preparation, < 0 otherwise
+ */
+static int rbdSequencePrepareStep(struct rbdSequenceStep *step, struct rbdBlock *block, unsigned int numTimes)
+{
+    unsigned char numComponents;
+    unsigned char minComponents;
+    unsigned char bIdentical;
+
+    numComponents = block->numComponents;
+    minComponents = block->minComponents;
+
+    /* Initialize step */
+    step->reliabilities = block->reliabilities;
+    step->output = block->output;
+    step->numComponents = numComponents;
+    step->value = 0.0;
+    step->koonGeneric = NULL;
+    step->koonIdentical = NULL;
+
+    switch (block->type) {
+    case RBD_BLOCK_SERIES_GENERIC:
+    case RBD_BLOCK_SERIES_IDENTICAL:
+        step->type = SEQUENCE_STEP_SERIES;
+        break;
+    case RBD_BLOCK_PARALLEL_GENERIC:
+    case RBD_BLOCK_PARALLEL_IDENTICAL:
+        step->type = SEQUENCE_STEP_PARALLEL;
+        break;
+    case RBD_BLOCK_BRIDGE_GENERIC:
+    case RBD_BLOCK_BRIDGE_IDENTICAL:
+        /* If N is different from RBD_BRIDGE_COMPONENTS return -1 */
+        if (numComponents != RBD_BRIDGE_COMPONENTS) {
+            return -1;
+        }
+        step->type = SEQUENCE_STEP_BRIDGE;
+        break;
+    case RBD_BLOCK_KOON_GENERIC:
+    case RBD_BLOCK_KOON_IDENTICAL:
+        if (minComponents == 1) {
+            /* If K is 1 then it is a Parallel block */
+            step->type = SEQUENCE_STEP_PARALLEL;
+        }
+        else if (minComponents == numComponents) {
+            /* If K is N then it is a Series block */
+            step->type = SEQUENCE_STEP_SERIES;
+        }
+        else if ((minComponents > numComponents) || (minComponents == 0)) {
+            /* If K is greater than N or equal to 0 fill output array with all zeroes or ones */
+            step->type = SEQUENCE_STEP_FILL;
+            step->value = (minComponents == 0) ? 1.0 : 0.0;
+        }
+        else if (block->type == RBD_BLOCK_KOON_GENERIC) {
+            /* Allocate and prepare generic KooN RBD block, return -1 in case of allocation failure */
+            step->type = SEQUENCE_STEP_KOON_GENERIC;
+            step->koonGeneric = (struct rbdKooNGenericPrepared *)malloc(sizeof(struct rbdKooNGenericPrepared));
+            if (step->koonGeneric == NULL) {
+                return -1;
+            }
+            (void)rbdKooNGenericPrepare(&step->koonGeneric->data, &step->koonGeneric->combs, numComponents, minComponents);
+            step->koonGeneric->data.reliabilities = block->reliabilities;
+            step->koonGeneric->data.output = block->output;
+            step->koonGeneric->data.numTimes = numTimes;
+        }
+        else {
+            /* Allocate and prepare identical KooN RBD block, return -1 in case of allocation failure */
+            step->type = SEQUENCE_STEP_KOON_IDENTICAL;
+            step->koonIdentical = (struct rbdKooNIdenticalPrepared *)malloc(sizeof(struct rbdKooNIdenticalPrepared));
+            if (step->koonIdentical == NULL) {
+                return -1;
+            }
+            rbdKooNIdenticalPrepare(&step->koonIdentical->data, &step->koonIdentical->nCi[0], numComponents, minComponents);
+            step->koonIdentical->data.reliabilities = block->reliabilities;
+            step->koonIdentical->data.output = block->output;
+            step->koonIdentical->data.numTimes = numTimes;
+        }
+        break;
+    default:
+        return -1;
+    }
+
+    /* If N of Series or Parallel block is equal to 0 return -1 */
+    if (((step->type == SEQUENCE_STEP_SERIES) || (step->type == SEQUENCE_STEP_PARALLEL)) && (numComponents == 0)) {
+        return -1;
+    }
+
+    /* Select Worker of step, its workload and number of rows of reliabilities it reads */
+    bIdentical = (block->type == RBD_BLOCK_SERIES_IDENTICAL) || (block->type == RBD_BLOCK_PARALLEL_IDENTICAL) ||
+                 (block->type == RBD_BLOCK_KOON_IDENTICAL) || (block->type == RBD_BLOCK_BRIDGE_IDENTICAL);
+    step->numRows = (bIdentical != 0) ? 1 : numComponents;
+    switch (step->type) {
+    case SEQUENCE_STEP_SERIES:
+        step->fpWorker = (bIdentical != 0) ? seriesWorkers.identicalWorker : seriesWorkers.genericWorker;
+        step->workload = (bIdentical != 0) ? WORKLOAD_SERIES_IDENTICAL : WORKLOAD_SERIES_GENERIC;
+        break;
+    case SEQUENCE_STEP_PARALLEL:
+        step->fpWorker = (bIdentical != 0) ? parallelWorkers.identicalWorker : parallelWorkers.genericWorker;
+        step->workload = (bIdentical != 0) ? WORKLOAD_PARALLEL_IDENTICAL : WORKLOAD_PARALLEL_GENERIC;
+        break;
+    case SEQUENCE_STEP_BRIDGE:
+        step->fpWorker = (bIdentical != 0) ? bridgeWorkers.identicalWorker : bridgeWorkers.genericWorker;
+        step->workload = (bIdentical != 0) ? WORKLOAD_BRIDGE_IDENTICAL : WORKLOAD_BRIDGE_GENERIC;
+        break;
+    case SEQUENCE_STEP_KOON_GENERIC:
+        step->fpWorker = koonWorkers.genericWorker;
+        step->workload = (step->koonGeneric->data.bDynamic != 0) ? WORKLOAD_KOON_DYNAMIC : WORKLOAD_KOON_COMBINATIONS;
+        break;
+    case SEQUENCE_STEP_KOON_IDENTICAL:
+        step->fpWorker = koonWorkers.identicalWorker;
+        step->workload = WORKLOAD_KOON_IDENTICAL;
+        break;
+    case SEQUENCE_STEP_FILL:
+    default:
+        step->fpWorker = koonWorkers.fillWorker;
+        step->workload = WORKLOAD_FILL;
+        step->numRows = 0;
+        break;
+    }
+
+    return 0;
+}
+
+/**
+ * rbdSequenceReleaseSteps
+ *
+ * Release the steps computing a sequence of RBD blocks
+ *
+ * Input:
+ *      struct rbdSequenceStep *steps
+ *      unsigned int numSteps
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the KooN RBD blocks prepared by rbdSequencePrepareStep() and the
+ *  steps array
+ *
+ * Parameters:
+ *      steps: array of steps
+ *      numSteps: number of prepared steps
+ *
+ * Return:
+ *      None
+ */
+static void rbdSequenceReleaseSteps(struct rbdSequenceStep *steps, unsigned int numSteps)
+{
+    unsigned int idx;
+
+    /* For each prepared step... */
+    for (idx = 0; idx < numSteps; ++idx) {
+        if (steps[idx].koonGeneric != NULL) {
+            rbdKooNGenericRelease(&steps[idx].koonGeneric->data);
+            free(steps[idx].koonGeneric);
+        }
+        free(steps[idx].koonIdentical);
+    }
+
+    free(steps);
+}
+
+/**
+ * rbdSequenceTileSize
+ *
+ * Compute the size of tiles of a sequence of RBD blocks
+ *
+ * Input:
+ *      struct rbdSequenceStep *steps
+ *      unsigned int numSteps
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the number of time instants of each tile, so that the reliabilities
+ *  and outputs accessed by all steps over a tile fit into SEQUENCE_TILE_BYTES. The size is a
+ *  multiple of the widest vector size and at least SEQUENCE_MIN_TILE_SIZE: shorter tiles would
+ *  interleave many short streams, which the hardware prefetcher cannot follow. The size is at
+ *  most the (rounded up) number of times
+ *
+ * Parameters:
+ *      steps: array of prepared steps
+ *      numSteps: number of steps
+ *      numTimes: number of time instants over which RBD blocks shall be computed (T)
+ *
+ * Return (unsigned int):
+ *  Number of time instants of each tile
+ */
+static unsigned int rbdSequenceTileSize(struct rbdSequenceStep *steps, unsigned int numSteps, unsigned int numTimes)
+{
+    unsigned long long timeSize;
+    unsigned long long tileSize;
+    unsigned int maxTileSize;
+    unsigned int idx;
+
+    /* Compute the size of data accessed by all steps over a single time instant */
+    timeSize = 0;
+    for (idx = 0; idx < numSteps; ++idx) {
+        timeSize += sizeof(double) * (steps[idx].numRows + 1);
+    }
+
+    /* Fit data of all steps into tile, rounding down to a multiple of vector size */
+    tileSize = SEQUENCE_TILE_BYTES / timeSize;
+    tileSize = (tileSize / V8D) * V8D;
+    if (tileSize < SEQUENCE_MIN_TILE_SIZE) {
+        tileSize = SEQUENCE_MIN_TILE_SIZE;
+    }
+
+    /* Avoid tiles longer than needed */
+    maxTileSize = ((numTimes / V8D) + ((numTimes % V8D) != 0)) * V8D;
+    if (tileSize > maxTileSize) {
+        tileSize = maxTileSize;
+    }
+
+    return (unsigned int)tileSize;
+}
+
+/**
+ * rbdSequenceComputeTile
+ *
+ * Compute all RBD blocks of a sequence over a tile of time instants
+ *
+ * Input:
+ *      struct rbdSequenceData *data
+ *      struct rbdBatch *batch
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes all the steps over a tile of time instants in the provided order,
+ *  directly invoking their Workers over the tile
+ *
+ * Parameters:
+ *      data: sequence data
+ *      batch: tile of time instants to be computed
+ *
+ * Return:
+ *      None
+ */
+static void rbdSequenceComputeTile(struct rbdSequenceData *data, struct rbdBatch *batch)
+{
+    struct rbdSeriesData seriesData;
+    struct rbdParallelData parallelData;
+    struct rbdBridgeData bridgeData;
+    struct rbdKooNGenericData koonGenericData;
+    struct rbdKooNIdenticalData koonIdenticalData;
+    struct rbdKooNFillData fillData;
+    struct rbdSequenceStep *step;
+    unsigned int idx;
+
+    /* For each step, in the provided order... */
+    for (idx = 0; idx < data->numSteps; ++idx) {
+        step = &data->steps[idx];
+
+        switch (step->type) {
+        case SEQUENCE_STEP_SERIES:
+            /* Directly invoke the Series RBD Worker */
+            seriesData.batch = *batch;
+            seriesData.reliabilities = step->reliabilities;
+            seriesData.output = step->output;
+            seriesData.numComponents = step->numComponents;
+            seriesData.numTimes = data->numTimes;
+            (void)(*step->fpWorker)(&seriesData);
+            break;
+        case SEQUENCE_STEP_PARALLEL:
+            /* Directly invoke the Parallel RBD Worker */
+            parallelData.batch = *batch;
+            parallelData.reliabilities = step->reliabilities;
+            parallelData.output = step->output;
+            parallelData.numComponents = step->numComponents;
+            parallelData.numTimes = data->numTimes;
+            (void)(*step->fpWorker)(&parallelData);
+            break;
+        case SEQUENCE_STEP_BRIDGE:
+            /* Directly invoke the Bridge RBD Worker */
+            bridgeData.batch = *batch;
+            bridgeData.reliabilities = step->reliabilities;
+            bridgeData.output = step->output;
+            bridgeData.numComponents = step->numComponents;
+            bridgeData.numTimes = data->numTimes;
+            (void)(*step->fpWorker)(&bridgeData);
+            break;
+        case SEQUENCE_STEP_KOON_GENERIC:
+            /* Directly invoke the generic KooN RBD Worker, starting from prepared KooN RBD data */
+            koonGenericData = step->koonGeneric->data;
+            koonGenericData.batch = *batch;
+            (void)(*step->fpWorker)(&koonGenericData);
+            break;
+        case SEQUENCE_STEP_KOON_IDENTICAL:
+            /* Directly invoke the identical KooN RBD Worker, starting from prepared KooN RBD data */
+            koonIdenticalData = step->koonIdentical->data;
+            koonIdenticalData.batch = *batch;
+            (void)(*step->fpWorker)(&koonIdenticalData);
+            break;
+        case SEQUENCE_STEP_FILL:
+        default:
+            /* Directly invoke the fill output data Worker */
+            fillData.batch = *batch;
+            fillData.output = step->output;
+            fillData.numTimes = data->numTimes;
+            fillData.value = step->value;
+            (void)(*step->fpWorker)(&fillData);
+            break;
+        }
+    }
+}
+
+/**
+ * rbdSequenceWorker
+ *
+ * Sequence of RBD blocks Worker function
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the sequence of RBD blocks Worker.
+ *  It is responsible to compute all RBD blocks over a given batch, split into tiles
+ *  whose data fits into L2 cache
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a sequence data. It is provided as a
+ *                      void pointer to allow SMP computation of sequence of RBD blocks
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *rbdSequenceWorker(void *arg)
+{
+    struct rbdSequenceData *data;
+    struct rbdBatch batch;
+    unsigned int time;
+
+    data = (struct rbdSequenceData *)arg;
+
+    /* Each tile is processed by the Worker as a single contiguous batch */
+    batch.batchIdx = 0;
+    batch.numBatches = 1;
+
+    /* For each tile of batch... */
+    for (time = data->batch.tBegin; time < data->batch.tEnd; time = batch.tEnd) {
+        batch.tBegin = time;
+        batch.tEnd = time + minimum(data->tileSize, data->batch.tEnd - time);
+        /* Compute all steps over current tile */
+        rbdSequenceComputeTile(data, &batch);
+    }
+
+    return NULL;
+}
@@ -0,0 +1,78 @@
+/*
+ *  Component: sequence.h
+ *  Sequence of dependent RBD blocks management
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SEQUENCE_H_
+#define SEQUENCE_H_
+
+
+#include "rbd.h"
+#include "generic/rbd_internal_generic.h"
+#include "koon.h"
+
+
+#define SEQUENCE_TILE_BYTES         (512 * 1024)    /* Target size (in bytes) of data accessed by all blocks over a tile, fitting into L2 cache */
+#define SEQUENCE_MIN_TILE_SIZE      (1024)          /* Minimum number of time instants of a tile, keeping hardware prefetcher streams long enough */
+
+
+/**
+ * Type of step of sequence of RBD blocks, i.e. the Worker data used to compute the block
+ */
+enum rbdSequenceStepType
+{
+    SEQUENCE_STEP_SERIES = 0,           /* Series RBD block (generic or identical) */
+    SEQUENCE_STEP_PARALLEL,             /* Parallel RBD block (generic or identical) */
+    SEQUENCE_STEP_BRIDGE,               /* Bridge RBD block (generic or identical) */
+    SEQUENCE_STEP_KOON_GENERIC,         /* Generic KooN RBD block, with K in [2, N-1] */
+    SEQUENCE_STEP_KOON_IDENTICAL,       /* Identical KooN RBD block, with K in [2, N-1] */
+    SEQUENCE_STEP_FILL                  /* KooN RBD block with fixed reliability, i.e. K = 0 or K > N */
+};
+
+/**
+ * Step of sequence of RBD blocks, prepared once and computed over all tiles of time instants
+ */
+struct rbdSequenceStep
+{
+    enum rbdSequenceStepType type;                  /* Type of step */
+    fpWorker fpWorker;                              /* Worker computing the RBD block */
+    enum rbdWorkload workload;                      /* Workload of Worker, used to estimate the cost of each time instant */
+    double *reliabilities;                          /* Reliabilities of components of RBD block */
+    double *output;                                 /* Array of computed reliabilities */
+    unsigned char numComponents;                    /* Number of components of RBD block N */
+    unsigned char numRows;                          /* Number of rows of reliabilities read by Worker */
+    double value;                                   /* Fixed reliability of RBD block (fill only) */
+    struct rbdKooNGenericPrepared *koonGeneric;     /* Prepared generic KooN RBD block (generic KooN only) */
+    struct rbdKooNIdenticalPrepared *koonIdentical; /* Prepared identical KooN RBD block (identical KooN only) */
+};
+
+/**
+ * Data used during sequence of RBD blocks computation
+ */
+struct rbdSequenceData
+{
+    struct rbdBatch batch;              /* Work batch (range of time instants) processed by Worker */
+    struct rbdSequenceStep *steps;      /* Array of prepared steps */
+    unsigned int numSteps;              /* Number of steps */
+    unsigned int numTimes;              /* Number of time instants to compute T */
+    unsigned int tileSize;              /* Number of time instants of each tile computed by all steps */
+};
+
+
+#endif /* SEQUENCE_H_ */
@@ -24,6 +24,7 @@
 
 
 #include "rbd.h"
+#include "generic/rbd_internal_generic.h"
 
 
 /**
@@ -31,8 +32,7 @@
  */
 struct rbdSeriesData
 {
-    unsigned char batchIdx;             /* Index of work batch */
-    unsigned int numCores;              /* Number of threads in SMP system */
+    struct rbdBatch batch;              /* Work batch (range of time instants) processed by Worker */
     double *reliabilities;              /* Reliabilities of Series RBD system (matrix for generic Series, array for identical Series) */
     double *output;                     /* Array of computed reliabilities */
     unsigned char numComponents;        /* Number of components of Series RBD system N */
@@ -40,11 +40,25 @@ struct rbdSeriesData
 };
 
 
+/**
+ * Series RBD Workers, resolved once at library load time
+ */
+struct rbdSeriesWorkers
+{
+    fpWorker genericWorker;             /* Generic Series RBD Worker */
+    fpWorker identicalWorker;           /* Identical Series RBD Worker */
+};
+
+
+/* Platform-generic and platform-specific Workers */
+extern struct rbdSeriesWorkers seriesWorkers;
+
 /* Platform-generic and platform-specific functions */
-void *rbdSeriesGenericWorker(void *arg);
-void *rbdSeriesIdenticalWorker(void *arg);
+void rbdSeriesResolveWorkers(void);
 
 /* Platform-generic functions */
+void *rbdSeriesGenericWorkerS1d(void *arg);
+void *rbdSeriesIdenticalWorkerS1d(void *arg);
 void rbdSeriesGenericStepS1d(struct rbdSeriesData *data, unsigned int time);
 void rbdSeriesIdenticalStepS1d(struct rbdSeriesData *data, unsigned int time);
 
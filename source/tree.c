@@ -0,0 +1,835 @@
+/*
+ *  Component: tree.c
+ *  Composite (tree of blocks) RBD management
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include "generic/rbd_internal_generic.h"
+
+#include "generic/scheduler.h"
+#include "generic/threadpool.h"
+#include "os/os.h"
+#include "bridge.h"
+#include "koon.h"
+#include "parallel.h"
+#include "series.h"
+#include "tree.h"
+
+#include <limits.h>
+#include <string.h>
+
+
+static int rbdTreeAddNode(struct rbdTree *tree, enum rbdTreeNodeType type, int *children, unsigned char numChildren);
+static unsigned int rbdTreeTileSize(struct rbdTree *tree, unsigned int numTimes);
+static void rbdTreeEvaluateTile(struct rbdTree *tree, double *output, double *scratch, unsigned int time, unsigned int numTimes, unsigned int tileSize);
+static void *rbdTreeWorker(void *arg);
+
+
+/**
+ * rbdTreeCreate
+ *
+ * Create an empty composite RBD tree
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function creates an empty composite RBD tree, i.e. a system made of nested Series,
+ *  Parallel, KooN and Bridge RBD blocks. Components and blocks are added bottom-up through
+ *  the rbdTreeAdd*() functions, the tree shall be released through rbdTreeDestroy()
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (struct rbdTree *):
+ *  != NULL in case of successful creation, NULL otherwise
+ */
+EXTERN struct rbdTree *rbdTreeCreate(void)
+{
+    struct rbdTree *tree;
+
+    /* Allocate composite RBD tree, return NULL in case of allocation failure */
+    tree = (struct rbdTree *)malloc(sizeof(struct rbdTree));
+    if (tree == NULL) {
+        return NULL;
+    }
+
+    /* Allocate initial array of nodes, return NULL in case of allocation failure */
+    tree->nodes = (struct rbdTreeNode *)malloc(sizeof(struct rbdTreeNode) * TREE_MIN_NODES);
+    if (tree->nodes == NULL) {
+        free(tree);
+        return NULL;
+    }
+    tree->numNodes = 0;
+    tree->maxNodes = TREE_MIN_NODES;
+    tree->numSlots = 0;
+
+    return tree;
+}
+
+/**
+ * rbdTreeAddComponent
+ *
+ * Add a component to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      double *reliabilities
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a component (leaf) to the composite RBD tree. The reliabilities of
+ *  the component are read by rbdTreeEvaluate(), hence they shall be available until then
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      reliabilities: this array contains the reliabilities of component at the time
+ *                      instants over which the tree shall be computed
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddComponent(struct rbdTree *tree, double *reliabilities)
+{
+    int res;
+
+    /* Is array of reliabilities invalid? */
+    if (reliabilities == NULL) {
+        return -1;
+    }
+
+    /* Add component node */
+    res = rbdTreeAddNode(tree, TREE_NODE_COMPONENT, NULL, 0);
+    if (res >= 0) {
+        tree->nodes[res].reliabilities = reliabilities;
+    }
+
+    return res;
+}
+
+/**
+ * rbdTreeAddSeries
+ *
+ * Add a generic Series RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *      unsigned char numChildren
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic Series RBD block to the composite RBD tree, whose components
+ *  are the provided nodes. Each node can be a component of a single block
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the nodes which are the components of block
+ *      numChildren: number of components in Series RBD block (N)
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddSeries(struct rbdTree *tree, int *children, unsigned char numChildren)
+{
+    /* If N is equal to 0 return -1 */
+    if (numChildren == 0) {
+        return -1;
+    }
+
+    return rbdTreeAddNode(tree, TREE_NODE_SERIES, children, numChildren);
+}
+
+/**
+ * rbdTreeAddParallel
+ *
+ * Add a generic Parallel RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *      unsigned char numChildren
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic Parallel RBD block to the composite RBD tree, whose components
+ *  are the provided nodes. Each node can be a component of a single block
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the nodes which are the components of block
+ *      numChildren: number of components in Parallel RBD block (N)
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddParallel(struct rbdTree *tree, int *children, unsigned char numChildren)
+{
+    /* If N is equal to 0 return -1 */
+    if (numChildren == 0) {
+        return -1;
+    }
+
+    return rbdTreeAddNode(tree, TREE_NODE_PARALLEL, children, numChildren);
+}
+
+/**
+ * rbdTreeAddKooN
+ *
+ * Add a generic KooN (K-out-of-N) RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *      unsigned char numChildren
+ *      unsigned char minComponents
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic KooN RBD block to the composite RBD tree, whose components
+ *  are the provided nodes. Each node can be a component of a single block.
+ *  The combinations of the KooN RBD block are prepared once, they are released by rbdTreeDestroy()
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the nodes which are the components of block
+ *      numChildren: number of components in KooN RBD block (N)
+ *      minComponents: minimum number of components required by KooN RBD block (K)
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddKooN(struct rbdTree *tree, int *children, unsigned char numChildren, unsigned char minComponents)
+{
+    struct rbdKooNGenericPrepared *koon;
+    int res;
+
+    /* If N is equal to 0 return -1 */
+    if (numChildren == 0) {
+        return -1;
+    }
+
+    /* If K is 1 then it is a Parallel block */
+    if (minComponents == 1) {
+        return rbdTreeAddNode(tree, TREE_NODE_PARALLEL, children, numChildren);
+    }
+
+    /* If K is N then it is a Series block */
+    if (minComponents == numChildren) {
+        return rbdTreeAddNode(tree, TREE_NODE_SERIES, children, numChildren);
+    }
+
+    /* If K is 0 or greater than N then the reliability of block is fixed to 1 or 0 */
+    if ((minComponents == 0) || (minComponents > numChildren)) {
+        res = rbdTreeAddNode(tree, TREE_NODE_FILL, children, numChildren);
+        if (res >= 0) {
+            tree->nodes[res].value = (minComponents == 0) ? 1.0 : 0.0;
+        }
+        return res;
+    }
+
+    /* Allocate prepared KooN RBD block, return -1 in case of allocation failure */
+    koon = (struct rbdKooNGenericPrepared *)malloc(sizeof(struct rbdKooNGenericPrepared));
+    if (koon == NULL) {
+        return -1;
+    }
+
+    /* Add KooN node and prepare its combinations */
+    res = rbdTreeAddNode(tree, TREE_NODE_KOON, children, numChildren);
+    if (res < 0) {
+        free(koon);
+        return res;
+    }
+    (void)rbdKooNGenericPrepare(&koon->data, &koon->combs, numChildren, minComponents);
+    tree->nodes[res].koon = koon;
+
+    return res;
+}
+
+/**
+ * rbdTreeAddBridge
+ *
+ * Add a generic Bridge RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic Bridge RBD block to the composite RBD tree, whose
+ *  RBD_BRIDGE_COMPONENTS components are the provided nodes. Each node can be a component
+ *  of a single block
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the RBD_BRIDGE_COMPONENTS nodes which
+ *                      are the components of block
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddBridge(struct rbdTree *tree, int *children)
+{
+    return rbdTreeAddNode(tree, TREE_NODE_BRIDGE, children, RBD_BRIDGE_COMPONENTS);
+}
+
+/**
+ * rbdTreeEvaluate
+ *
+ * Compute reliability of a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of the composite RBD tree, whose root
+ *  is its only node which is not a component of any block. The time instants are processed
+ *  in tiles: all the blocks of the tree are computed over a tile before moving to the next one,
+ *  each block writing its reliabilities into a scratch row of its parent block. The scratch
+ *  tile of each Worker fits into L2 cache, hence the reliabilities of each component are read
+ *  once and no intermediate array is written back to memory
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      output: this array contains the reliabilities of composite RBD tree computed at
+ *                      the provided time instants
+ *      numTimes: number of time instants over which composite RBD tree shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdTreeEvaluate(struct rbdTree *tree, double *output, unsigned int numTimes)
+{
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    struct rbdTreeData *data;
+    void *poolJobs;
+    void *scheduler;
+    void *tileJob;
+    double timeCost;
+    unsigned int numCores;
+    enum rbdWorkload workload;
+    unsigned char minComponents;
+    unsigned long long numCombinations;
+#else                                           /* Under single processor-single thread conditional compiling */
+    struct rbdTreeData data[1];
+    const unsigned int numCores = 1;
+#endif /* CPU_SMP */
+    double *scratch;
+    unsigned int tileSize;
+    unsigned int numRoots;
+    unsigned int idx;
+    int res;
+
+    /* Is tree invalid or empty? */
+    if ((tree == NULL) || (tree->numNodes == 0)) {
+        return -1;
+    }
+
+    /* Is the root of tree not unique? */
+    numRoots = 0;
+    for (idx = 0; idx < tree->numNodes; ++idx) {
+        if (tree->nodes[idx].parent < 0) {
+            ++numRoots;
+        }
+    }
+    if (numRoots != 1) {
+        return -1;
+    }
+
+    /* If T is equal to 0 there is nothing to compute */
+    if (numTimes == 0) {
+        return 0;
+    }
+
+    res = 0;
+
+    /* Compute the size of scratch tiles given the number of scratch rows */
+    tileSize = rbdTreeTileSize(tree, numTimes);
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Estimate the cost of each time instant as the sum of the costs of all nodes of tree */
+    timeCost = 0.0;
+    for (idx = 0; idx < tree->numNodes; ++idx) {
+        minComponents = 0;
+        numCombinations = 0;
+        switch (tree->nodes[idx].type) {
+        case TREE_NODE_SERIES:
+            workload = WORKLOAD_SERIES_GENERIC;
+            break;
+        case TREE_NODE_PARALLEL:
+            workload = WORKLOAD_PARALLEL_GENERIC;
+            break;
+        case TREE_NODE_BRIDGE:
+            workload = WORKLOAD_BRIDGE_GENERIC;
+            break;
+        case TREE_NODE_KOON:
+            workload = (tree->nodes[idx].koon->data.bDynamic != 0) ? WORKLOAD_KOON_DYNAMIC : WORKLOAD_KOON_COMBINATIONS;
+            minComponents = tree->nodes[idx].koon->data.minComponents;
+            numCombinations = tree->nodes[idx].koon->data.combEnd;
+            break;
+        case TREE_NODE_COMPONENT:
+        case TREE_NODE_FILL:
+        default:
+            workload = WORKLOAD_FILL;
+            break;
+        }
+        timeCost += computeTimeCost(workload, tree->nodes[idx].numChildren, minComponents, numCombinations);
+    }
+    /* Compute the number of used cores given the number of times and the estimated cost of each of them */
+    numCores = computeNumCores(numTimes, timeCost);
+
+    /* Allocate composite RBD tree data array, return -1 in case of allocation failure */
+    data = (struct rbdTreeData *)malloc(sizeof(struct rbdTreeData) * numCores);
+    if (data == NULL) {
+        return -1;
+    }
+#endif /* CPU_SMP */
+
+    /* Allocate scratch tiles of all Workers, return -1 in case of allocation failure */
+    scratch = NULL;
+    if (tree->numSlots > 0) {
+        scratch = (double *)allocateAlignedMemory(sizeof(double) * tree->numSlots * tileSize * numCores, CACHE_LINE_SIZE);
+        if (scratch == NULL) {
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+            free(data);
+#endif /* CPU_SMP */
+            return -1;
+        }
+    }
+
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    /* Is number of used cores greater than 1? */
+    if (numCores > 1) {
+        /* Allocate thread pool jobs array and work-stealing scheduler of time tiles, return -1 in case of allocation failure */
+        poolJobs = allocatePoolJobs(numCores - 1);
+        scheduler = allocateTileScheduler(output, numTimes, numCores, computeTileSize(numTimes, timeCost, numCores));
+        if ((poolJobs == NULL) || (scheduler == NULL)) {
+            free(poolJobs);
+            if (scheduler != NULL) {
+                freeTileScheduler(scheduler);
+            }
+            freeAlignedMemory(scratch);
+            free(data);
+            return -1;
+        }
+
+        /* For each available core... */
+        for (idx = 0; idx < (numCores - 1); ++idx) {
+            /* Prepare composite RBD tree data structure */
+            data[idx].tree = tree;
+            data[idx].output = output;
+            data[idx].scratch = (scratch != NULL) ? &scratch[tree->numSlots * tileSize * idx] : NULL;
+            data[idx].tileSize = tileSize;
+
+            /* Dispatch the composite RBD tree Worker onto thread pool, pulling time tiles from scheduler */
+            tileJob = prepareTileJob(scheduler, idx, &rbdTreeWorker, &data[idx], &data[idx].batch);
+            if (submitPoolJob(poolJobs, idx, &rbdTileWorker, tileJob) < 0) {
+                res = -1;
+            }
+        }
+
+        /* Prepare composite RBD tree data structure */
+        data[idx].tree = tree;
+        data[idx].output = output;
+        data[idx].scratch = (scratch != NULL) ? &scratch[tree->numSlots * tileSize * idx] : NULL;
+        data[idx].tileSize = tileSize;
+
+        /* Directly invoke the composite RBD tree Worker, pulling time tiles from scheduler */
+        tileJob = prepareTileJob(scheduler, idx, &rbdTreeWorker, &data[idx], &data[idx].batch);
+        (void)rbdTileWorker(tileJob);
+
+        /* Wait for dispatched jobs completion */
+        for (idx = 0; idx < (numCores - 1); ++idx) {
+            waitPoolJob(poolJobs, idx);
+        }
+        /* Free thread pool jobs array and work-stealing scheduler */
+        free(poolJobs);
+        freeTileScheduler(scheduler);
+    }
+    else {
+#endif /* CPU_SMP */
+        /* Prepare composite RBD tree data structure */
+        computeBatch(&data[0].batch, output, numTimes, 1, 0);
+        data[0].tree = tree;
+        data[0].output = output;
+        data[0].scratch = scratch;
+        data[0].tileSize = tileSize;
+
+        /* Directly invoke the composite RBD tree Worker */
+        (void)rbdTreeWorker(&data[0]);
+#if CPU_SMP != 0                                /* Under SMP conditional compiling */
+    }
+
+    /* Free composite RBD tree data array */
+    free(data);
+#endif /* CPU_SMP */
+
+    /* Free scratch tiles */
+    if (scratch != NULL) {
+        freeAlignedMemory(scratch);
+    }
+
+    return res;
+}
+
+/**
+ * rbdTreeDestroy
+ *
+ * Destroy a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the composite RBD tree created through rbdTreeCreate(), together
+ *  with the combinations prepared for its KooN RBD blocks. The reliabilities of components
+ *  are owned by user and are not released
+ *
+ * Parameters:
+ *      tree: composite RBD tree to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdTreeDestroy(struct rbdTree *tree)
+{
+    unsigned int idx;
+
+    /* Is tree invalid? */
+    if (tree == NULL) {
+        return;
+    }
+
+    /* Release the prepared KooN RBD blocks */
+    for (idx = 0; idx < tree->numNodes; ++idx) {
+        if (tree->nodes[idx].type == TREE_NODE_KOON) {
+            rbdKooNGenericRelease(&tree->nodes[idx].koon->data);
+            free(tree->nodes[idx].koon);
+        }
+    }
+
+    free(tree->nodes);
+    free(tree);
+}
+
+
+/**
+ * rbdTreeAddNode
+ *
+ * Add a node to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      enum rbdTreeNodeType type
+ *      int *children
+ *      unsigned char numChildren
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function appends a node to the composite RBD tree and makes it the parent of the
+ *  provided nodes, reserving a scratch row for each of them. Children shall be existing nodes
+ *  with no parent, hence nodes are always appended after their children and the tree can be
+ *  computed in creation order
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      type: type of added node
+ *      children: this array contains the indexes of the children of added node
+ *      numChildren: number of children of added node
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+static int rbdTreeAddNode(struct rbdTree *tree, enum rbdTreeNodeType type, int *children, unsigned char numChildren)
+{
+    struct rbdTreeNode *nodes;
+    struct rbdTreeNode *node;
+    unsigned int idx;
+    int ii;
+
+    /* Is tree or array of children invalid? */
+    if ((tree == NULL) || ((children == NULL) && (numChildren > 0))) {
+        return -1;
+    }
+
+    /* Is array of nodes full? Double its capacity, return -1 in case of overflow or allocation failure */
+    if (tree->numNodes == tree->maxNodes) {
+        if (tree->maxNodes > ((unsigned int)INT_MAX / 2)) {
+            return -1;
+        }
+        nodes = (struct rbdTreeNode *)realloc(tree->nodes, sizeof(struct rbdTreeNode) * tree->maxNodes * 2);
+        if (nodes == NULL) {
+            return -1;
+        }
+        tree->nodes = nodes;
+        tree->maxNodes *= 2;
+    }
+    idx = tree->numNodes;
+
+    /* Make added node the parent of its children, rolling back in case of invalid or already owned child */
+    for (ii = 0; ii < numChildren; ++ii) {
+        if ((children[ii] < 0) || ((unsigned int)children[ii] >= idx) || (tree->nodes[children[ii]].parent >= 0)) {
+            while (--ii >= 0) {
+                tree->nodes[children[ii]].parent = -1;
+            }
+            return -1;
+        }
+        tree->nodes[children[ii]].parent = (int)idx;
+        tree->nodes[children[ii]].childIdx = (unsigned char)ii;
+    }
+
+    /* Initialize added node, reserving a scratch row for each of its children */
+    node = &tree->nodes[idx];
+    node->type = type;
+    node->reliabilities = NULL;
+    node->koon = NULL;
+    node->value = 0.0;
+    node->parent = -1;
+    node->slot = tree->numSlots;
+    node->numChildren = numChildren;
+    node->childIdx = 0;
+
+    tree->numSlots += numChildren;
+    ++tree->numNodes;
+
+    return (int)idx;
+}
+
+/**
+ * rbdTreeTileSize
+ *
+ * Compute the size of scratch tiles of a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the number of time instants of each scratch row, so that the
+ *  whole scratch tile of a Worker fits into TREE_SCRATCH_SIZE. The size is a multiple of
+ *  the widest vector size, at least one vector and at most the (rounded up) number of times
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      numTimes: number of time instants over which composite RBD tree shall be computed (T)
+ *
+ * Return (unsigned int):
+ *  Number of time instants of each scratch row
+ */
+static unsigned int rbdTreeTileSize(struct rbdTree *tree, unsigned int numTimes)
+{
+    unsigned int tileSize;
+    unsigned int maxTileSize;
+
+    /* Fit all scratch rows into scratch tile, rounding down to a multiple of vector size */
+    tileSize = TREE_SCRATCH_SIZE / (sizeof(double) * ((tree->numSlots > 0) ? tree->numSlots : 1));
+    tileSize = (tileSize / V8D) * V8D;
+    if (tileSize < V8D) {
+        tileSize = V8D;
+    }
+
+    /* Avoid scratch rows longer than needed */
+    maxTileSize = ((numTimes / V8D) + ((numTimes % V8D) != 0)) * V8D;
+    if (tileSize > maxTileSize) {
+        tileSize = maxTileSize;
+    }
+
+    return tileSize;
+}
+
+/**
+ * rbdTreeEvaluateTile
+ *
+ * Compute reliability of a composite RBD tree over a tile of time instants
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      double *scratch
+ *      unsigned int time
+ *      unsigned int numTimes
+ *      unsigned int tileSize
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes all the nodes of the composite RBD tree over a tile of time instants
+ *  in creation order, i.e. children before their parent. Components copy their reliabilities
+ *  into the scratch row of their parent, while blocks are computed by the resolved generic
+ *  Workers reading the scratch rows of their children as a NxT matrix whose T is the tile size.
+ *  The root writes its reliabilities into output array
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      output: this array contains the reliabilities of composite RBD tree computed at
+ *                      the time instants of tile
+ *      scratch: scratch tile of Worker
+ *      time: first time instant of tile
+ *      numTimes: number of time instants of tile
+ *      tileSize: number of time instants of each row of scratch tile
+ *
+ * Return:
+ *      None
+ */
+static void rbdTreeEvaluateTile(struct rbdTree *tree, double *output, double *scratch, unsigned int time, unsigned int numTimes, unsigned int tileSize)
+{
+    struct rbdSeriesData seriesData;
+    struct rbdParallelData parallelData;
+    struct rbdBridgeData bridgeData;
+    struct rbdKooNGenericData koonData;
+    struct rbdKooNFillData fillData;
+    struct rbdTreeNode *node;
+    struct rbdBatch batch;
+    double *reliabilities;
+    double *dst;
+    unsigned int idx;
+
+    /* Each block is computed by a single Worker over all time instants of tile */
+    batch.batchIdx = 0;
+    batch.numBatches = 1;
+    batch.tBegin = 0;
+    batch.tEnd = numTimes;
+
+    /* For each node of tree, in creation order... */
+    for (idx = 0; idx < tree->numNodes; ++idx) {
+        node = &tree->nodes[idx];
+        /* Retrieve scratch rows of children and destination of node (scratch row of its parent or output) */
+        reliabilities = &scratch[(size_t)node->slot * tileSize];
+        dst = (node->parent < 0) ? output : &scratch[(size_t)(tree->nodes[node->parent].slot + node->childIdx) * tileSize];
+
+        switch (node->type) {
+        case TREE_NODE_COMPONENT:
+            /* Copy reliabilities of component */
+            memcpy(dst, &node->reliabilities[time], sizeof(double) * numTimes);
+            break;
+        case TREE_NODE_SERIES:
+            /* Directly invoke the generic Series RBD Worker */
+            seriesData.batch = batch;
+            seriesData.reliabilities = reliabilities;
+            seriesData.output = dst;
+            seriesData.numComponents = node->numChildren;
+            seriesData.numTimes = tileSize;
+            (void)(*seriesWorkers.genericWorker)(&seriesData);
+            break;
+        case TREE_NODE_PARALLEL:
+            /* Directly invoke the generic Parallel RBD Worker */
+            parallelData.batch = batch;
+            parallelData.reliabilities = reliabilities;
+            parallelData.output = dst;
+            parallelData.numComponents = node->numChildren;
+            parallelData.numTimes = tileSize;
+            (void)(*parallelWorkers.genericWorker)(&parallelData);
+            break;
+        case TREE_NODE_BRIDGE:
+            /* Directly invoke the generic Bridge RBD Worker */
+            bridgeData.batch = batch;
+            bridgeData.reliabilities = reliabilities;
+            bridgeData.output = dst;
+            bridgeData.numComponents = node->numChildren;
+            bridgeData.numTimes = tileSize;
+            (void)(*bridgeWorkers.genericWorker)(&bridgeData);
+            break;
+        case TREE_NODE_KOON:
+            /* Directly invoke the generic KooN RBD Worker, starting from prepared KooN RBD data */
+            koonData = node->koon->data;
+            koonData.batch = batch;
+            koonData.reliabilities = reliabilities;
+            koonData.output = dst;
+            koonData.numTimes = tileSize;
+            (void)(*koonWorkers.genericWorker)(&koonData);
+            break;
+        case TREE_NODE_FILL:
+        default:
+            /* Directly invoke the fill output data Worker */
+            fillData.batch = batch;
+            fillData.output = dst;
+            fillData.numTimes = numTimes;
+            fillData.value = node->value;
+            (void)(*koonWorkers.fillWorker)(&fillData);
+            break;
+        }
+    }
+}
+
+/**
+ * rbdTreeWorker
+ *
+ * Composite RBD tree Worker function
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the composite RBD tree Worker.
+ *  It is responsible to compute the reliabilities over a given batch of a composite RBD tree,
+ *  split into tiles fitting into its scratch tile
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a composite RBD tree data. It is provided
+ *                      as a void pointer to allow SMP computation of composite RBD tree
+ *
+ * Return (void *):
+ *  NULL
+ */
+static void *rbdTreeWorker(void *arg)
+{
+    struct rbdTreeData *data;
+    unsigned int time;
+    unsigned int numTimes;
+
+    data = (struct rbdTreeData *)arg;
+
+    /* For each tile of batch... */
+    for (time = data->batch.tBegin; time < data->batch.tEnd; time += numTimes) {
+        numTimes = minimum(data->tileSize, data->batch.tEnd - time);
+        /* Compute all nodes of tree over current tile */
+        rbdTreeEvaluateTile(data->tree, &data->output[time], data->scratch, time, numTimes, data->tileSize);
+    }
+
+    return NULL;
+}
@@ -0,0 +1,87 @@
+/*
+ *  Component: tree.h
+ *  Composite (tree of blocks) RBD management
+ *
+ *  librbd - Reliability Block Diagrams evaluation library
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Affero General Public License as published
+ *  by the Free Software Foundation, either version 3 of the License, or
+ *  any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU Affero General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Affero General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef TREE_H_
+#define TREE_H_
+
+
+#include "rbd.h"
+#include "generic/rbd_internal_generic.h"
+#include "koon.h"
+
+
+#define TREE_SCRATCH_SIZE           (256 * 1024)    /* Target size (in bytes) of scratch tile of each Worker, fitting into L2 cache */
+#define TREE_MIN_NODES              (16)            /* Initial capacity of nodes array of composite RBD tree */
+
+
+/**
+ * Type of node of composite RBD tree
+ */
+enum rbdTreeNodeType
+{
+    TREE_NODE_COMPONENT = 0,            /* Component (leaf), whose reliabilities are provided by user */
+    TREE_NODE_SERIES,                   /* Generic Series RBD block */
+    TREE_NODE_PARALLEL,                 /* Generic Parallel RBD block */
+    TREE_NODE_KOON,                     /* Generic KooN RBD block, with K in [2, N-1] */
+    TREE_NODE_FILL,                     /* KooN RBD block with fixed reliability, i.e. K = 0 or K > N */
+    TREE_NODE_BRIDGE                    /* Generic Bridge RBD block */
+};
+
+/**
+ * Node (component or block) of composite RBD tree
+ */
+struct rbdTreeNode
+{
+    enum rbdTreeNodeType type;              /* Type of node */
+    double *reliabilities;                  /* Array of reliabilities of component (component only) */
+    struct rbdKooNGenericPrepared *koon;    /* Prepared KooN RBD block (generic KooN only) */
+    double value;                           /* Fixed reliability of block (fill only) */
+    int parent;                             /* Index of parent block, < 0 if node has no parent yet */
+    unsigned int slot;                      /* Index of first scratch row holding the reliabilities of children */
+    unsigned char numChildren;              /* Number of children (components) of block N */
+    unsigned char childIdx;                 /* Position of node among the children of its parent block */
+};
+
+/**
+ * Composite RBD tree, whose nodes are stored in creation (bottom-up) order
+ */
+struct rbdTree
+{
+    struct rbdTreeNode *nodes;          /* Array of nodes of tree */
+    unsigned int numNodes;              /* Number of nodes of tree */
+    unsigned int maxNodes;              /* Capacity of array of nodes */
+    unsigned int numSlots;              /* Number of scratch rows, i.e. total number of children of all blocks */
+};
+
+/**
+ * Data used during composite RBD tree computation
+ */
+struct rbdTreeData
+{
+    struct rbdBatch batch;              /* Work batch (range of time instants) processed by Worker */
+    struct rbdTree *tree;               /* Composite RBD tree */
+    double *output;                     /* Array of computed reliabilities */
+    double *scratch;                    /* Scratch tile of Worker, holding a row of reliabilities for each child of each block */
+    unsigned int tileSize;              /* Number of time instants of each row of scratch tile */
+};
+
+
+#endif /* TREE_H_ */
@@ -30,100 +30,47 @@
 
 #if defined(ARCH_X86) && CPU_ENABLE_SIMD != 0
 
+
+
 /**
- * rbdBridgeGenericWorker
+ * rbdBridgeResolveWorkers
  *
- * Bridge RBD Worker function with x86 platform-specific instruction sets
+ * Resolve Bridge RBD Workers with x86 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the generic Bridge RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a Bridge RBD system
+ *  This function selects, for each Bridge RBD Worker, the implementation exploiting the widest
+ *  x86 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a Bridge RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Bridge RBD
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdBridgeGenericWorker(void *arg)
+HIDDEN void rbdBridgeResolveWorkers(void)
 {
-    struct rbdBridgeData *data;
-    unsigned int time;
-
-    /* Retrieve Bridge RBD data */
-    data = (struct rbdBridgeData *)arg;
-
+    /* Resolve generic Bridge RBD Worker */
     if (x86Sse2Supported()) {
-        return rbdBridgeGenericWorkerSse2(data);
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeGenericStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numTimes;
+    else {
+        bridgeWorkers.genericWorker = &rbdBridgeGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdBridgeIdenticalWorker
- *
- * Identical Bridge RBD Worker function with x86 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical Bridge RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of an identical Bridge RBD system
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a Bridge RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Bridge RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
-{
-    struct rbdBridgeData *data;
-    unsigned int time;
-
-    /* Retrieve Bridge RBD data */
-    data = (struct rbdBridgeData *)arg;
-
+    /* Resolve identical Bridge RBD Worker */
     if (x86Sse2Supported()) {
-        return rbdBridgeIdenticalWorkerSse2(data);
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Bridge RBD at current time instant */
-        rbdBridgeIdenticalStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        bridgeWorkers.identicalWorker = &rbdBridgeIdenticalWorkerS1d;
     }
-
-    return NULL;
 }
 
 #endif /* defined(ARCH_X86) && CPU_ENABLE_SIMD != 0 */
@@ -134,7 +81,7 @@ HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
  * Bridge RBD Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -144,30 +91,34 @@ HIDDEN void *rbdBridgeIdenticalWorker(void *arg)
  *  It is responsible to compute the reliabilities over a given batch of a Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdBridgeGenericWorkerSse2(struct rbdBridgeData *data)
+HIDDEN void *rbdBridgeGenericWorkerSse2(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
 
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepV2dSse2(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeGenericStepS1d(data, time);
     }
@@ -181,7 +132,7 @@ HIDDEN void *rbdBridgeGenericWorkerSse2(struct rbdBridgeData *data)
  * Identical Bridge RBD Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdBridgeData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -191,21 +142,25 @@ HIDDEN void *rbdBridgeGenericWorkerSse2(struct rbdBridgeData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Bridge RBD system
  *
  * Parameters:
- *      data: the pointer to a Bridge RBD data
+ *      arg: this parameter shall be the pointer to a Bridge RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdBridgeIdenticalWorkerSse2(struct rbdBridgeData *data)
+HIDDEN void *rbdBridgeIdenticalWorkerSse2(void *arg)
 {
+    struct rbdBridgeData *data;
     unsigned int time;
 
+    /* Retrieve Bridge RBD data */
+    data = (struct rbdBridgeData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Bridge RBD at current time instant */
             rbdBridgeIdenticalStepS1d(data, time);
             /* Increment current time instant */
@@ -213,17 +168,17 @@ HIDDEN void *rbdBridgeIdenticalWorkerSse2(struct rbdBridgeData *data)
         }
     }
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepV2dSse2(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Bridge RBD at current time instant */
         rbdBridgeIdenticalStepS1d(data, time);
     }
@@ -30,220 +30,63 @@
 
 #if defined(ARCH_X86) && CPU_ENABLE_SIMD != 0
 
-/**
- * rbdKooNFillWorker
- *
- * Fill output Reliability with fixed value Worker function with x86 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function fills Reliability with fixed value for KooN Worker x86 platform-specific instruction sets.
- *  It is responsible to fill a given batch of output Reliabilities with a given fixed value
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a fill KooN data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN FUNCTION_TARGET("sse2") void *rbdKooNFillWorker(void *arg)
-{
-    struct rbdKooNFillData *data;
-    unsigned int time;
 
-    /* Retrieve generic KooN RBD data */
-    data = (struct rbdKooNFillData *)arg;
-
-    if (x86Sse2Supported()) {
-        return rbdKooNGenericWorkerSse2(data);
-    }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant... */
-    while (time < data->numTimes) {
-        /* Fill output Reliability array with fixed value */
-        data->output[time] = data->value;
-        time += data->numCores;
-    }
-
-    return NULL;
-}
 
 /**
- * rbdKooNGenericWorker
+ * rbdKooNResolveWorkers
  *
- * Generic KooN RBD Worker function with x86 platform-specific instruction sets
+ * Resolve KooN RBD Workers with x86 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the generic KooN RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system
+ *  This function selects, for each KooN RBD Worker, the implementation exploiting the widest
+ *  x86 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a generic KooN RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of KooN RBD
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdKooNGenericWorker(void *arg)
+HIDDEN void rbdKooNResolveWorkers(void)
 {
-    struct rbdKooNGenericData *data;
-    unsigned int time;
-
-    /* Retrieve generic KooN RBD data */
-    data = (struct rbdKooNGenericData *)arg;
-
+    /* Resolve fill KooN output Worker */
     if (x86Sse2Supported()) {
-        return rbdKooNGenericWorkerSse2(data);
+        koonWorkers.fillWorker = &rbdKooNFillWorkerSse2;
+    }
+    else {
+        koonWorkers.fillWorker = &rbdKooNFillWorkerS1d;
     }
 
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    if (data->bRecursive == 0) {
-        /* If compute unreliability flag is not set... */
-        if (data->bComputeUnreliability == 0) {
-            /* For each time instant to be processed... */
-            while (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNGenericSuccessStepS1d(data, time);
-                /* Increment current time instant */
-                time += data->numCores;
-            }
-        }
-        else {
-            /* For each time instant to be processed... */
-            while (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNGenericFailStepS1d(data, time);
-                /* Increment current time instant */
-                time += data->numCores;
-            }
-        }
+    /* Resolve generic KooN RBD Worker */
+    if (x86Sse2Supported()) {
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerSse2;
     }
     else {
-        /* For each time instant to be processed... */
-        while (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
-            /* Increment current time instant */
-            time += data->numCores;
-        }
+        koonWorkers.genericWorker = &rbdKooNGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdKooNIdenticalWorker
- *
- * Identical KooN RBD Worker function with x86 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical KooN RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system by using
- *  previously computed nCk values
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a identical KooN RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of KooN RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdKooNIdenticalWorker(void *arg)
-{
-    struct rbdKooNIdenticalData *data;
-    unsigned int time;
-
-    /* Retrieve generic KooN RBD data */
-    data = (struct rbdKooNIdenticalData *)arg;
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-
+    /* Resolve identical KooN RBD Worker */
     if (x86Sse2Supported()) {
-        time *= V2D;
-        /* If compute unreliability flag is not set... */
-        if (data->bComputeUnreliability == 0) {
-            /* For each time instant to be processed (blocks of 2 time instants)... */
-            while ((time + V2D) <= data->numTimes) {
-                /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNIdenticalSuccessStepV2dSse2(data, time);
-                /* Increment current time instant */
-                time += (data->numCores * V2D);
-            }
-            /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from working components */
-                rbdKooNIdenticalSuccessStepS1d(data, time);
-            }
-        }
-        else {
-            /* For each time instant to be processed (blocks of 2 time instants)... */
-            while ((time + V2D) <= data->numTimes) {
-                /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNIdenticalFailStepV2dSse2(data, time);
-                /* Increment current time instant */
-                time += (data->numCores * V2D);
-            }
-            /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
-                /* Compute reliability of KooN RBD at current time instant from failed components */
-                rbdKooNIdenticalFailStepS1d(data, time);
-            }
-        }
-
-        return NULL;
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerSse2;
+    }
+    else {
+        koonWorkers.identicalWorker = &rbdKooNIdenticalWorkerS1d;
     }
 
-    /* If compute unreliability flag is not set... */
-    if (data->bComputeUnreliability == 0) {
-        /* For each time instant to be processed... */
-        while (time < data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from working components */
-            rbdKooNIdenticalSuccessStepS1d(data, time);
-            /* Increment current time instant */
-            time += data->numCores;
-        }
+    /* Resolve all KooN RBDs Worker */
+    if (x86Sse2Supported()) {
+        koonWorkers.allWorker = &rbdKooNAllWorkerSse2;
     }
     else {
-        /* For each time instant to be processed... */
-        while (time < data->numTimes) {
-            /* Compute reliability of KooN RBD at current time instant from failed components */
-            rbdKooNIdenticalFailStepS1d(data, time);
-            /* Increment current time instant */
-            time += data->numCores;
-        }
+        koonWorkers.allWorker = &rbdKooNAllWorkerS1d;
     }
-
-    return NULL;
 }
 
 
@@ -257,7 +100,7 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
  * Fill output Reliability with fixed value Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdKooNFillData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -267,33 +110,37 @@ HIDDEN void *rbdKooNIdenticalWorker(void *arg)
  *  It is responsible to fill a given batch of output Reliabilities with a given fixed value
  *
  * Parameters:
- *      data: the pointer to a fill KooN data
+ *      arg: this parameter shall be the pointer to a fill KooN data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN FUNCTION_TARGET("sse2") void *rbdKooNFillWorkerSse2(struct rbdKooNFillData *data)
+HIDDEN FUNCTION_TARGET("sse2") void *rbdKooNFillWorkerSse2(void *arg)
 {
+    struct rbdKooNFillData *data;
     unsigned int time;
     __m128d m128d;
 
+    /* Retrieve fill KooN RBD data */
+    data = (struct rbdKooNFillData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* Define vector (2d) with provided value */
     m128d = _mm_set1_pd(data->value);
 
     /* For each time instant (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Fill output Reliability array with fixed value */
         _mm_storeu_pd(&data->output[time], m128d);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Fill output Reliability array with fixed value */
         data->output[time++] = data->value;
     }
@@ -308,7 +155,7 @@ HIDDEN FUNCTION_TARGET("sse2") void *rbdKooNFillWorkerSse2(struct rbdKooNFillDat
  * Generic KooN RBD Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdKooNGenericData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -318,50 +165,54 @@ HIDDEN FUNCTION_TARGET("sse2") void *rbdKooNFillWorkerSse2(struct rbdKooNFillDat
  *  It is responsible to compute the reliabilities over a given batch of a KooN RBD system
  *
  * Parameters:
- *      data: the pointer to a generic KooN RBD data
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdKooNGenericWorkerSse2(struct rbdKooNGenericData *data)
+HIDDEN void *rbdKooNGenericWorkerSse2(void *arg)
 {
+    struct rbdKooNGenericData *data;
     unsigned int time;
 
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
-    if (data->bRecursive == 0) {
+    if (data->bDynamic == 0) {
         /* If compute unreliability flag is not set... */
         if (data->bComputeUnreliability == 0) {
             /* For each time instant to be processed (blocks of 2 time instants)... */
-            while ((time + V2D) <= data->numTimes) {
+            while ((time + V2D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepV2dSse2(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V2D);
+                time += (data->batch.numBatches * V2D);
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNGenericSuccessStepS1d(data, time);
             }
         }
         else {
             /* For each time instant to be processed (blocks of 2 time instants)... */
-            while ((time + V2D) <= data->numTimes) {
+            while ((time + V2D) <= data->batch.tEnd) {
                 /* Prefetch for next iteration */
-                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-                prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+                prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+                prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepV2dSse2(data, time);
                 /* Increment current time instant */
-                time += (data->numCores * V2D);
+                time += (data->batch.numBatches * V2D);
             }
             /* Is 1 time instant remaining? */
-            if (time < data->numTimes) {
+            if (time < data->batch.tEnd) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNGenericFailStepS1d(data, time);
             }
@@ -369,32 +220,84 @@ HIDDEN void *rbdKooNGenericWorkerSse2(struct rbdKooNGenericData *data)
     }
     else {
         /* For each time instant to be processed (blocks of 2 time instants)... */
-        while ((time + V2D) <= data->numTimes) {
+        while ((time + V2D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionV2dSse2(data, time);
+            prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepV2dSse2(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V2D);
+            time += (data->batch.numBatches * V2D);
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
-            /* Recursively compute reliability of KooN RBD at current time instant */
-            rbdKooNRecursionS1d(data, time);
+        if (time < data->batch.tEnd) {
+            /* Compute reliability of KooN RBD at current time instant through Dynamic Programming */
+            rbdKooNDynamicStepS1d(data, time);
         }
     }
 
     return NULL;
 }
 
+/**
+ * rbdKooNAllWorkerSse2
+ *
+ * All KooN RBDs Worker function with x86 SSE2 instruction set
+ *
+ * Input:
+ *      void *arg
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function implements the all KooN RBDs Worker exploiting x86 SSE2 instruction set.
+ *  It is responsible to compute the reliabilities over a given batch of the KooN RBD systems
+ *  with K in [1, N] sharing the same components
+ *
+ * Parameters:
+ *      arg: this parameter shall be the pointer to a generic KooN RBD data
+ *
+ * Return (void *):
+ *  NULL
+ */
+HIDDEN void *rbdKooNAllWorkerSse2(void *arg)
+{
+    struct rbdKooNGenericData *data;
+    unsigned int time;
+
+    /* Retrieve generic KooN RBD data */
+    data = (struct rbdKooNGenericData *)arg;
+
+    /* Retrieve first time instant to be processed by worker */
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
+
+    /* For each time instant to be processed (blocks of 2 time instants)... */
+    while ((time + V2D) <= data->batch.tEnd) {
+        /* Prefetch for next iteration */
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepV2dSse2(data, time);
+        /* Increment current time instant */
+        time += (data->batch.numBatches * V2D);
+    }
+    /* Is 1 time instant remaining? */
+    if (time < data->batch.tEnd) {
+        /* Compute reliabilities of KooN RBDs with K in [1, N] at current time instant */
+        rbdKooNAllStepS1d(data, time);
+    }
+
+    return NULL;
+}
+
 /**
  * rbdKooNIdenticalWorkerSse2
  *
  * Identical KooN RBD Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdKooNIdenticalData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -405,23 +308,27 @@ HIDDEN void *rbdKooNGenericWorkerSse2(struct rbdKooNGenericData *data)
  *  previously computed nCk values
  *
  * Parameters:
- *      data: the pointer to a identical KooN RBD data
+ *      arg: this parameter shall be the pointer to a identical KooN RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdKooNIdenticalWorkerSse2(struct rbdKooNIdenticalData *data)
+HIDDEN void *rbdKooNIdenticalWorkerSse2(void *arg)
 {
+    struct rbdKooNIdenticalData *data;
     unsigned int time;
 
+    /* Retrieve identical KooN RBD data */
+    data = (struct rbdKooNIdenticalData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* If compute unreliability flag is not set... */
     if (data->bComputeUnreliability == 0) {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from working components */
                 rbdKooNIdenticalSuccessStepS1d(data, time);
                 /* Increment current time instant */
@@ -429,17 +336,17 @@ HIDDEN void *rbdKooNIdenticalWorkerSse2(struct rbdKooNIdenticalData *data)
             }
         }
         /* For each time instant to be processed (blocks of 2 time instants)... */
-        while ((time + V2D) <= data->numTimes) {
+        while ((time + V2D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepV2dSse2(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V2D);
+            time += (data->batch.numBatches * V2D);
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from working components */
             rbdKooNIdenticalSuccessStepS1d(data, time);
         }
@@ -447,7 +354,7 @@ HIDDEN void *rbdKooNIdenticalWorkerSse2(struct rbdKooNIdenticalData *data)
     else {
         /* Align, if possible, to vector size */
         if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-            if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+            if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
                 /* Compute reliability of KooN RBD at current time instant from failed components */
                 rbdKooNIdenticalFailStepS1d(data, time);
                 /* Increment current time instant */
@@ -455,17 +362,17 @@ HIDDEN void *rbdKooNIdenticalWorkerSse2(struct rbdKooNIdenticalData *data)
             }
         }
         /* For each time instant to be processed (blocks of 2 time instants)... */
-        while ((time + V2D) <= data->numTimes) {
+        while ((time + V2D) <= data->batch.tEnd) {
             /* Prefetch for next iteration */
-            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-            prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+            prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+            prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepV2dSse2(data, time);
             /* Increment current time instant */
-            time += (data->numCores * V2D);
+            time += (data->batch.numBatches * V2D);
         }
         /* Is 1 time instant remaining? */
-        if (time < data->numTimes) {
+        if (time < data->batch.tEnd) {
             /* Compute reliability of KooN RBD at current time instant from failed components */
             rbdKooNIdenticalFailStepS1d(data, time);
         }
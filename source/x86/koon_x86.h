@@ -28,14 +28,16 @@
 
 
 #if (defined(ARCH_X86) || defined(ARCH_AMD64)) && (CPU_ENABLE_SIMD != 0)
-void *rbdKooNFillWorkerSse2(struct rbdKooNFillData *data);
-void *rbdKooNGenericWorkerSse2(struct rbdKooNGenericData *data);
-void *rbdKooNIdenticalWorkerSse2(struct rbdKooNIdenticalData *data);
+void *rbdKooNFillWorkerSse2(void *arg);
+void *rbdKooNGenericWorkerSse2(void *arg);
+void *rbdKooNIdenticalWorkerSse2(void *arg);
+void *rbdKooNAllWorkerSse2(void *arg);
 
 /* Platform-specific functions for x86 SSE2 instruction set */
 void rbdKooNGenericSuccessStepV2dSse2(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNGenericFailStepV2dSse2(struct rbdKooNGenericData *data, unsigned int time);
-void rbdKooNRecursionV2dSse2(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNDynamicStepV2dSse2(struct rbdKooNGenericData *data, unsigned int time);
+void rbdKooNAllStepV2dSse2(struct rbdKooNGenericData *data, unsigned int time);
 void rbdKooNIdenticalSuccessStepV2dSse2(struct rbdKooNIdenticalData *data, unsigned int time);
 void rbdKooNIdenticalFailStepV2dSse2(struct rbdKooNIdenticalData *data, unsigned int time);
 #endif /* (defined(ARCH_X86) || defined(ARCH_AMD64)) && (CPU_ENABLE_SIMD != 0) */
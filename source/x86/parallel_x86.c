@@ -30,100 +30,47 @@
 
 #if defined(ARCH_X86) && CPU_ENABLE_SIMD != 0
 
+
+
 /**
- * rbdParallelGenericWorker
+ * rbdParallelResolveWorkers
  *
- * Parallel RBD Worker function with x86 platform-specific instruction sets
+ * Resolve Parallel RBD Workers with x86 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the generic Parallel RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a Parallel RBD system
+ *  This function selects, for each Parallel RBD Worker, the implementation exploiting the widest
+ *  x86 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a Parallel RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Parallel RBD
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdParallelGenericWorker(void *arg)
+HIDDEN void rbdParallelResolveWorkers(void)
 {
-    struct rbdParallelData *data;
-    unsigned int time;
-
-    /* Retrieve Parallel RBD data */
-    data = (struct rbdParallelData *)arg;
-
+    /* Resolve generic Parallel RBD Worker */
     if (x86Sse2Supported()) {
-        return rbdParallelGenericWorkerSse2(data);
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelGenericStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        parallelWorkers.genericWorker = &rbdParallelGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdParallelIdenticalWorker
- *
- * Identical Parallel RBD Worker function with x86 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical Parallel RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of an identical Parallel RBD system
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a Parallel RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Parallel RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdParallelIdenticalWorker(void *arg)
-{
-    struct rbdParallelData *data;
-    unsigned int time;
-
-    /* Retrieve Parallel RBD data */
-    data = (struct rbdParallelData *)arg;
-
+    /* Resolve identical Parallel RBD Worker */
     if (x86Sse2Supported()) {
-        return rbdParallelIdenticalWorkerSse2(data);
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Parallel RBD at current time instant */
-        rbdParallelIdenticalStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        parallelWorkers.identicalWorker = &rbdParallelIdenticalWorkerS1d;
     }
-
-    return NULL;
 }
 
 #endif /* defined(ARCH_X86) && CPU_ENABLE_SIMD != 0 */
@@ -134,7 +81,7 @@ HIDDEN void *rbdParallelIdenticalWorker(void *arg)
  * Parallel RBD Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdParallelData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -144,30 +91,34 @@ HIDDEN void *rbdParallelIdenticalWorker(void *arg)
  *  It is responsible to compute the reliabilities over a given batch of a Parallel RBD system
  *
  * Parameters:
- *      data: the pointer to a Parallel RBD data
+ *      arg: this parameter shall be the pointer to a Parallel RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdParallelGenericWorkerSse2(struct rbdParallelData *data)
+HIDDEN void *rbdParallelGenericWorkerSse2(void *arg)
 {
+    struct rbdParallelData *data;
     unsigned int time;
 
+    /* Retrieve Parallel RBD data */
+    data = (struct rbdParallelData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepV2dSse2(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelGenericStepS1d(data, time);
     }
@@ -181,7 +132,7 @@ HIDDEN void *rbdParallelGenericWorkerSse2(struct rbdParallelData *data)
  * Identical Parallel RBD Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdParallelData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -191,21 +142,25 @@ HIDDEN void *rbdParallelGenericWorkerSse2(struct rbdParallelData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Parallel RBD system
  *
  * Parameters:
- *      data: the pointer to a Parallel RBD data
+ *      arg: this parameter shall be the pointer to a Parallel RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdParallelIdenticalWorkerSse2(struct rbdParallelData *data)
+HIDDEN void *rbdParallelIdenticalWorkerSse2(void *arg)
 {
+    struct rbdParallelData *data;
     unsigned int time;
 
+    /* Retrieve Parallel RBD data */
+    data = (struct rbdParallelData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Parallel RBD at current time instant */
             rbdParallelIdenticalStepS1d(data, time);
             /* Increment current time instant */
@@ -213,17 +168,17 @@ HIDDEN void *rbdParallelIdenticalWorkerSse2(struct rbdParallelData *data)
         }
     }
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepV2dSse2(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Parallel RBD at current time instant */
         rbdParallelIdenticalStepS1d(data, time);
     }
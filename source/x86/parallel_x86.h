@@ -28,8 +28,8 @@
 
 
 #if (defined(ARCH_X86) || defined(ARCH_AMD64)) && (CPU_ENABLE_SIMD != 0)
-void *rbdParallelGenericWorkerSse2(struct rbdParallelData *data);
-void *rbdParallelIdenticalWorkerSse2(struct rbdParallelData *data);
+void *rbdParallelGenericWorkerSse2(void *arg);
+void *rbdParallelIdenticalWorkerSse2(void *arg);
 
 /* Platform-specific functions for x86 SSE2 instruction set */
 void rbdParallelGenericStepV2dSse2(struct rbdParallelData *data, unsigned int time);
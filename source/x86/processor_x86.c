@@ -46,7 +46,8 @@ static struct x86Cpu x86Cpu;
  *      None
  *
  * Description:
- *  This function retrieves the availability of SSE2 instruction set
+ *  This function retrieves the availability of SSE2 instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
@@ -59,8 +60,8 @@ HIDDEN unsigned int x86Sse2Supported(void)
     /* Get CPU-specific information */
     getCpuInfo();
 
-    /* Return x86 SSE2 instruction set supported by the system */
-    return x86Cpu.sse2Supported;
+    /* Return x86 SSE2 instruction set supported by the system and enabled */
+    return (x86Cpu.sse2Supported != 0) && (isaEnabled(RBD_ISA_SSE2) != 0);
 }
 
 /**
@@ -91,6 +92,8 @@ HIDDEN void retrieveX86CpuInfo(void)
      * - no SSE2
      */
     x86Cpu.sse2Supported = 0;
+    /* Initialize CPU features detection, required when invoked from library constructors */
+    __builtin_cpu_init();
     if (__builtin_cpu_supports("sse2") > 0) {
         x86Cpu.sse2Supported = 1;
     }
@@ -53,7 +53,8 @@ FUNCTION_TARGET("sse2") __m128d capReliabilityV2dSse2(__m128d v2dR);
  *      None
  *
  * Description:
- *  This function retrieves the availability of SSE2 instruction set
+ *  This function retrieves the availability of SSE2 instruction set,
+ *  unless it is excluded by the requested instruction set family
  *
  * Parameters:
  *      None
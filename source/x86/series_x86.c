@@ -30,100 +30,47 @@
 
 #if defined(ARCH_X86) && CPU_ENABLE_SIMD != 0
 
+
+
 /**
- * rbdSeriesGenericWorker
+ * rbdSeriesResolveWorkers
  *
- * Generic Series RBD Worker function with x86 platform-specific instruction sets
+ * Resolve Series RBD Workers with x86 platform-specific instruction sets
  *
  * Input:
- *      void *arg
+ *      None
  *
  * Output:
  *      None
  *
  * Description:
- *  This function implements the generic Series RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of a generic Series RBD system
+ *  This function selects, for each Series RBD Worker, the implementation exploiting the widest
+ *  x86 instruction set supported by the processor. It is invoked once at library load time,
+ *  so that RBD computations directly invoke the selected Workers
  *
  * Parameters:
- *      arg: this parameter shall be the pointer to a Series RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Series RBD
+ *      None
  *
- * Return (void *):
- *  NULL
+ * Return:
+ *      None
  */
-HIDDEN void *rbdSeriesGenericWorker(void *arg)
+HIDDEN void rbdSeriesResolveWorkers(void)
 {
-    struct rbdSeriesData *data;
-    unsigned int time;
-
-    /* Retrieve Series RBD data */
-    data = (struct rbdSeriesData *)arg;
-
+    /* Resolve generic Series RBD Worker */
     if (x86Sse2Supported()) {
-        return rbdSeriesGenericWorkerSse2(data);
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesGenericStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numTimes;
+    else {
+        seriesWorkers.genericWorker = &rbdSeriesGenericWorkerS1d;
     }
 
-    return NULL;
-}
-
-/**
- * rbdSeriesIdenticalWorker
- *
- * Identical Series RBD Worker function with x86 platform-specific instruction sets
- *
- * Input:
- *      void *arg
- *
- * Output:
- *      None
- *
- * Description:
- *  This function implements the identical Series RBD Worker exploiting x86 platform-specific instruction sets.
- *  It is responsible to compute the reliabilities over a given batch of an identical Series RBD system
- *
- * Parameters:
- *      arg: this parameter shall be the pointer to a Series RBD data. It is provided as a
- *                      void * in order to be compliant with pthread_create API and to thus allow
- *                      SMP computation of Series RBD
- *
- * Return (void *):
- *  NULL
- */
-HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
-{
-    struct rbdSeriesData *data;
-    unsigned int time;
-
-    /* Retrieve Series RBD data */
-    data = (struct rbdSeriesData *)arg;
-
+    /* Resolve identical Series RBD Worker */
     if (x86Sse2Supported()) {
-        return rbdSeriesIdenticalWorkerSse2(data);
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerSse2;
     }
-
-    /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx;
-    /* For each time instant to be processed... */
-    while (time < data->numTimes) {
-        /* Compute reliability of Series RBD at current time instant */
-        rbdSeriesIdenticalStepS1d(data, time);
-        /* Increment current time instant */
-        time += data->numCores;
+    else {
+        seriesWorkers.identicalWorker = &rbdSeriesIdenticalWorkerS1d;
     }
-
-    return NULL;
 }
 
 #endif /* defined(ARCH_X86) && CPU_ENABLE_SIMD != 0 */
@@ -134,7 +81,7 @@ HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
  * Generic Series RBD Worker function with x86 SSE2 instruction set
  *
  * Input:
- *      struct rbdSeriesData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -144,30 +91,34 @@ HIDDEN void *rbdSeriesIdenticalWorker(void *arg)
  *  It is responsible to compute the reliabilities over a given batch of a generic Series RBD system
  *
  * Parameters:
- *      data: the pointer to a Series RBD data
+ *      arg: this parameter shall be the pointer to a Series RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdSeriesGenericWorkerSse2(struct rbdSeriesData *data)
+HIDDEN void *rbdSeriesGenericWorkerSse2(void *arg)
 {
+    struct rbdSeriesData *data;
     unsigned int time;
 
+    /* Retrieve Series RBD data */
+    data = (struct rbdSeriesData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, data->numComponents, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepV2dSse2(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesGenericStepS1d(data, time);
     }
@@ -181,7 +132,7 @@ HIDDEN void *rbdSeriesGenericWorkerSse2(struct rbdSeriesData *data)
  * Identical Series RBD Worker function with x86 platform-specific instruction sets
  *
  * Input:
- *      struct rbdSeriesData *data
+ *      void *arg
  *
  * Output:
  *      None
@@ -191,21 +142,25 @@ HIDDEN void *rbdSeriesGenericWorkerSse2(struct rbdSeriesData *data)
  *  It is responsible to compute the reliabilities over a given batch of an identical Series RBD system
  *
  * Parameters:
- *      data: the pointer to a Series RBD data
+ *      arg: this parameter shall be the pointer to a Series RBD data
  *
  * Return (void *):
  *  NULL
  */
-HIDDEN void *rbdSeriesIdenticalWorkerSse2(struct rbdSeriesData *data)
+HIDDEN void *rbdSeriesIdenticalWorkerSse2(void *arg)
 {
+    struct rbdSeriesData *data;
     unsigned int time;
 
+    /* Retrieve Series RBD data */
+    data = (struct rbdSeriesData *)arg;
+
     /* Retrieve first time instant to be processed by worker */
-    time = data->batchIdx * V2D;
+    time = data->batch.tBegin + (data->batch.batchIdx * V2D);
 
     /* Align, if possible, to vector size */
     if (((long)&data->reliabilities[time] & (S1D * sizeof(double) - 1)) == 0) {
-        if (((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) {
+        if ((((long)&data->reliabilities[time] & (V2D * sizeof(double) - 1)) != 0) && ((time + S1D) <= data->batch.tEnd)) {
             /* Compute reliability of Series RBD at current time instant */
             rbdSeriesIdenticalStepS1d(data, time);
             /* Increment current time instant */
@@ -213,17 +168,17 @@ HIDDEN void *rbdSeriesIdenticalWorkerSse2(struct rbdSeriesData *data)
         }
     }
     /* For each time instant to be processed (blocks of 2 time instants)... */
-    while ((time + V2D) <= data->numTimes) {
+    while ((time + V2D) <= data->batch.tEnd) {
         /* Prefetch for next iteration */
-        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->numCores * V2D));
-        prefetchWrite(data->output, 1, data->numTimes, time + (data->numCores * V2D));
+        prefetchRead(data->reliabilities, 1, data->numTimes, time + (data->batch.numBatches * V2D));
+        prefetchWrite(data->output, 1, data->numTimes, time + (data->batch.numBatches * V2D));
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepV2dSse2(data, time);
         /* Increment current time instant */
-        time += (data->numCores * V2D);
+        time += (data->batch.numBatches * V2D);
     }
     /* Is 1 time instant remaining? */
-    if (time < data->numTimes) {
+    if (time < data->batch.tEnd) {
         /* Compute reliability of Series RBD at current time instant */
         rbdSeriesIdenticalStepS1d(data, time);
     }
@@ -83,7 +83,8 @@ HIDDEN FUNCTION_TARGET("sse2") void rbdParallelGenericStepV2dSse2(struct rbdPara
  * Description:
  *  This function implements the identical Parallel RBD step exploiting x86 SSE2 128bit.
  *  It is responsible to compute the reliability of a Parallel block with identical components
- *  given their reliability
+ *  given their reliability. The power of the unreliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Parallel RBD data structure
@@ -91,7 +92,7 @@ HIDDEN FUNCTION_TARGET("sse2") void rbdParallelGenericStepV2dSse2(struct rbdPara
  */
 HIDDEN FUNCTION_TARGET("sse2") void rbdParallelIdenticalStepV2dSse2(struct rbdParallelData *data, unsigned int time)
 {
-    unsigned char component;
+    unsigned char bit;
     __m128d v2dU;
     __m128d v2dRes;
 
@@ -99,10 +100,18 @@ HIDDEN FUNCTION_TARGET("sse2") void rbdParallelIdenticalStepV2dSse2(struct rbdPa
     v2dU = _mm_loadu_pd(&data->reliabilities[time]);
     v2dU = _mm_sub_pd(v2dOnes, v2dU);
 
-    /* Compute reliability of Parallel RBD at current time instant */
+    /* Compute reliability of Parallel RBD at current time instant through exponentiation by squaring */
     v2dRes = v2dU;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        v2dRes = _mm_mul_pd(v2dRes, v2dU);
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        v2dRes = _mm_mul_pd(v2dRes, v2dRes);
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            v2dRes = _mm_mul_pd(v2dRes, v2dU);
+        }
     }
     v2dRes = _mm_sub_pd(v2dOnes, v2dRes);
 
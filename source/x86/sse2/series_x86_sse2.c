@@ -80,7 +80,8 @@ HIDDEN FUNCTION_TARGET("sse2") void rbdSeriesGenericStepV2dSse2(struct rbdSeries
  * Description:
  *  This function implements the identical Series RBD step exploiting x86 SSE2 128bit.
  *  It is responsible to compute the reliability of a Series block with identical components
- *  given their reliability
+ *  given their reliability. The power of the reliability of components is computed through
+ *  exponentiation by squaring, requiring O(log N) dependent products
  *
  * Parameters:
  *      data: Series RBD data structure
@@ -88,17 +89,25 @@ HIDDEN FUNCTION_TARGET("sse2") void rbdSeriesGenericStepV2dSse2(struct rbdSeries
  */
 HIDDEN FUNCTION_TARGET("sse2") void rbdSeriesIdenticalStepV2dSse2(struct rbdSeriesData *data, unsigned int time)
 {
-    unsigned char component;
+    unsigned char bit;
     __m128d v2dTmp;
     __m128d v2dRes;
 
     /* Load reliability */
     v2dTmp = _mm_loadu_pd(&data->reliabilities[time]);
 
-    /* Compute reliability of Series RBD at current time instant */
+    /* Compute reliability of Series RBD at current time instant through exponentiation by squaring */
     v2dRes = v2dTmp;
-    for (component = (data->numComponents - 1); component > 0; --component) {
-        v2dRes = _mm_mul_pd(v2dRes, v2dTmp);
+    /* Search for most significant bit of number of components */
+    for (bit = 0x80; (data->numComponents & bit) == 0; bit >>= 1);
+    /* For each following bit of number of components... */
+    for (bit >>= 1; bit != 0; bit >>= 1) {
+        /* Square partial power */
+        v2dRes = _mm_mul_pd(v2dRes, v2dRes);
+        /* Multiply partial power by base when current bit is set */
+        if ((data->numComponents & bit) != 0) {
+            v2dRes = _mm_mul_pd(v2dRes, v2dTmp);
+        }
     }
 
     /* Cap the computed reliability and set it into output array */
@@ -11,6 +11,8 @@
 #include <string.h>
 #include <time.h>
 #include <limits.h>
+#include <stdint.h>
+#include <pthread.h>
 
 #include <math.h>
 
@@ -21,6 +23,12 @@
 #define KOON_COMPARISON_N       20
 #define KOON_COMPARISON_TESTS   (KOON_COMPARISON_N+2)
 
+#define CHECK_TOLERANCE         1e-12
+#define CHECK_COMPONENTS        10
+#define CHECK_ALIGNMENT         64
+#define CHECK_PADDING           8
+#define CHECK_CACHE_SIZE        (1024 * 1024)
+
 
 typedef struct rdbDimension
 {
@@ -39,6 +47,30 @@ typedef struct resultExperiment
 } resultExperiment;
 
 
+typedef struct checkData
+{
+    const rbdDim *dim;                  /* Dimension of checked RBD system */
+    unsigned char minComponents;        /* Minimum number of components of KooN RBD systems */
+    double *relMat;                     /* Reliabilities of components, exp(-lambda*t) */
+    double *lambda;                     /* Failure rates of components */
+    double *expected;                   /* Reference results */
+    double *output;                     /* Checked results */
+    void *ctx;                          /* Context of check */
+} checkData;
+
+
+typedef int (*fpCheck)(checkData *data);
+typedef void (*fpCheckHook)(void *ctx);
+
+
+typedef struct checkKooN
+{
+    fpCheckHook fpSetup;                /* Setup invoked before computing the checked results, can be NULL */
+    fpCheckHook fpTeardown;             /* Teardown invoked after computing the checked results, can be NULL */
+    void *ctx;                          /* Context of setup and teardown */
+} checkKooN;
+
+
 static const rbdDim rbdTests[] = {
         {5, 1}, {5, 2}, {5, 3}, {5, 4}, {5, 7}, {5, 10},
         {2, 1000}, {2, 1537}, {2, 5000}, {2, 10000}, {2, 20000}, {2, 50000},
@@ -72,8 +104,44 @@ static const rbdDim rbdBridgeTests[] = {
 static const rbdDim rbdKooNDimComparison = {KOON_COMPARISON_N, 200000};
 
 
+static const rbdDim rbdCheckTests[] = {
+        {5, 1}, {5, 7}, {3, 1537}, {7, 50003}, {12, 10000}
+};
+
+
+static const rbdDim rbdCompositeChecks[] = {
+        {CHECK_COMPONENTS, 1}, {CHECK_COMPONENTS, 7}, {CHECK_COMPONENTS, 1537}, {CHECK_COMPONENTS, 50003}, {CHECK_COMPONENTS, 10000}
+};
+
+
+static const rbdDim rbdBridgeChecks[] = {
+        {5, 1}, {5, 7}, {5, 1537}, {5, 50003}, {5, 10000}
+};
+
+
+static const rbdDim rbdLanesChecks[] = {
+        {20, 1}, {20, 2}, {20, 3}
+};
+
+
+static const rbdDim rbdSplitChecks[] = {
+        {254, 5}
+};
+
+
+static const rbdDim rbdIdenticalChecks[] = {
+        {100, 100000}, {255, 100000}
+};
+
+
 #define NUM_EXPERIMENTS                 ((sizeof(rbdTests) / sizeof(rbdDim)))
 #define NUM_BRIDGE_EXPERIMENTS          ((sizeof(rbdBridgeTests) / sizeof(rbdDim)))
+#define NUM_CHECKS                      ((sizeof(rbdCheckTests) / sizeof(rbdDim)))
+#define NUM_COMPOSITE_CHECKS            ((sizeof(rbdCompositeChecks) / sizeof(rbdDim)))
+#define NUM_BRIDGE_CHECKS               ((sizeof(rbdBridgeChecks) / sizeof(rbdDim)))
+#define NUM_LANES_CHECKS                ((sizeof(rbdLanesChecks) / sizeof(rbdDim)))
+#define NUM_SPLIT_CHECKS                ((sizeof(rbdSplitChecks) / sizeof(rbdDim)))
+#define NUM_IDENTICAL_CHECKS            ((sizeof(rbdIdenticalChecks) / sizeof(rbdDim)))
 
 
 static resultExperiment resultSeriesGeneric[NUM_EXPERIMENTS];
@@ -171,6 +239,752 @@ static void printLog(char * fname, double * reliability, unsigned int numTimes)
 }
 
 
+static void fillReliabilities(double *relMat, double *lambda, unsigned char numComponents, unsigned int numTimes)
+{
+    double rate;
+    unsigned int ii;
+    int kk;
+
+    srand(0);
+    for (kk = 0; kk < numComponents; kk++) {
+        rate = ((double)rand() / (double)RAND_MAX) / 100000.0;
+        if (lambda != NULL) {
+            lambda[kk] = rate;
+        }
+        for (ii = 0; ii < numTimes; ii++) {
+            relMat[ii + kk * numTimes] = exp((0.0 - rate) * (double)ii);
+        }
+    }
+}
+
+
+static int checkOutput(const char *name, const rbdDim *dim, double *expected, double *output)
+{
+    unsigned int ii;
+    unsigned int mismatches;
+
+    mismatches = 0;
+    for (ii = 0; ii < dim->numTimes; ii++) {
+        if (!(fabs(expected[ii] - output[ii]) <= CHECK_TOLERANCE)) {
+            ++mismatches;
+        }
+    }
+
+    if (mismatches != 0) {
+        printf("Check %s - Components %d, times %d: FAILED (%u mismatches)\n", name, dim->numComponents, dim->numTimes, mismatches);
+        return 1;
+    }
+    printf("Check %s - Components %d, times %d: OK\n", name, dim->numComponents, dim->numTimes);
+    return 0;
+}
+
+
+static int checkAgainstReference(const char *name, const rbdDim *dims, int numDims, unsigned char minComponents, fpCheck fpReference, fpCheck fpCompute, void *ctx)
+{
+    checkData data;
+    int failures;
+    int res;
+    int ii;
+
+    failures = 0;
+    for(ii = 0; ii < numDims; ++ii) {
+        data.dim = &dims[ii];
+        data.minComponents = minComponents;
+        if (minComponents == 0) {
+            /* Majority voting KooN RBD systems by default */
+            data.minComponents = (dims[ii].numComponents / 2) + (dims[ii].numComponents & 1);
+        }
+        data.relMat = (double *)malloc(sizeof(double) * dims[ii].numComponents * dims[ii].numTimes);
+        data.lambda = (double *)malloc(sizeof(double) * dims[ii].numComponents);
+        data.expected = (double *)malloc(sizeof(double) * dims[ii].numTimes);
+        data.output = (double *)malloc(sizeof(double) * dims[ii].numTimes);
+        data.ctx = ctx;
+
+        fillReliabilities(data.relMat, data.lambda, dims[ii].numComponents, dims[ii].numTimes);
+        res = fpReference(&data);
+        if (res >= 0) {
+            res = fpCompute(&data);
+        }
+        if (res < 0) {
+            printf("Check %s - Components %d, times %d: FAILED (error)\n", name, dims[ii].numComponents, dims[ii].numTimes);
+            ++failures;
+        }
+        else {
+            failures += checkOutput(name, &dims[ii], data.expected, data.output);
+        }
+
+        free(data.relMat);
+        free(data.lambda);
+        free(data.expected);
+        free(data.output);
+    }
+
+    return failures;
+}
+
+
+static int referenceKooN(checkData *data)
+{
+    return rbdKooNGeneric(data->relMat, data->expected, data->dim->numComponents, data->minComponents, data->dim->numTimes);
+}
+
+
+static int computeKooN(checkData *data)
+{
+    checkKooN *check;
+    int res;
+
+    check = (checkKooN *)data->ctx;
+    if (check->fpSetup != NULL) {
+        check->fpSetup(check->ctx);
+    }
+    res = rbdKooNGeneric(data->relMat, data->output, data->dim->numComponents, data->minComponents, data->dim->numTimes);
+    if (check->fpTeardown != NULL) {
+        check->fpTeardown(check->ctx);
+    }
+
+    return res;
+}
+
+
+static int checkKooNAgainstReference(const char *name, const rbdDim *dims, int numDims, unsigned char minComponents, fpCheckHook fpSetup, fpCheckHook fpTeardown, void *ctx)
+{
+    checkKooN check;
+
+    /* Generic KooN RBD systems computed between setup and teardown shall match the ones computed by default */
+    check.fpSetup = fpSetup;
+    check.fpTeardown = fpTeardown;
+    check.ctx = ctx;
+
+    return checkAgainstReference(name, dims, numDims, minComponents, &referenceKooN, &computeKooN, &check);
+}
+
+
+static int checkAllocMatrix(void)
+{
+    double *matrix;
+    unsigned int ld;
+    unsigned int ii;
+    unsigned int mismatches;
+    int failures;
+    int kk, jj;
+
+    failures = 0;
+    for(jj = 0; jj < NUM_CHECKS; ++jj) {
+        matrix = rbdAllocMatrix(rbdCheckTests[jj].numComponents, rbdCheckTests[jj].numTimes, &ld);
+        if (matrix == NULL) {
+            printf("Check alloc matrix - Components %d, times %d: FAILED (NULL)\n", rbdCheckTests[jj].numComponents, rbdCheckTests[jj].numTimes);
+            ++failures;
+            continue;
+        }
+
+        /* Matrix shall be aligned, padded to the widest vector size and zeroed, padding included */
+        mismatches = 0;
+        if (((uintptr_t)matrix % CHECK_ALIGNMENT) != 0) {
+            ++mismatches;
+        }
+        if ((ld < rbdCheckTests[jj].numTimes) || ((ld % CHECK_PADDING) != 0)) {
+            ++mismatches;
+        }
+        for (kk = 0; kk < rbdCheckTests[jj].numComponents; kk++) {
+            for (ii = 0; ii < ld; ii++) {
+                if (matrix[ii + kk * ld] != 0.0) {
+                    ++mismatches;
+                }
+            }
+        }
+        rbdFree(matrix);
+
+        if (mismatches != 0) {
+            printf("Check alloc matrix - Components %d, times %d: FAILED (%u mismatches)\n", rbdCheckTests[jj].numComponents, rbdCheckTests[jj].numTimes, mismatches);
+            ++failures;
+        }
+        else {
+            printf("Check alloc matrix - Components %d, times %d: OK\n", rbdCheckTests[jj].numComponents, rbdCheckTests[jj].numTimes);
+        }
+    }
+
+    /* Invalid dimensions shall be rejected, releasing NULL shall be harmless */
+    if ((rbdAllocMatrix(0, 1, &ld) != NULL) || (rbdAllocMatrix(1, 0, &ld) != NULL) ||
+        (rbdAllocMatrix(1, UINT_MAX, &ld) != NULL) || (rbdAllocMatrix(1, 1, NULL) != NULL)) {
+        printf("Check alloc matrix - invalid dimensions: FAILED (accepted)\n");
+        ++failures;
+    }
+    rbdFree(NULL);
+
+    return failures;
+}
+
+
+static int checkKooNAll(void)
+{
+    double *relMat;
+    double *outMat;
+    double *output;
+    char name[64];
+    int failures;
+    int ii, kk;
+
+    failures = 0;
+    for(ii = 0; ii < NUM_CHECKS; ++ii) {
+        relMat = (double *)malloc(sizeof(double) * rbdCheckTests[ii].numComponents * rbdCheckTests[ii].numTimes);
+        outMat = (double *)malloc(sizeof(double) * rbdCheckTests[ii].numComponents * rbdCheckTests[ii].numTimes);
+        output = (double *)malloc(sizeof(double) * rbdCheckTests[ii].numTimes);
+
+        fillReliabilities(relMat, NULL, rbdCheckTests[ii].numComponents, rbdCheckTests[ii].numTimes);
+        if (rbdKooNAllGeneric(relMat, outMat, rbdCheckTests[ii].numComponents, rbdCheckTests[ii].numTimes) < 0) {
+            printf("Check KooN all - Components %d, times %d: FAILED (error)\n", rbdCheckTests[ii].numComponents, rbdCheckTests[ii].numTimes);
+            ++failures;
+        }
+        else {
+            /* Row k-1 shall match the generic KooN RBD system with K=k */
+            for (kk = 1; kk <= rbdCheckTests[ii].numComponents; kk++) {
+                rbdKooNGeneric(relMat, output, rbdCheckTests[ii].numComponents, kk, rbdCheckTests[ii].numTimes);
+                snprintf(name, sizeof(name), "KooN all %doo%d", kk, rbdCheckTests[ii].numComponents);
+                failures += checkOutput(name, &rbdCheckTests[ii], output, &outMat[(kk - 1) * rbdCheckTests[ii].numTimes]);
+            }
+        }
+
+        free(relMat);
+        free(outMat);
+        free(output);
+    }
+
+    return failures;
+}
+
+
+static int executorSubmit(void *ctx, void *(*fn)(void *), void *arg, void **handle)
+{
+    pthread_t *thread;
+
+    thread = (pthread_t *)malloc(sizeof(pthread_t));
+    if (thread == NULL) {
+        return -1;
+    }
+    if (pthread_create(thread, NULL, fn, arg) != 0) {
+        free(thread);
+        return -1;
+    }
+    ++*(unsigned int *)ctx;
+    *handle = thread;
+
+    return 0;
+}
+
+
+static void executorWait(void *ctx, void *handle)
+{
+    (void)ctx;
+    pthread_join(*(pthread_t *)handle, NULL);
+    free(handle);
+}
+
+
+static void computeLargeKooN(void)
+{
+    double *relMat;
+    double *output;
+
+    relMat = (double *)malloc(sizeof(double) * CHECK_COMPONENTS * 200000);
+    output = (double *)malloc(sizeof(double) * 200000);
+
+    /* KooN RBD system large enough to be computed by all available cores */
+    fillReliabilities(relMat, NULL, CHECK_COMPONENTS, 200000);
+    rbdKooNGeneric(relMat, output, CHECK_COMPONENTS, CHECK_COMPONENTS / 2, 200000);
+
+    free(relMat);
+    free(output);
+}
+
+
+static unsigned int countJobs(void)
+{
+    unsigned int numJobs;
+
+    /* Count the jobs submitted to the executor by a large KooN RBD system */
+    numJobs = 0;
+    rbdSetExecutor(&executorSubmit, &executorWait, &numJobs);
+    computeLargeKooN();
+    rbdSetExecutor(NULL, NULL, NULL);
+
+    return numJobs;
+}
+
+
+static unsigned int countPoolThreads(void)
+{
+    FILE *pFile;
+    char line[128];
+    unsigned int numThreads;
+
+    /* Let the built-in pool be created by a large KooN RBD system */
+    computeLargeKooN();
+
+    /* Count the threads of the process other than the calling one, 0 if they cannot be counted */
+    numThreads = 0;
+    pFile = fopen("/proc/self/status", "r");
+    if (pFile != NULL) {
+        while (fgets(line, sizeof(line), pFile) != NULL) {
+            if (sscanf(line, "Threads: %u", &numThreads) == 1) {
+                break;
+            }
+        }
+        fclose(pFile);
+    }
+
+    return (numThreads > 0) ? (numThreads - 1) : 0;
+}
+
+
+static void setupMaxThreads(void *ctx)
+{
+    rbdSetMaxThreads(*(unsigned int *)ctx);
+}
+
+
+static void teardownMaxThreads(void *ctx)
+{
+    (void)ctx;
+    rbdSetMaxThreads(0);
+}
+
+
+static int checkMaxThreads(void)
+{
+    unsigned int maxThreads;
+    unsigned int numJobs;
+    int failures;
+
+    failures = 0;
+    /* The cap shall limit the number of jobs submitted to the executor, which cannot be observed without a second core */
+    if (countPoolThreads() == 0) {
+        printf("Check max threads - jobs: SKIPPED (single core)\n");
+    }
+    else {
+        rbdSetMaxThreads(1);
+        numJobs = countJobs();
+        rbdSetMaxThreads(2);
+        numJobs += 10 * countJobs();
+        rbdSetMaxThreads(0);
+        if ((numJobs != 10) || (countJobs() == 0)) {
+            printf("Check max threads - jobs: FAILED (%u)\n", numJobs);
+            ++failures;
+        }
+        else {
+            printf("Check max threads - jobs: OK\n");
+        }
+    }
+
+    /* A single thread shall compute the same results */
+    maxThreads = 1;
+    failures += checkKooNAgainstReference("max threads", rbdCheckTests, NUM_CHECKS, 0, &setupMaxThreads, &teardownMaxThreads, &maxThreads);
+
+    return failures;
+}
+
+
+static int checkKooNSplit(void)
+{
+    unsigned int maxThreads;
+    int failures;
+
+    failures = 0;
+    /* Few time instants and tens of thousands of combinations (32386 for 252oo254 and 3oo254) split combinations among cores */
+    if (countPoolThreads() == 0) {
+        printf("Check KooN split: SKIPPED (single core)\n");
+        return failures;
+    }
+
+    /* A single thread, computing all combinations, shall compute the same results */
+    maxThreads = 1;
+    failures += checkKooNAgainstReference("KooN split 252oo254", rbdSplitChecks, NUM_SPLIT_CHECKS, 252, &setupMaxThreads, &teardownMaxThreads, &maxThreads);
+    failures += checkKooNAgainstReference("KooN split 3oo254", rbdSplitChecks, NUM_SPLIT_CHECKS, 3, &setupMaxThreads, &teardownMaxThreads, &maxThreads);
+
+    return failures;
+}
+
+
+static void setupExecutor(void *ctx)
+{
+    *(unsigned int *)ctx = 0;
+    rbdSetExecutor(&executorSubmit, &executorWait, ctx);
+}
+
+
+static void teardownExecutor(void *ctx)
+{
+    (void)ctx;
+    rbdSetExecutor(NULL, NULL, NULL);
+}
+
+
+static int checkExecutor(void)
+{
+    unsigned int numJobs;
+    int failures;
+
+    failures = 0;
+    /* Providing a single callback shall be rejected */
+    if (rbdSetExecutor(&executorSubmit, NULL, &numJobs) >= 0) {
+        printf("Check executor - single callback: FAILED (accepted)\n");
+        ++failures;
+    }
+
+    /* Jobs shall be submitted to the executor whenever the built-in pool would otherwise run them */
+    if (countPoolThreads() == 0) {
+        printf("Check executor - jobs: SKIPPED (single core)\n");
+    }
+    else if (countJobs() == 0) {
+        printf("Check executor - jobs: FAILED (executor not used)\n");
+        ++failures;
+    }
+    else {
+        printf("Check executor - jobs: OK\n");
+    }
+
+    /* Jobs run on application threads shall compute the same results */
+    failures += checkKooNAgainstReference("executor", rbdCheckTests, NUM_CHECKS, 0, &setupExecutor, &teardownExecutor, &numJobs);
+
+    return failures;
+}
+
+
+static void setupIsa(void *ctx)
+{
+    rbdSetIsa(*(enum rbdIsa *)ctx);
+}
+
+
+static void teardownIsa(void *ctx)
+{
+    (void)ctx;
+    rbdSetIsa(RBD_ISA_AUTO);
+}
+
+
+static int checkIsa(void)
+{
+    enum rbdIsa isa;
+    char name[64];
+    int failures;
+    int ii;
+
+    failures = 0;
+    /* The scalar instruction set family shall be available on every platform */
+    if ((rbdSetIsa(RBD_ISA_SCALAR) < 0) || (rbdGetIsa() != RBD_ISA_SCALAR)) {
+        printf("Check ISA - scalar: FAILED (not selected)\n");
+        ++failures;
+    }
+    rbdSetIsa(RBD_ISA_AUTO);
+
+    /* Each instruction set family available on current platform shall compute the same results */
+    for (ii = RBD_ISA_SCALAR; ii <= RBD_ISA_NEON; ii++) {
+        isa = (enum rbdIsa)ii;
+        if (rbdSetIsa(isa) < 0) {
+            continue;
+        }
+        snprintf(name, sizeof(name), "ISA %d", rbdGetIsa());
+        rbdSetIsa(RBD_ISA_AUTO);
+        failures += checkKooNAgainstReference(name, rbdCheckTests, NUM_CHECKS, 0, &setupIsa, &teardownIsa, &isa);
+    }
+
+    return failures;
+}
+
+
+static int checkKooNLanes(void)
+{
+    enum rbdIsa isa;
+    int failures;
+
+    failures = 0;
+    /* Few time instants and hundreds of combinations (211 for 18oo20 and 3oo20) fill the vector lanes with combinations */
+    isa = RBD_ISA_SCALAR;
+    failures += checkKooNAgainstReference("KooN lanes 18oo20", rbdLanesChecks, NUM_LANES_CHECKS, 18, &setupIsa, &teardownIsa, &isa);
+    failures += checkKooNAgainstReference("KooN lanes 3oo20", rbdLanesChecks, NUM_LANES_CHECKS, 3, &setupIsa, &teardownIsa, &isa);
+
+    return failures;
+}
+
+
+static int referenceKooNReplicated(checkData *data)
+{
+    unsigned int kk;
+
+    /* Replicate reliabilities of first component into all the other ones */
+    for (kk = 1; kk < data->dim->numComponents; kk++) {
+        memcpy(&data->relMat[kk * data->dim->numTimes], data->relMat, sizeof(double) * data->dim->numTimes);
+    }
+
+    return rbdKooNGeneric(data->relMat, data->expected, data->dim->numComponents, data->minComponents, data->dim->numTimes);
+}
+
+
+static int computeKooNIdentical(checkData *data)
+{
+    return rbdKooNIdentical(data->relMat, data->output, data->dim->numComponents, data->minComponents, data->dim->numTimes);
+}
+
+
+static int checkKooNIdentical(void)
+{
+    int failures;
+
+    failures = 0;
+    /**
+     * Binomial coefficients of more than 67 components exceed 64 bits: identical 50oo100 and 128oo255 KooN, whose
+     * reliabilities span [0, 1] as those of components fall below 0.5, shall match generic KooN of replicated components
+     */
+    failures += checkAgainstReference("identical KooN", rbdIdenticalChecks, NUM_IDENTICAL_CHECKS, 0, &referenceKooNReplicated, &computeKooNIdentical, NULL);
+
+    return failures;
+}
+
+
+static void setupCacheSize(void *ctx)
+{
+    rbdSetCombinationsCacheSize(*(unsigned long long *)ctx);
+}
+
+
+static void setupCacheFlush(void *ctx)
+{
+    (void)ctx;
+    rbdSetCombinationsCacheSize(0);
+    rbdSetCombinationsCacheSize(CHECK_CACHE_SIZE);
+}
+
+
+static void teardownCacheSize(void *ctx)
+{
+    (void)ctx;
+    rbdSetCombinationsCacheSize(CHECK_CACHE_SIZE);
+}
+
+
+static int checkCombinationsCache(void)
+{
+    unsigned long long cacheSize;
+    int failures;
+
+    failures = 0;
+    /* Combinations computed without cache, cached, reused and finally evicted shall compute the same results */
+    cacheSize = 0;
+    failures += checkKooNAgainstReference("combinations cache (disabled)", rbdCheckTests, NUM_CHECKS, 0, &setupCacheSize, &teardownCacheSize, &cacheSize);
+    failures += checkKooNAgainstReference("combinations cache (miss)", rbdCheckTests, NUM_CHECKS, 0, &setupCacheFlush, NULL, NULL);
+    failures += checkKooNAgainstReference("combinations cache (hit)", rbdCheckTests, NUM_CHECKS, 0, NULL, NULL, NULL);
+    cacheSize = 1;
+    failures += checkKooNAgainstReference("combinations cache (evicted)", rbdCheckTests, NUM_CHECKS, 0, &setupCacheSize, &teardownCacheSize, &cacheSize);
+
+    return failures;
+}
+
+
+static void computeComposite(double *relMat, double *temp, double *output, unsigned int numTimes)
+{
+    /* Series of a 1oo2 Parallel (components 0-1), a 2oo3 KooN (components 2-4) and a Bridge (components 5-9) */
+    rbdParallelGeneric(&relMat[0 * numTimes], &temp[0 * numTimes], 2, numTimes);
+    rbdKooNGeneric(&relMat[2 * numTimes], &temp[1 * numTimes], 3, 2, numTimes);
+    rbdBridgeGeneric(&relMat[5 * numTimes], &temp[2 * numTimes], RBD_BRIDGE_COMPONENTS, numTimes);
+    rbdSeriesGeneric(temp, output, 3, numTimes);
+}
+
+
+static int referenceComposite(checkData *data)
+{
+    double *temp;
+
+    temp = (double *)malloc(sizeof(double) * 4 * data->dim->numTimes);
+
+    /* Composite RBD, optionally followed by a 2oo4 identical KooN of it */
+    if (*(unsigned int *)data->ctx == 4) {
+        computeComposite(data->relMat, temp, data->expected, data->dim->numTimes);
+    }
+    else {
+        computeComposite(data->relMat, temp, &temp[3 * data->dim->numTimes], data->dim->numTimes);
+        rbdKooNIdentical(&temp[3 * data->dim->numTimes], data->expected, 4, 2, data->dim->numTimes);
+    }
+
+    free(temp);
+
+    return 0;
+}
+
+
+static int computeTree(checkData *data)
+{
+    struct rbdTree *tree;
+    int nodes[CHECK_COMPONENTS];
+    int blocks[3];
+    int res;
+    int kk;
+
+    /* Build the composite RBD bottom-up */
+    tree = rbdTreeCreate();
+    for (kk = 0; kk < CHECK_COMPONENTS; kk++) {
+        nodes[kk] = rbdTreeAddComponent(tree, &data->relMat[kk * data->dim->numTimes]);
+    }
+    blocks[0] = rbdTreeAddParallel(tree, &nodes[0], 2);
+    blocks[1] = rbdTreeAddKooN(tree, &nodes[2], 3, 2);
+    blocks[2] = rbdTreeAddBridge(tree, &nodes[5]);
+    rbdTreeAddSeries(tree, blocks, 3);
+
+    res = rbdTreeEvaluate(tree, data->output, data->dim->numTimes);
+    rbdTreeDestroy(tree);
+
+    return res;
+}
+
+
+static int checkTree(void)
+{
+    unsigned int numBlocks;
+
+    numBlocks = 4;
+    return checkAgainstReference("tree", rbdCompositeChecks, NUM_COMPOSITE_CHECKS, 0, &referenceComposite, &computeTree, &numBlocks);
+}
+
+
+static int computeSequence(checkData *data)
+{
+    struct rbdBlock blocks[5];
+    unsigned int numBlocks;
+    unsigned int numTimes;
+    double *temp;
+    int res;
+
+    numBlocks = *(unsigned int *)data->ctx;
+    numTimes = data->dim->numTimes;
+    temp = (double *)malloc(sizeof(double) * 4 * numTimes);
+
+    /* Compute the composite RBD as a sequence, each block reading the outputs of the preceding ones */
+    blocks[0].type = RBD_BLOCK_PARALLEL_GENERIC;
+    blocks[0].reliabilities = &data->relMat[0 * numTimes];
+    blocks[0].output = &temp[0 * numTimes];
+    blocks[0].numComponents = 2;
+    blocks[0].minComponents = 0;
+    blocks[1].type = RBD_BLOCK_KOON_GENERIC;
+    blocks[1].reliabilities = &data->relMat[2 * numTimes];
+    blocks[1].output = &temp[1 * numTimes];
+    blocks[1].numComponents = 3;
+    blocks[1].minComponents = 2;
+    blocks[2].type = RBD_BLOCK_BRIDGE_GENERIC;
+    blocks[2].reliabilities = &data->relMat[5 * numTimes];
+    blocks[2].output = &temp[2 * numTimes];
+    blocks[2].numComponents = RBD_BRIDGE_COMPONENTS;
+    blocks[2].minComponents = 0;
+    blocks[3].type = RBD_BLOCK_SERIES_GENERIC;
+    blocks[3].reliabilities = temp;
+    blocks[3].output = (numBlocks == 4) ? data->output : &temp[3 * numTimes];
+    blocks[3].numComponents = 3;
+    blocks[3].minComponents = 0;
+    blocks[4].type = RBD_BLOCK_KOON_IDENTICAL;
+    blocks[4].reliabilities = &temp[3 * numTimes];
+    blocks[4].output = data->output;
+    blocks[4].numComponents = 4;
+    blocks[4].minComponents = 2;
+
+    res = rbdSequenceEvaluate(blocks, numBlocks, numTimes);
+
+    free(temp);
+
+    return res;
+}
+
+
+static int checkSequence(void)
+{
+    unsigned int numBlocks;
+    int failures;
+
+    failures = 0;
+    numBlocks = 4;
+    failures += checkAgainstReference("sequence", rbdCompositeChecks, NUM_COMPOSITE_CHECKS, 0, &referenceComposite, &computeSequence, &numBlocks);
+    numBlocks = 5;
+    failures += checkAgainstReference("sequence (identical KooN)", rbdCompositeChecks, NUM_COMPOSITE_CHECKS, 0, &referenceComposite, &computeSequence, &numBlocks);
+
+    return failures;
+}
+
+
+static int referenceParametric(checkData *data)
+{
+    switch (*(enum rbdBlockType *)data->ctx) {
+    case RBD_BLOCK_SERIES_GENERIC:
+        return rbdSeriesGeneric(data->relMat, data->expected, data->dim->numComponents, data->dim->numTimes);
+    case RBD_BLOCK_PARALLEL_GENERIC:
+        return rbdParallelGeneric(data->relMat, data->expected, data->dim->numComponents, data->dim->numTimes);
+    case RBD_BLOCK_KOON_GENERIC:
+        return rbdKooNGeneric(data->relMat, data->expected, data->dim->numComponents, data->minComponents, data->dim->numTimes);
+    default:
+        return rbdBridgeGeneric(data->relMat, data->expected, data->dim->numComponents, data->dim->numTimes);
+    }
+}
+
+
+static int computeParametric(checkData *data)
+{
+    struct rbdComponentModel *models;
+    double *times;
+    unsigned int ii;
+    int res;
+
+    models = (struct rbdComponentModel *)malloc(sizeof(struct rbdComponentModel) * data->dim->numComponents);
+    times = (double *)malloc(sizeof(double) * data->dim->numTimes);
+
+    /* Exponential components, whose reliabilities exp(-lambda*t) are otherwise provided as a matrix */
+    for (ii = 0; ii < data->dim->numComponents; ii++) {
+        models[ii].distribution = RBD_DISTRIBUTION_EXPONENTIAL;
+        models[ii].param1 = data->lambda[ii];
+        models[ii].param2 = 0.0;
+        models[ii].age = 0.0;
+    }
+    for (ii = 0; ii < data->dim->numTimes; ii++) {
+        times[ii] = (double)ii;
+    }
+
+    switch (*(enum rbdBlockType *)data->ctx) {
+    case RBD_BLOCK_SERIES_GENERIC:
+        res = rbdSeriesParametric(models, times, data->output, data->dim->numComponents, data->dim->numTimes);
+        break;
+    case RBD_BLOCK_PARALLEL_GENERIC:
+        res = rbdParallelParametric(models, times, data->output, data->dim->numComponents, data->dim->numTimes);
+        break;
+    case RBD_BLOCK_KOON_GENERIC:
+        res = rbdKooNParametric(models, times, data->output, data->dim->numComponents, data->minComponents, data->dim->numTimes);
+        break;
+    default:
+        res = rbdBridgeParametric(models, times, data->output, data->dim->numComponents, data->dim->numTimes);
+        break;
+    }
+
+    free(models);
+    free(times);
+
+    return res;
+}
+
+
+static int checkParametric(void)
+{
+    enum rbdBlockType type;
+    int failures;
+
+    failures = 0;
+    type = RBD_BLOCK_SERIES_GENERIC;
+    failures += checkAgainstReference("parametric Series", rbdCheckTests, NUM_CHECKS, 0, &referenceParametric, &computeParametric, &type);
+    type = RBD_BLOCK_PARALLEL_GENERIC;
+    failures += checkAgainstReference("parametric Parallel", rbdCheckTests, NUM_CHECKS, 0, &referenceParametric, &computeParametric, &type);
+    type = RBD_BLOCK_KOON_GENERIC;
+    failures += checkAgainstReference("parametric KooN", rbdCheckTests, NUM_CHECKS, 0, &referenceParametric, &computeParametric, &type);
+    type = RBD_BLOCK_BRIDGE_GENERIC;
+    failures += checkAgainstReference("parametric Bridge", rbdBridgeChecks, NUM_BRIDGE_CHECKS, 0, &referenceParametric, &computeParametric, &type);
+
+    return failures;
+}
+
+
 int main(int argc, char **argv)
 {
     struct timespec start;
@@ -184,6 +998,26 @@ int main(int argc, char **argv)
     unsigned char minComponents;
     FILE *pFile;
     char filename[300];
+    int failures;
+
+    /* Check the results of the RBD functions against the per-block ones */
+    failures = 0;
+    failures += checkAllocMatrix();
+    failures += checkKooNAll();
+    failures += checkMaxThreads();
+    failures += checkKooNSplit();
+    failures += checkExecutor();
+    failures += checkIsa();
+    failures += checkKooNLanes();
+    failures += checkKooNIdentical();
+    failures += checkCombinationsCache();
+    failures += checkTree();
+    failures += checkSequence();
+    failures += checkParametric();
+    if (failures != 0) {
+        printf("%d checks FAILED\n", failures);
+        return 1;
+    }
 
     for(ii = 0; ii < NUM_EXPERIMENTS; ++ii) {
         lambda = (double *)malloc(sizeof(double) * rbdTests[ii].numComponents);
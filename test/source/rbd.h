@@ -3,7 +3,7 @@
  *  RBD library APIs
  *
  *  librbd - Reliability Block Diagrams evaluation library
- *  Copyright (C) 2020 by Marco Papini <papini.m@gmail.com>
+ *  Copyright (C) 2020-2024 by Marco Papini <papini.m@gmail.com>
  *
  *  This program is free software: you can redistribute it and/or modify
  *  it under the terms of the GNU Affero General Public License as published
@@ -28,7 +28,85 @@ extern "C" {
 #endif
 
 
-#define RBD_BRIDGE_COMPONENTS       5       /* Nomber of components in Bridge RBD block */
+#define RBD_BRIDGE_COMPONENTS       5       /* Number of components in Bridge RBD block */
+
+
+/* Declare extern symbols */
+#define EXTERN          extern
+
+
+/**
+ * Instruction set families of RBD Workers, see rbdSetIsa
+ */
+enum rbdIsa
+{
+    RBD_ISA_AUTO = 0,                       /* Widest instruction set supported by processor */
+    RBD_ISA_SCALAR,                         /* No SIMD instruction set */
+    RBD_ISA_SSE2,                           /* x86/amd64 SSE2 instruction set */
+    RBD_ISA_AVX,                            /* amd64 AVX instruction set */
+    RBD_ISA_FMA3,                           /* amd64 AVX and FMA3 instruction sets */
+    RBD_ISA_AVX512F,                        /* amd64 AVX512F instruction set */
+    RBD_ISA_NEON                            /* AArch64 NEON instruction set */
+};
+
+
+/**
+ * Types of RBD blocks computed by rbdSequenceEvaluate
+ */
+enum rbdBlockType
+{
+    RBD_BLOCK_SERIES_GENERIC = 0,           /* Generic Series RBD block, see rbdSeriesGeneric */
+    RBD_BLOCK_SERIES_IDENTICAL,             /* Identical Series RBD block, see rbdSeriesIdentical */
+    RBD_BLOCK_PARALLEL_GENERIC,             /* Generic Parallel RBD block, see rbdParallelGeneric */
+    RBD_BLOCK_PARALLEL_IDENTICAL,           /* Identical Parallel RBD block, see rbdParallelIdentical */
+    RBD_BLOCK_KOON_GENERIC,                 /* Generic KooN RBD block, see rbdKooNGeneric */
+    RBD_BLOCK_KOON_IDENTICAL,               /* Identical KooN RBD block, see rbdKooNIdentical */
+    RBD_BLOCK_BRIDGE_GENERIC,               /* Generic Bridge RBD block, see rbdBridgeGeneric */
+    RBD_BLOCK_BRIDGE_IDENTICAL              /* Identical Bridge RBD block, see rbdBridgeIdentical */
+};
+
+/**
+ * RBD block computed by rbdSequenceEvaluate, whose parameters are the ones of the
+ * corresponding RBD function
+ */
+struct rbdBlock
+{
+    enum rbdBlockType type;                 /* Type of RBD block */
+    double *reliabilities;                  /* Reliabilities of components (matrix for generic blocks, array for identical blocks) */
+    double *output;                         /* Array of computed reliabilities */
+    unsigned char numComponents;            /* Number of components of RBD block N */
+    unsigned char minComponents;            /* Minimum number of components required by KooN RBD block K (KooN only) */
+};
+
+/**
+ * Failure distributions of components, see struct rbdComponentModel
+ */
+enum rbdDistribution
+{
+    RBD_DISTRIBUTION_EXPONENTIAL = 0,       /* Exponential, R(t) = exp(-lambda * t) */
+    RBD_DISTRIBUTION_WEIBULL,               /* Weibull, R(t) = exp(-(t / eta)^beta) */
+    RBD_DISTRIBUTION_LOGNORMAL              /* Lognormal, R(t) = erfc((ln(t) - mu) / (sigma * sqrt(2))) / 2 */
+};
+
+/**
+ * Parametric model of component reliability, see rbd*Parametric functions
+ */
+struct rbdComponentModel
+{
+    enum rbdDistribution distribution;      /* Failure distribution of component */
+    double param1;                          /* Exponential: failure rate lambda >= 0, Weibull: shape beta > 0, Lognormal: mu */
+    double param2;                          /* Exponential: unused, Weibull: scale eta > 0, Lognormal: sigma > 0 */
+    double age;                             /* Age of component at time 0, i.e. its reliability at time t is R(t + age) */
+};
+
+/* Composite RBD tree, see rbdTreeCreate */
+struct rbdTree;
+
+
+/* Executor callback submitting a job, see rbdSetExecutor */
+typedef int (*rbdExecutorSubmit)(void *ctx, void *(*fn)(void *), void *arg, void **handle);
+/* Executor callback waiting for the completion of a submitted job, see rbdSetExecutor */
+typedef void (*rbdExecutorWait)(void *ctx, void *handle);
 
 
 /**
@@ -61,7 +139,7 @@ extern "C" {
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdSeriesGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
+EXTERN int rbdSeriesGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
 
 /**
  * rbdSeriesIdentical
@@ -91,7 +169,7 @@ extern int rbdSeriesGeneric(double *reliabilities, double *output, unsigned char
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdSeriesIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
+EXTERN int rbdSeriesIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
 
 /**
  * rbdParallelGeneric
@@ -123,7 +201,7 @@ extern int rbdSeriesIdentical(double *reliabilities, double *output, unsigned ch
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdParallelGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
+EXTERN int rbdParallelGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
 
 /**
  * rbdParallelIdentical
@@ -153,7 +231,7 @@ extern int rbdParallelGeneric(double *reliabilities, double *output, unsigned ch
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdParallelIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
+EXTERN int rbdParallelIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
 
 /**
  * rbdKooNGeneric
@@ -187,7 +265,7 @@ extern int rbdParallelIdentical(double *reliabilities, double *output, unsigned
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdKooNGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes);
+EXTERN int rbdKooNGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes);
 
 /**
  * rbdKooNIdentical
@@ -219,7 +297,42 @@ extern int rbdKooNGeneric(double *reliabilities, double *output, unsigned char n
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdKooNIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes);
+EXTERN int rbdKooNIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes);
+
+/**
+ * rbdKooNAllGeneric
+ *
+ * Compute reliability of all generic KooN (K-out-of-N) RBD systems with K in [1, N]
+ *
+ * Input:
+ *      double *reliabilities
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes, in a single pass over the input reliabilities, the reliabilities
+ *  over time of all the generic KooN (K-out-of-N) RBD systems with K in [1, N] sharing the
+ *  same components, i.e. the tail sums of the distribution of the number of working components
+ *
+ * Parameters:
+ *      reliabilities: this matrix contains the input reliabilities of all components
+ *                      at the provided time instants. The matrix shall be provided as
+ *                      a NxT one, where N is the number of components of KooN RBD
+ *                      systems and T is the number of time instants
+ *      output: this matrix contains the reliabilities of KooN RBD systems computed at
+ *                      the provided time instants. The matrix shall be provided as a NxT
+ *                      one, whose row k-1 contains the reliabilities of the KooN RBD system
+ *                      with K=k
+ *      numComponents: number of components in KooN RBD systems (N)
+ *      numTimes: number of time instants over which KooN RBD systems shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdKooNAllGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
 
 /**
  * rbdBridgeIdentical
@@ -249,7 +362,7 @@ extern int rbdKooNIdentical(double *reliabilities, double *output, unsigned char
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdBridgeIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
+EXTERN int rbdBridgeIdentical(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
 
 /**
  * rbdBridgeGeneric
@@ -281,7 +394,627 @@ extern int rbdBridgeIdentical(double *reliabilities, double *output, unsigned ch
  * Return (int):
  *  0 in case of successful computation, < 0 otherwise
  */
-extern int rbdBridgeGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
+EXTERN int rbdBridgeGeneric(double *reliabilities, double *output, unsigned char numComponents, unsigned int numTimes);
+
+/**
+ * rbdTreeCreate
+ *
+ * Create an empty composite RBD tree
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function creates an empty composite RBD tree, i.e. a system made of nested Series,
+ *  Parallel, KooN and Bridge RBD blocks. Components and blocks are added bottom-up through
+ *  the rbdTreeAdd*() functions, the tree shall be released through rbdTreeDestroy()
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (struct rbdTree *):
+ *  != NULL in case of successful creation, NULL otherwise
+ */
+EXTERN struct rbdTree *rbdTreeCreate(void);
+
+/**
+ * rbdTreeAddComponent
+ *
+ * Add a component to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      double *reliabilities
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a component (leaf) to the composite RBD tree. The reliabilities of
+ *  the component are read by rbdTreeEvaluate(), hence they shall be available until then
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      reliabilities: this array contains the reliabilities of component at the time
+ *                      instants over which the tree shall be computed
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddComponent(struct rbdTree *tree, double *reliabilities);
+
+/**
+ * rbdTreeAddSeries
+ *
+ * Add a generic Series RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *      unsigned char numChildren
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic Series RBD block to the composite RBD tree, whose components
+ *  are the provided nodes. Each node can be a component of a single block
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the nodes which are the components of block
+ *      numChildren: number of components in Series RBD block (N)
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddSeries(struct rbdTree *tree, int *children, unsigned char numChildren);
+
+/**
+ * rbdTreeAddParallel
+ *
+ * Add a generic Parallel RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *      unsigned char numChildren
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic Parallel RBD block to the composite RBD tree, whose components
+ *  are the provided nodes. Each node can be a component of a single block
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the nodes which are the components of block
+ *      numChildren: number of components in Parallel RBD block (N)
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddParallel(struct rbdTree *tree, int *children, unsigned char numChildren);
+
+/**
+ * rbdTreeAddKooN
+ *
+ * Add a generic KooN (K-out-of-N) RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *      unsigned char numChildren
+ *      unsigned char minComponents
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic KooN RBD block to the composite RBD tree, whose components
+ *  are the provided nodes. Each node can be a component of a single block
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the nodes which are the components of block
+ *      numChildren: number of components in KooN RBD block (N)
+ *      minComponents: minimum number of components required by KooN RBD block (K)
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddKooN(struct rbdTree *tree, int *children, unsigned char numChildren, unsigned char minComponents);
+
+/**
+ * rbdTreeAddBridge
+ *
+ * Add a generic Bridge RBD block to a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      int *children
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function adds a generic Bridge RBD block to the composite RBD tree, whose
+ *  RBD_BRIDGE_COMPONENTS components are the provided nodes. Each node can be a component
+ *  of a single block
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      children: this array contains the indexes of the RBD_BRIDGE_COMPONENTS nodes which
+ *                      are the components of block
+ *
+ * Return (int):
+ *  Index of added node (>= 0) in case of success, < 0 otherwise
+ */
+EXTERN int rbdTreeAddBridge(struct rbdTree *tree, int *children);
+
+/**
+ * rbdTreeEvaluate
+ *
+ * Compute reliability of a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of the composite RBD tree, whose root
+ *  is its only node which is not a component of any block. All the blocks are computed over
+ *  a tile of time instants before moving to the next one, so that the reliabilities of each
+ *  component are read once and no intermediate array is written back to memory
+ *
+ * Parameters:
+ *      tree: composite RBD tree
+ *      output: this array contains the reliabilities of composite RBD tree computed at
+ *                      the provided time instants
+ *      numTimes: number of time instants over which composite RBD tree shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdTreeEvaluate(struct rbdTree *tree, double *output, unsigned int numTimes);
+
+/**
+ * rbdTreeDestroy
+ *
+ * Destroy a composite RBD tree
+ *
+ * Input:
+ *      struct rbdTree *tree
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases the composite RBD tree created through rbdTreeCreate().
+ *  The reliabilities of components are owned by user and are not released
+ *
+ * Parameters:
+ *      tree: composite RBD tree to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdTreeDestroy(struct rbdTree *tree);
+
+/**
+ * rbdSequenceEvaluate
+ *
+ * Compute reliability of a sequence of dependent RBD blocks
+ *
+ * Input:
+ *      struct rbdBlock *blocks
+ *      unsigned int numBlocks
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function computes the provided RBD blocks, with the same result as invoking the
+ *  corresponding RBD functions in the provided order. A block can read the output of a
+ *  preceding block, e.g. by providing as output of the latter a row of the reliability
+ *  matrix of the former. Rather than computing each block over all time instants, all the
+ *  blocks are computed over a tile of time instants fitting into L2 cache before moving to
+ *  the next one, so that the outputs of preceding blocks are read from cache
+ *
+ * Parameters:
+ *      blocks: this array contains the RBD blocks to be computed, in dependency order
+ *      numBlocks: number of RBD blocks
+ *      numTimes: number of time instants over which RBD blocks shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdSequenceEvaluate(struct rbdBlock *blocks, unsigned int numBlocks, unsigned int numTimes);
+
+/**
+ * rbdSeriesParametric
+ *
+ * Compute reliability of a Series RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic Series RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of Series RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in Series RBD system (N)
+ *      numTimes: number of time instants over which Series RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdSeriesParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned int numTimes);
+
+/**
+ * rbdParallelParametric
+ *
+ * Compute reliability of a Parallel RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic Parallel RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of Parallel RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in Parallel RBD system (N)
+ *      numTimes: number of time instants over which Parallel RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdParallelParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned int numTimes);
+
+/**
+ * rbdKooNParametric
+ *
+ * Compute reliability of a KooN (K-out-of-N) RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned char minComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic KooN RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of KooN RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in KooN RBD system (N)
+ *      minComponents: minimum number of components required by KooN RBD system (K)
+ *      numTimes: number of time instants over which KooN RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdKooNParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned char minComponents, unsigned int numTimes);
+
+/**
+ * rbdBridgeParametric
+ *
+ * Compute reliability of a Bridge RBD system with parametric components
+ *
+ * Input:
+ *      struct rbdComponentModel *models
+ *      double *times
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      double *output
+ *
+ * Description:
+ *  This function computes the reliabilities over time of a generic Bridge RBD system.
+ *  The reliabilities of its components are computed from their parametric models over
+ *  tiles of time instants, so that no reliability matrix is required
+ *
+ * Parameters:
+ *      models: this array contains the parametric models of all components
+ *      times: this array contains the time instants over which the reliabilities of
+ *                      components are computed
+ *      output: this array contains the reliabilities of Bridge RBD system computed at
+ *                      the provided time instants
+ *      numComponents: number of components in Bridge RBD system (N)
+ *      numTimes: number of time instants over which Bridge RBD shall be computed (T)
+ *
+ * Return (int):
+ *  0 in case of successful computation, < 0 otherwise
+ */
+EXTERN int rbdBridgeParametric(struct rbdComponentModel *models, double *times, double *output, unsigned char numComponents, unsigned int numTimes);
+
+/**
+ * rbdThreadPoolInit
+ *
+ * Create the pool of RBD Worker threads
+ *
+ * Input:
+ *      unsigned int numThreads
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function creates the process-wide pool of parked RBD Worker threads.
+ *  The pool is otherwise lazily created by the first RBD computation requiring SMP.
+ *  If the pool is already running this function has no effect
+ *
+ * Parameters:
+ *      numThreads: number of pool threads. When 0, the number of available cores
+ *                      minus one (the calling thread always computes one batch) is used
+ *
+ * Return (int):
+ *  0 in case of successful creation, < 0 otherwise
+ */
+EXTERN int rbdThreadPoolInit(unsigned int numThreads);
+
+/**
+ * rbdThreadPoolShutdown
+ *
+ * Destroy the pool of RBD Worker threads
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function terminates all threads of the process-wide pool after the completion
+ *  of the queued jobs. A subsequent RBD computation lazily creates the pool again
+ *
+ * Parameters:
+ *      None
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdThreadPoolShutdown(void);
+
+/**
+ * rbdSetMaxThreads
+ *
+ * Cap the number of threads used to compute RBD blocks
+ *
+ * Input:
+ *      unsigned int maxThreads
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function caps the number of threads (calling thread included) used by each RBD computation.
+ *  The number of cores detected on the system (online cores limited by the CPU affinity mask and,
+ *  on Linux, by the cgroup CPU quota) and the RBD_MAX_THREADS environment variable, when set,
+ *  remain upper bounds of the requested value. The built-in thread pool is sized regardless of
+ *  the requested value, so that a cap can be later raised or removed.
+ *  It can be invoked while RBD computations are in progress, which use either the old or the new cap
+ *
+ * Parameters:
+ *      maxThreads: maximum number of threads, 0 to remove the cap
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdSetMaxThreads(unsigned int maxThreads);
+
+/**
+ * rbdSetExecutor
+ *
+ * Route RBD Worker jobs to an application-provided executor
+ *
+ * Input:
+ *      rbdExecutorSubmit submitFn
+ *      rbdExecutorWait waitFn
+ *      void *ctx
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function replaces the built-in thread pool with an executor owned by the application.
+ *  Each RBD Worker job is handed to submitFn, which shall arrange for fn(arg) to be executed
+ *  (e.g. on a thread of the application pool) and return through handle a token identifying
+ *  the job. The calling thread later provides that token to waitFn, which shall return only
+ *  once fn(arg) has completed. In case submitFn fails, the job is executed by the calling thread.
+ *  The executor is sampled at job submission, computations already in progress are not affected.
+ *  The stack used by a job grows with the number of components of the computed RBD block:
+ *  threads executing jobs shall provide at least 128 KB of stack, which is required by
+ *  generic KooN RBD blocks with 255 components.
+ *  Providing NULL callbacks restores the built-in thread pool
+ *
+ * Parameters:
+ *      submitFn: callback submitting a job to executor, it shall return 0 in case of success, < 0 otherwise
+ *      waitFn: callback waiting for the completion of a submitted job
+ *      ctx: opaque pointer provided to both callbacks
+ *
+ * Return (int):
+ *  0 in case of successful executor setting, < 0 otherwise (only one callback provided)
+ */
+EXTERN int rbdSetExecutor(rbdExecutorSubmit submitFn, rbdExecutorWait waitFn, void *ctx);
+
+
+/**
+ * rbdSetIsa
+ *
+ * Cap the instruction set family used by RBD Workers
+ *
+ * Input:
+ *      enum rbdIsa isa
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function caps the instruction set family used by RBD Workers: on amd64 the widest
+ *  family supported by the processor and not wider than the requested one is selected
+ *  (e.g. RBD_ISA_AVX disables FMA3 and AVX512F Workers), on AArch64 RBD_ISA_SCALAR disables
+ *  NEON Workers. The initial family is taken from
+ *  the RBD_ISA environment variable, when set to one of "auto", "scalar", "sse2", "avx",
+ *  "fma3", "avx512f" or "neon". This function shall not be invoked while RBD computations
+ *  are in progress
+ *
+ * Parameters:
+ *      isa: requested instruction set family, RBD_ISA_AUTO to remove the cap
+ *
+ * Return (int):
+ *  0 in case of successful selection, < 0 otherwise (family not available on current platform)
+ */
+EXTERN int rbdSetIsa(enum rbdIsa isa);
+
+/**
+ * rbdGetIsa
+ *
+ * Retrieve the instruction set family used by RBD Workers
+ *
+ * Input:
+ *      None
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function retrieves the instruction set family actually used by RBD Workers, given
+ *  the processor capabilities and the cap set through rbdSetIsa or RBD_ISA environment variable
+ *
+ * Parameters:
+ *      None
+ *
+ * Return (enum rbdIsa):
+ *  Active instruction set family, never RBD_ISA_AUTO
+ */
+EXTERN enum rbdIsa rbdGetIsa(void);
+
+/**
+ * rbdSetCombinationsCacheSize
+ *
+ * Set the memory budget of the combinations cache
+ *
+ * Input:
+ *      unsigned long long maxSize
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function sets the memory budget of the process-wide cache of the combinations
+ *  used by generic KooN RBD blocks (1 MiB by default), so that repeated computations of
+ *  blocks with the same N and K do not compute them again. The least recently used
+ *  combinations not in use are evicted until the cache fits into the new budget
+ *
+ * Parameters:
+ *      maxSize: memory budget (in bytes), 0 to disable the cache
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdSetCombinationsCacheSize(unsigned long long maxSize);
+
+
+/**
+ * rbdAllocMatrix
+ *
+ * Allocate an aligned and padded reliability matrix
+ *
+ * Input:
+ *      unsigned char numComponents
+ *      unsigned int numTimes
+ *
+ * Output:
+ *      unsigned int *ld
+ *
+ * Description:
+ *  This function allocates a zeroed NxLD matrix of doubles whose rows start on a 64 byte boundary.
+ *  The leading dimension LD is numTimes rounded up to a multiple of 8 (the widest vector size),
+ *  so that all rows share the same alignment and SIMD Workers never split a load across cache
+ *  lines. On Linux, large matrices are advised to be backed by transparent huge pages.
+ *  In order to exploit the alignment, RBD blocks shall be computed with LD as number of time
+ *  instants, both input and output being allocated through this function: the reliabilities of
+ *  padding time instants are 0, the corresponding outputs shall be ignored.
+ *  The matrix shall be released through rbdFree()
+ *
+ * Parameters:
+ *      numComponents: number of rows of matrix (N), 1 to allocate an array
+ *      numTimes: number of time instants of each row (T)
+ *      ld: leading dimension of matrix (LD), i.e. number of doubles between the beginning of
+ *                      two consecutive rows
+ *
+ * Return (double *):
+ *  != NULL in case of successful allocation, NULL otherwise
+ */
+EXTERN double *rbdAllocMatrix(unsigned char numComponents, unsigned int numTimes, unsigned int *ld);
+
+/**
+ * rbdFree
+ *
+ * Free a reliability matrix
+ *
+ * Input:
+ *      double *matrix
+ *
+ * Output:
+ *      None
+ *
+ * Description:
+ *  This function releases a matrix allocated through rbdAllocMatrix()
+ *
+ * Parameters:
+ *      matrix: matrix to release, NULL is ignored
+ *
+ * Return:
+ *      None
+ */
+EXTERN void rbdFree(double *matrix);
 
 
 #ifdef  __cplusplus
@@ -289,4 +1022,4 @@ extern int rbdBridgeGeneric(double *reliabilities, double *output, unsigned char
 #endif
 
 
-#endif  /* RBD_H_ */
+#endif /* RBD_H_ */